@@ -29,7 +29,13 @@
 #include <App.h>
 
 #include <Common/Core/BasicEntityFactory.h>
+#include <Common/Core/TestConfig.h>
+#include <Common/Core/TimerService.h>
+#include <Common/Memory/AllocatorRegistry.h>
+#include <Common/Memory/FrameAllocatorSystem.h>
+#include <Common/Performance/TraceRecorder.h>
 #include <Common/UI/BasicWidgetFactory.h>
+#include <Headless/State.h>
 #include <MainMenu/State.h>
 
 #include <ChilliSource/Audio/CricketAudio.h>
@@ -109,6 +115,11 @@ namespace CSTest
         CreateSystem<CS::CSSubtitlesProvider>();
 
         CreateSystem<Common::BasicEntityFactory>();
+        CreateSystem<Common::TestConfig>();
+        CreateSystem<Common::TimerService>();
+        CreateSystem<Common::TraceRecorder>();
+        CreateSystem<Common::AllocatorRegistry>();
+        CreateSystem<Common::FrameAllocatorSystem>();
         CreateSystem<Common::BasicWidgetFactory>();
     }
     //------------------------------------------------------------------------------
@@ -120,7 +131,14 @@ namespace CSTest
     //------------------------------------------------------------------------------
     void App::PushInitialState() noexcept
     {
-        GetStateManager()->Push(CS::StateSPtr(new MainMenu::State()));
+        if (GetSystem<Common::TestConfig>()->IsHeadless())
+        {
+            GetStateManager()->Push(CS::StateSPtr(new Headless::State()));
+        }
+        else
+        {
+            GetStateManager()->Push(CS::StateSPtr(new MainMenu::State()));
+        }
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
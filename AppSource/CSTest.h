@@ -47,13 +47,38 @@ namespace CSTest
     
     namespace Common
     {
+        CS_FORWARDDECLARE_CLASS(AlignedAllocator);
+        CS_FORWARDDECLARE_CLASS(AllocationStats);
+        CS_FORWARDDECLARE_CLASS(AllocationTracker);
+        CS_FORWARDDECLARE_CLASS(AllocatorMemoryResource);
+        CS_FORWARDDECLARE_CLASS(AllocatorRegistry);
+        CS_FORWARDDECLARE_CLASS(AllocatorStats);
         CS_FORWARDDECLARE_CLASS(BasicEntityFactory);
         CS_FORWARDDECLARE_CLASS(BasicWidgetFactory);
+        CS_FORWARDDECLARE_CLASS(CsvReportWriter);
         CS_FORWARDDECLARE_CLASS(FollowerComponent);
+        CS_FORWARDDECLARE_CLASS(FrameAllocatorSystem);
+        CS_FORWARDDECLARE_CLASS(JsonReportReader);
+        CS_FORWARDDECLARE_CLASS(JsonReportWriter);
+        CS_FORWARDDECLARE_CLASS(JUnitReportWriter);
+        CS_FORWARDDECLARE_CLASS(MemoryResource);
         CS_FORWARDDECLARE_CLASS(OptionsMenuPresenter);
         CS_FORWARDDECLARE_CLASS(OptionsMenuDesc);
         CS_FORWARDDECLARE_CLASS(OrbiterComponent);
+        CS_FORWARDDECLARE_CLASS(PerformanceBaseline);
+        CS_FORWARDDECLARE_CLASS(PerformanceGate);
+        CS_FORWARDDECLARE_CLASS(PerformanceRegression);
+        CS_FORWARDDECLARE_CLASS(ProcessMemory);
+        CS_FORWARDDECLARE_CLASS(ReportExporter);
         CS_FORWARDDECLARE_CLASS(ResultPresenter);
+        CS_FORWARDDECLARE_CLASS(SamplingProfiler);
+        CS_FORWARDDECLARE_CLASS(ScratchAllocator);
+        CS_FORWARDDECLARE_CLASS(SoakReport);
+        CS_FORWARDDECLARE_CLASS(TestConfig);
+        CS_FORWARDDECLARE_CLASS(TestFilter);
+        CS_FORWARDDECLARE_CLASS(TimerService);
+        CS_FORWARDDECLARE_CLASS(TrackedAllocator);
+        CS_FORWARDDECLARE_CLASS(TraceRecorder);
         CS_FORWARDDECLARE_CLASS(TestNavigator);
         CS_FORWARDDECLARE_CLASS(BackButtonSystem);
     }
@@ -98,9 +123,19 @@ namespace CSTest
         CS_FORWARDDECLARE_CLASS(State);
     }
     
+    namespace Headless
+    {
+        CS_FORWARDDECLARE_CLASS(State);
+    }
+    
     namespace IntegrationTest
     {
         CS_FORWARDDECLARE_CLASS(AutoRegister);
+        CS_FORWARDDECLARE_CLASS(Benchmark);
+        CS_FORWARDDECLARE_CLASS(BenchmarkStats);
+        CS_FORWARDDECLARE_CLASS(Fixture);
+        CS_FORWARDDECLARE_CLASS(LatencyRecord);
+        CS_FORWARDDECLARE_CLASS(LatencyTimer);
         CS_FORWARDDECLARE_CLASS(Report);
         CS_FORWARDDECLARE_CLASS(ReportPresenter);
         CS_FORWARDDECLARE_CLASS(State);
@@ -160,13 +195,16 @@ namespace CSTest
     
     namespace UnitTest
     {
+        CS_FORWARDDECLARE_CLASS(BenchmarkResult);
         CS_FORWARDDECLARE_CLASS(CSReporter);
         CS_FORWARDDECLARE_CLASS(FailedAssertion);
         CS_FORWARDDECLARE_CLASS(FailedSection);
         CS_FORWARDDECLARE_CLASS(FailedTestCase);
         CS_FORWARDDECLARE_CLASS(Report);
         CS_FORWARDDECLARE_CLASS(ReportPresenter);
+        CS_FORWARDDECLARE_CLASS(SectionResult);
         CS_FORWARDDECLARE_CLASS(State);
+        CS_FORWARDDECLARE_CLASS(TestCaseResult);
         CS_FORWARDDECLARE_CLASS(TestSystem);
     }
 
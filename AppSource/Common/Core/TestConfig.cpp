@@ -0,0 +1,508 @@
+//
+//  TestConfig.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Core/TestConfig.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+#include <ChilliSource/Core/Json.h>
+#include <ChilliSource/Core/String.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            constexpr char k_appConfigFilePath[] = "App.config";
+            constexpr char k_testsKey[] = "Tests";
+            constexpr char k_headlessKey[] = "Headless";
+            constexpr char k_includeKey[] = "Include";
+            constexpr char k_excludeKey[] = "Exclude";
+            constexpr char k_shardIndexKey[] = "ShardIndex";
+            constexpr char k_shardCountKey[] = "ShardCount";
+            constexpr char k_soakPassesKey[] = "SoakPasses";
+            constexpr char k_soakDurationSecondsKey[] = "SoakDurationSeconds";
+            constexpr char k_repeatKey[] = "Repeat";
+            constexpr char k_maxConcurrentTestsKey[] = "MaxConcurrentTests";
+            constexpr char k_profileKey[] = "Profile";
+            constexpr char k_traceKey[] = "Trace";
+            constexpr char k_unitTestProcessesKey[] = "UnitTestProcesses";
+            constexpr char k_slowSectionSecondsKey[] = "SlowSectionSeconds";
+            constexpr char k_allocatorStatsKey[] = "AllocatorStats";
+            constexpr char k_performanceGateKey[] = "PerformanceGate";
+            constexpr char k_performanceToleranceKey[] = "PerformanceTolerance";
+            constexpr char k_updatePerformanceBaselineKey[] = "UpdatePerformanceBaseline";
+            constexpr char k_headlessArgument[] = "--headless";
+            constexpr char k_includeArgument[] = "--include=";
+            constexpr char k_excludeArgument[] = "--exclude=";
+            constexpr char k_shardArgument[] = "--shard=";
+            constexpr char k_soakArgument[] = "--soak=";
+            constexpr char k_soakDurationArgument[] = "--soak-duration=";
+            constexpr char k_repeatArgument[] = "--repeat=";
+            constexpr char k_maxConcurrentTestsArgument[] = "--max-concurrent-tests=";
+            constexpr char k_profileArgument[] = "--profile=";
+            constexpr char k_traceArgument[] = "--trace";
+            constexpr char k_unitTestProcessesArgument[] = "--unit-test-processes=";
+            constexpr char k_slowSectionArgument[] = "--slow-section=";
+            constexpr char k_allocatorStatsArgument[] = "--allocator-stats";
+            constexpr char k_performanceGateArgument[] = "--performance-gate=";
+            constexpr char k_performanceToleranceArgument[] = "--performance-tolerance=";
+            constexpr char k_updateBaselineArgument[] = "--update-baseline";
+            
+            //------------------------------------------------------------------------------
+            /// The options which describe how tests should be run, as they are read from
+            /// the config file and launch arguments.
+            //------------------------------------------------------------------------------
+            struct Options final
+            {
+                bool m_isHeadless = false;
+                std::vector<std::string> m_includePatterns;
+                std::vector<std::string> m_excludePatterns;
+                u32 m_shardIndex = 0;
+                u32 m_shardCount = 1;
+                u32 m_soakPasses = 1;
+                f32 m_soakDurationSeconds = 0.0f;
+                u32 m_numRepeats = 1;
+                u32 m_maxConcurrentTests = 4;
+                std::vector<std::string> m_profilePatterns;
+                bool m_isTraceEnabled = false;
+                u32 m_numUnitTestProcesses = 1;
+                f32 m_slowSectionSeconds = TestConfig::k_defaultSlowSectionSeconds;
+                bool m_isAllocatorStatsEnabled = false;
+                PerformanceGate::Mode m_performanceGateMode = PerformanceGate::Mode::k_warn;
+                f32 m_performanceTolerance = PerformanceGate::k_defaultTolerance;
+                bool m_updatePerformanceBaseline = false;
+            };
+            
+            //------------------------------------------------------------------------------
+            /// @param in_jsonArray - A json array of strings.
+            ///
+            /// @return The strings in the array. Any non-string values are ignored.
+            //------------------------------------------------------------------------------
+            std::vector<std::string> ReadStringArray(const Json::Value& in_jsonArray) noexcept
+            {
+                std::vector<std::string> output;
+                
+                if (in_jsonArray.isArray())
+                {
+                    for (u32 i = 0; i < in_jsonArray.size(); ++i)
+                    {
+                        if (in_jsonArray[i].isString())
+                        {
+                            output.push_back(in_jsonArray[i].asString());
+                        }
+                    }
+                }
+                
+                return output;
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_string - A comma separated list.
+            ///
+            /// @return The non-empty elements of the list.
+            //------------------------------------------------------------------------------
+            std::vector<std::string> SplitList(const std::string& in_string) noexcept
+            {
+                std::vector<std::string> output;
+                
+                std::stringstream stream(in_string);
+                std::string element;
+                while (std::getline(stream, element, ','))
+                {
+                    if (!element.empty())
+                    {
+                        output.push_back(element);
+                    }
+                }
+                
+                return output;
+            }
+            //------------------------------------------------------------------------------
+            /// Parses a performance gate mode, ignoring case. If the mode is not
+            /// recognised a warning is logged and the output is left unchanged.
+            ///
+            /// @param in_string - The mode; "disabled", "warn" or "fail".
+            /// @param out_mode - The parsed mode.
+            //------------------------------------------------------------------------------
+            void ParsePerformanceGateMode(const std::string& in_string, PerformanceGate::Mode& out_mode) noexcept
+            {
+                auto mode = in_string;
+                std::transform(mode.begin(), mode.end(), mode.begin(), [](char in_character) { return char(std::tolower(static_cast<unsigned char>(in_character))); });
+                
+                if (mode == "disabled")
+                {
+                    out_mode = PerformanceGate::Mode::k_disabled;
+                }
+                else if (mode == "warn")
+                {
+                    out_mode = PerformanceGate::Mode::k_warn;
+                }
+                else if (mode == "fail")
+                {
+                    out_mode = PerformanceGate::Mode::k_fail;
+                }
+                else
+                {
+                    CS_LOG_WARNING("Unknown performance gate mode '" + in_string + "', expected disabled, warn or fail.");
+                }
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_string - The string to check.
+            /// @param in_prefix - The prefix.
+            ///
+            /// @return Whether or not the string starts with the given prefix.
+            //------------------------------------------------------------------------------
+            bool StartsWith(const std::string& in_string, const std::string& in_prefix) noexcept
+            {
+                return in_string.compare(0, in_prefix.size(), in_prefix) == 0;
+            }
+            //------------------------------------------------------------------------------
+            /// Reads the "Tests" section of App.config, if there is one, into the given
+            /// options.
+            ///
+            /// @param out_options - The options to update.
+            //------------------------------------------------------------------------------
+            void ReadAppConfig(Options& out_options) noexcept
+            {
+                std::string contents;
+                if (!CS::Application::Get()->GetFileSystem()->ReadFile(CS::StorageLocation::k_package, k_appConfigFilePath, contents))
+                {
+                    return;
+                }
+                
+                Json::Value root;
+                Json::Reader reader;
+                if (!reader.parse(contents, root) || !root.isObject() || !root[k_testsKey].isObject())
+                {
+                    return;
+                }
+                
+                const auto& tests = root[k_testsKey];
+                out_options.m_isHeadless = tests.get(k_headlessKey, out_options.m_isHeadless).asBool();
+                out_options.m_includePatterns = ReadStringArray(tests[k_includeKey]);
+                out_options.m_excludePatterns = ReadStringArray(tests[k_excludeKey]);
+                out_options.m_shardIndex = tests.get(k_shardIndexKey, out_options.m_shardIndex).asUInt();
+                out_options.m_shardCount = tests.get(k_shardCountKey, out_options.m_shardCount).asUInt();
+                out_options.m_soakPasses = tests.get(k_soakPassesKey, out_options.m_soakPasses).asUInt();
+                out_options.m_soakDurationSeconds = tests.get(k_soakDurationSecondsKey, out_options.m_soakDurationSeconds).asFloat();
+                out_options.m_numRepeats = tests.get(k_repeatKey, out_options.m_numRepeats).asUInt();
+                out_options.m_maxConcurrentTests = tests.get(k_maxConcurrentTestsKey, out_options.m_maxConcurrentTests).asUInt();
+                out_options.m_profilePatterns = ReadStringArray(tests[k_profileKey]);
+                out_options.m_isTraceEnabled = tests.get(k_traceKey, out_options.m_isTraceEnabled).asBool();
+                out_options.m_numUnitTestProcesses = tests.get(k_unitTestProcessesKey, out_options.m_numUnitTestProcesses).asUInt();
+                out_options.m_slowSectionSeconds = tests.get(k_slowSectionSecondsKey, out_options.m_slowSectionSeconds).asFloat();
+                out_options.m_isAllocatorStatsEnabled = tests.get(k_allocatorStatsKey, out_options.m_isAllocatorStatsEnabled).asBool();
+                if (tests[k_performanceGateKey].isString())
+                {
+                    ParsePerformanceGateMode(tests[k_performanceGateKey].asString(), out_options.m_performanceGateMode);
+                }
+                out_options.m_performanceTolerance = tests.get(k_performanceToleranceKey, out_options.m_performanceTolerance).asFloat();
+                out_options.m_updatePerformanceBaseline = tests.get(k_updatePerformanceBaselineKey, out_options.m_updatePerformanceBaseline).asBool();
+            }
+            //------------------------------------------------------------------------------
+            /// Reads the launch arguments from the CSTEST_ARGS environment variable, if it
+            /// is set, into the given options. Arguments override anything set in
+            /// App.config.
+            ///
+            /// @param out_options - The options to update.
+            //------------------------------------------------------------------------------
+            void ReadLaunchArguments(Options& out_options) noexcept
+            {
+                const char* arguments = std::getenv(TestConfig::k_argumentsEnvironmentVariable);
+                if (!arguments)
+                {
+                    return;
+                }
+                
+                std::stringstream stream(arguments);
+                std::string argument;
+                while (stream >> argument)
+                {
+                    if (argument == k_headlessArgument)
+                    {
+                        out_options.m_isHeadless = true;
+                    }
+                    else if (StartsWith(argument, k_includeArgument))
+                    {
+                        out_options.m_includePatterns = SplitList(argument.substr(std::strlen(k_includeArgument)));
+                    }
+                    else if (StartsWith(argument, k_excludeArgument))
+                    {
+                        out_options.m_excludePatterns = SplitList(argument.substr(std::strlen(k_excludeArgument)));
+                    }
+                    else if (StartsWith(argument, k_shardArgument))
+                    {
+                        auto shard = argument.substr(std::strlen(k_shardArgument));
+                        auto separator = shard.find('/');
+                        if (separator == std::string::npos)
+                        {
+                            CS_LOG_WARNING("Invalid shard argument '" + argument + "', expected --shard=<index>/<count>.");
+                            continue;
+                        }
+                        
+                        out_options.m_shardIndex = CS::ParseU32(shard.substr(0, separator));
+                        out_options.m_shardCount = CS::ParseU32(shard.substr(separator + 1));
+                    }
+                    else if (StartsWith(argument, k_soakArgument))
+                    {
+                        out_options.m_soakPasses = CS::ParseU32(argument.substr(std::strlen(k_soakArgument)));
+                    }
+                    else if (StartsWith(argument, k_soakDurationArgument))
+                    {
+                        out_options.m_soakDurationSeconds = CS::ParseF32(argument.substr(std::strlen(k_soakDurationArgument)));
+                    }
+                    else if (StartsWith(argument, k_repeatArgument))
+                    {
+                        out_options.m_numRepeats = CS::ParseU32(argument.substr(std::strlen(k_repeatArgument)));
+                    }
+                    else if (StartsWith(argument, k_maxConcurrentTestsArgument))
+                    {
+                        out_options.m_maxConcurrentTests = CS::ParseU32(argument.substr(std::strlen(k_maxConcurrentTestsArgument)));
+                    }
+                    else if (StartsWith(argument, k_profileArgument))
+                    {
+                        out_options.m_profilePatterns = SplitList(argument.substr(std::strlen(k_profileArgument)));
+                    }
+                    else if (argument == k_traceArgument)
+                    {
+                        out_options.m_isTraceEnabled = true;
+                    }
+                    else if (StartsWith(argument, k_unitTestProcessesArgument))
+                    {
+                        out_options.m_numUnitTestProcesses = CS::ParseU32(argument.substr(std::strlen(k_unitTestProcessesArgument)));
+                    }
+                    else if (StartsWith(argument, k_slowSectionArgument))
+                    {
+                        out_options.m_slowSectionSeconds = CS::ParseF32(argument.substr(std::strlen(k_slowSectionArgument)));
+                    }
+                    else if (argument == k_allocatorStatsArgument)
+                    {
+                        out_options.m_isAllocatorStatsEnabled = true;
+                    }
+                    else if (StartsWith(argument, k_performanceGateArgument))
+                    {
+                        ParsePerformanceGateMode(argument.substr(std::strlen(k_performanceGateArgument)), out_options.m_performanceGateMode);
+                    }
+                    else if (StartsWith(argument, k_performanceToleranceArgument))
+                    {
+                        out_options.m_performanceTolerance = CS::ParseF32(argument.substr(std::strlen(k_performanceToleranceArgument)));
+                    }
+                    else if (argument == k_updateBaselineArgument)
+                    {
+                        out_options.m_updatePerformanceBaseline = true;
+                    }
+                    else
+                    {
+                        CS_LOG_WARNING("Unknown test argument '" + argument + "'.");
+                    }
+                }
+            }
+        }
+        
+        CS_DEFINE_NAMEDTYPE(TestConfig);
+        
+        constexpr char TestConfig::k_argumentsEnvironmentVariable[];
+        constexpr f32 TestConfig::k_defaultSlowSectionSeconds;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TestConfigUPtr TestConfig::Create() noexcept
+        {
+            return TestConfigUPtr(new TestConfig());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestConfig::IsA(CS::InterfaceIDType in_interfaceId) const noexcept
+        {
+            return (TestConfig::InterfaceID == in_interfaceId);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestConfig::IsHeadless() const noexcept
+        {
+            return m_isHeadless;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const TestFilter& TestConfig::GetFilter() const noexcept
+        {
+            return m_filter;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestConfig::IsSoakEnabled() const noexcept
+        {
+            return m_soakPasses > 1 || m_soakDurationSeconds > 0.0f;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TestConfig::GetSoakPasses() const noexcept
+        {
+            return m_soakPasses;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 TestConfig::GetSoakDurationSeconds() const noexcept
+        {
+            return m_soakDurationSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TestConfig::GetNumRepeats() const noexcept
+        {
+            return m_numRepeats;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TestConfig::GetMaxConcurrentTests() const noexcept
+        {
+            return m_maxConcurrentTests;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestConfig::IsProfiled(const std::string& in_testCaseName, const std::string& in_testName) const noexcept
+        {
+            return m_profileFilter.IsExplicitlyIncluded(in_testCaseName, in_testName);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestConfig::IsTraceEnabled() const noexcept
+        {
+            return m_isTraceEnabled;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TestConfig::GetNumUnitTestProcesses() const noexcept
+        {
+            return m_numUnitTestProcesses;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 TestConfig::GetSlowSectionSeconds() const noexcept
+        {
+            return m_slowSectionSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestConfig::IsAllocatorStatsEnabled() const noexcept
+        {
+            return m_isAllocatorStatsEnabled;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const PerformanceGate& TestConfig::GetPerformanceGate() const noexcept
+        {
+            return m_performanceGate;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TestConfig::OnInit() noexcept
+        {
+            Options options;
+            ReadAppConfig(options);
+            ReadLaunchArguments(options);
+            
+            if (options.m_shardCount == 0 || options.m_shardIndex >= options.m_shardCount)
+            {
+                CS_LOG_ERROR("Invalid test shard " + CS::ToString(options.m_shardIndex) + "/" + CS::ToString(options.m_shardCount) + ", all tests will be run.");
+                options.m_shardIndex = 0;
+                options.m_shardCount = 1;
+            }
+            
+            if (options.m_soakPasses == 0)
+            {
+                CS_LOG_ERROR("Invalid number of soak passes, at least one pass is required.");
+                options.m_soakPasses = 1;
+            }
+            
+            if (options.m_numRepeats == 0)
+            {
+                CS_LOG_ERROR("Invalid repeat count, each test must be run at least once.");
+                options.m_numRepeats = 1;
+            }
+            
+            if (options.m_maxConcurrentTests == 0)
+            {
+                CS_LOG_ERROR("Invalid maximum concurrent test count, at least one test must be run at a time.");
+                options.m_maxConcurrentTests = 1;
+            }
+            
+            if (options.m_performanceTolerance < 0.0f)
+            {
+                CS_LOG_ERROR("Invalid performance tolerance, the default will be used.");
+                options.m_performanceTolerance = PerformanceGate::k_defaultTolerance;
+            }
+            
+            auto baselineUpdate = options.m_updatePerformanceBaseline ? PerformanceGate::BaselineUpdate::k_replace : PerformanceGate::BaselineUpdate::k_addMissing;
+            if (options.m_shardCount > 1)
+            {
+                if (options.m_updatePerformanceBaseline)
+                {
+                    CS_LOG_WARNING("The performance baseline cannot be updated from a sharded run, it will be left unchanged.");
+                }
+                baselineUpdate = PerformanceGate::BaselineUpdate::k_none;
+            }
+            
+            if (options.m_numUnitTestProcesses == 0)
+            {
+                options.m_numUnitTestProcesses = std::max(1u, std::thread::hardware_concurrency());
+            }
+            
+            m_isHeadless = options.m_isHeadless;
+            m_filter = TestFilter(options.m_includePatterns, options.m_excludePatterns, options.m_shardIndex, options.m_shardCount);
+            m_soakPasses = options.m_soakPasses;
+            m_soakDurationSeconds = options.m_soakDurationSeconds;
+            m_numRepeats = options.m_numRepeats;
+            m_maxConcurrentTests = options.m_maxConcurrentTests;
+            m_profileFilter = TestFilter(options.m_profilePatterns, std::vector<std::string>());
+            m_isTraceEnabled = options.m_isTraceEnabled;
+            m_numUnitTestProcesses = options.m_numUnitTestProcesses;
+            m_slowSectionSeconds = options.m_slowSectionSeconds;
+            m_isAllocatorStatsEnabled = options.m_isAllocatorStatsEnabled;
+            m_performanceGate = PerformanceGate(options.m_performanceGateMode, options.m_performanceTolerance, PerformanceGate::k_defaultMinSeconds, baselineUpdate);
+            
+            if (IsSoakEnabled() && !m_isHeadless)
+            {
+                CS_LOG_WARNING("Soak runs are only supported in headless mode, the tests will be run once.");
+            }
+            
+            if (!m_filter.IsEmpty())
+            {
+                CS_LOG_VERBOSE("Running filtered tests: " + CS::ToString(u32(options.m_includePatterns.size())) + " include pattern(s), " + CS::ToString(u32(options.m_excludePatterns.size())) +
+                               " exclude pattern(s), shard " + CS::ToString(options.m_shardIndex) + "/" + CS::ToString(options.m_shardCount) + ".");
+            }
+        }
+    }
+}
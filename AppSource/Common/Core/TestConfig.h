@@ -0,0 +1,206 @@
+//
+//  TestConfig.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_CORE_TESTCONFIG_H_
+#define _COMMON_CORE_TESTCONFIG_H_
+
+#include <CSTest.h>
+
+#include <Common/Core/TestFilter.h>
+#include <Common/Performance/PerformanceGate.h>
+
+#include <ChilliSource/Core/System.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An app system which provides the options describing how tests should be
+        /// run. Options are read from the "Tests" section of App.config, for example:
+        ///
+        ///     "Tests": {
+        ///         "Headless": false,
+        ///         "Include": [ "TaskScheduler", "ForwardRenderPassCompiler/*" ],
+        ///         "Exclude": [ "*/Slow*" ],
+        ///         "ShardIndex": 0,
+        ///         "ShardCount": 4,
+        ///         "SoakPasses": 1,
+        ///         "SoakDurationSeconds": 0,
+        ///         "Repeat": 1,
+        ///         "MaxConcurrentTests": 4,
+        ///         "Profile": [ "ForwardRenderPassCompiler/*", "Particles" ],
+        ///         "Trace": false,
+        ///         "UnitTestProcesses": 1,
+        ///         "SlowSectionSeconds": 0.1,
+        ///         "AllocatorStats": false,
+        ///         "PerformanceGate": "Warn",
+        ///         "PerformanceTolerance": 0.3,
+        ///         "UpdatePerformanceBaseline": false
+        ///     }
+        ///
+        /// These can then be overridden at launch using the CSTEST_ARGS environment
+        /// variable, which contains a space separated list of arguments in the form
+        /// "--headless --include=<patterns> --exclude=<patterns> --shard=<index>/<count>
+        /// --soak=<passes> --soak-duration=<seconds> --repeat=<count>
+        /// --max-concurrent-tests=<count> --profile=<patterns> --trace
+        /// --unit-test-processes=<count>
+        /// --slow-section=<seconds> --allocator-stats --performance-gate=<mode>
+        /// --performance-tolerance=<fraction> --update-baseline", where each list of
+        /// patterns is comma separated, the shard index is zero based and the
+        /// performance gate mode is one of "disabled", "warn" or "fail". Sharded runs
+        /// never update the performance baseline.
+        ///
+        /// This is not thread-safe and should only be accessed from the main thread.
+        //------------------------------------------------------------------------------
+        class TestConfig final : public CS::AppSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(TestConfig);
+            
+            static constexpr char k_argumentsEnvironmentVariable[] = "CSTEST_ARGS";
+            static constexpr f32 k_defaultSlowSectionSeconds = 0.1f;
+            //------------------------------------------------------------------------------
+            /// Allows querying of whether or not this system implements the interface
+            /// described by the given interface Id.
+            ///
+            /// @param in_interfaceId - The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //------------------------------------------------------------------------------
+            bool IsA(CS::InterfaceIDType in_interfaceId) const noexcept override;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not the app should run all tests without UI and then
+            /// exit, rather than presenting the main menu.
+            //------------------------------------------------------------------------------
+            bool IsHeadless() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The filter describing which tests should be run.
+            //------------------------------------------------------------------------------
+            const TestFilter& GetFilter() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not the integration tests should be soaked; run
+            /// repeatedly while memory usage and timings are tracked. This is only
+            /// supported in headless mode.
+            //------------------------------------------------------------------------------
+            bool IsSoakEnabled() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The minimum number of times the integration tests should be run
+            /// when soaking.
+            //------------------------------------------------------------------------------
+            u32 GetSoakPasses() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The minimum amount of time the integration tests should be run
+            /// for when soaking. Passes will continue to be started until both this and
+            /// the number of passes have been reached.
+            //------------------------------------------------------------------------------
+            f32 GetSoakDurationSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of times each selected integration test should be run
+            /// within a single pass, so that noisy and flaky tests can be identified.
+            //------------------------------------------------------------------------------
+            u32 GetNumRepeats() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The maximum number of integration tests which can be run at the
+            /// same time. Tests which are marked as serial are always run alone.
+            //------------------------------------------------------------------------------
+            u32 GetMaxConcurrentTests() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Whether or not the given test, benchmark or smoke test state should be run
+            /// under the sampling profiler. These are selected using the "Profile"
+            /// patterns, which are in the same form as the test filter patterns; smoke
+            /// test states are matched by their title. Nothing is profiled by default.
+            ///
+            /// @param in_testCaseName - The name of the test case, or the title of the
+            /// smoke test state.
+            /// @param in_testName - [Optional] The name of the test, if any.
+            ///
+            /// @return Whether or not it should be profiled.
+            //------------------------------------------------------------------------------
+            bool IsProfiled(const std::string& in_testCaseName, const std::string& in_testName = "") const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not a timeline of the tests, tasks and frames should be
+            /// recorded and exported in the chrome://tracing format.
+            //------------------------------------------------------------------------------
+            bool IsTraceEnabled() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of processes the unit test cases should be partitioned
+            /// across. A process count of zero in the options selects one process per
+            /// hardware thread.
+            //------------------------------------------------------------------------------
+            u32 GetNumUnitTestProcesses() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The total duration above which a unit test section is reported as
+            /// slow.
+            //------------------------------------------------------------------------------
+            f32 GetSlowSectionSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not the usage of the frame allocators should be tracked
+            /// and exported.
+            //------------------------------------------------------------------------------
+            bool IsAllocatorStatsEnabled() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The gate which test reports should be evaluated against, built from
+            /// the performance gate mode, tolerance and baseline update options.
+            //------------------------------------------------------------------------------
+            const PerformanceGate& GetPerformanceGate() const noexcept;
+            
+        private:
+            friend class CS::Application;
+            //------------------------------------------------------------------------------
+            /// A factory method for creating new instances of the system.
+            ///
+            /// @return The new instance.
+            //------------------------------------------------------------------------------
+            static TestConfigUPtr Create() noexcept;
+            //------------------------------------------------------------------------------
+            /// Default constructor. Declared private to ensure the system is created
+            /// through Application::CreateSystem<>().
+            //------------------------------------------------------------------------------
+            TestConfig() = default;
+            //------------------------------------------------------------------------------
+            /// Reads the options from App.config and the launch arguments.
+            //------------------------------------------------------------------------------
+            void OnInit() noexcept override;
+            
+            bool m_isHeadless = false;
+            TestFilter m_filter;
+            u32 m_soakPasses = 1;
+            f32 m_soakDurationSeconds = 0.0f;
+            u32 m_numRepeats = 1;
+            u32 m_maxConcurrentTests = 4;
+            TestFilter m_profileFilter;
+            bool m_isTraceEnabled = false;
+            u32 m_numUnitTestProcesses = 1;
+            f32 m_slowSectionSeconds = k_defaultSlowSectionSeconds;
+            bool m_isAllocatorStatsEnabled = false;
+            PerformanceGate m_performanceGate;
+        };
+    }
+}
+
+#endif
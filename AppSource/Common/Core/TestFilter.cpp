@@ -0,0 +1,180 @@
+//
+//  TestFilter.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Core/TestFilter.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// @param in_string - The string to test.
+            /// @param in_pattern - The pattern, which may contain the '*' and '?'
+            /// wildcards.
+            ///
+            /// @return Whether or not the whole of the string matches the pattern.
+            //------------------------------------------------------------------------------
+            bool IsWildcardMatch(const std::string& in_string, const std::string& in_pattern) noexcept
+            {
+                std::size_t stringIndex = 0;
+                std::size_t patternIndex = 0;
+                std::size_t starIndex = std::string::npos;
+                std::size_t starMatchIndex = 0;
+                
+                while (stringIndex < in_string.size())
+                {
+                    if (patternIndex < in_pattern.size() && (in_pattern[patternIndex] == '?' || in_pattern[patternIndex] == in_string[stringIndex]))
+                    {
+                        ++stringIndex;
+                        ++patternIndex;
+                    }
+                    else if (patternIndex < in_pattern.size() && in_pattern[patternIndex] == '*')
+                    {
+                        starIndex = patternIndex++;
+                        starMatchIndex = stringIndex;
+                    }
+                    else if (starIndex != std::string::npos)
+                    {
+                        patternIndex = starIndex + 1;
+                        stringIndex = ++starMatchIndex;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }
+                
+                while (patternIndex < in_pattern.size() && in_pattern[patternIndex] == '*')
+                {
+                    ++patternIndex;
+                }
+                
+                return patternIndex == in_pattern.size();
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_testCaseName - The name of the test case.
+            /// @param in_testName - The name of the test.
+            /// @param in_pattern - The "TestCase" or "TestCase/Test" pattern.
+            ///
+            /// @return Whether or not the test matches the pattern.
+            //------------------------------------------------------------------------------
+            bool IsPatternMatch(const std::string& in_testCaseName, const std::string& in_testName, const std::string& in_pattern) noexcept
+            {
+                auto separator = in_pattern.find('/');
+                if (separator == std::string::npos)
+                {
+                    return IsWildcardMatch(in_testCaseName, in_pattern);
+                }
+                
+                return IsWildcardMatch(in_testCaseName, in_pattern.substr(0, separator)) && IsWildcardMatch(in_testName, in_pattern.substr(separator + 1));
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_testCaseName - The name of the test case.
+            /// @param in_testName - The name of the test.
+            /// @param in_patterns - The list of patterns.
+            ///
+            /// @return Whether or not the test matches any of the patterns.
+            //------------------------------------------------------------------------------
+            bool IsAnyPatternMatch(const std::string& in_testCaseName, const std::string& in_testName, const std::vector<std::string>& in_patterns) noexcept
+            {
+                for (const auto& pattern : in_patterns)
+                {
+                    if (IsPatternMatch(in_testCaseName, in_testName, pattern))
+                    {
+                        return true;
+                    }
+                }
+                
+                return false;
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TestFilter::TestFilter(const std::vector<std::string>& in_includePatterns, const std::vector<std::string>& in_excludePatterns, u32 in_shardIndex, u32 in_shardCount) noexcept
+            : m_includePatterns(in_includePatterns), m_excludePatterns(in_excludePatterns), m_shardIndex(in_shardIndex), m_shardCount(in_shardCount)
+        {
+            CS_ASSERT(m_shardCount > 0, "There must be at least one shard.");
+            CS_ASSERT(m_shardIndex < m_shardCount, "The shard index must be less than the shard count.");
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<std::string>& TestFilter::GetIncludePatterns() const noexcept
+        {
+            return m_includePatterns;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<std::string>& TestFilter::GetExcludePatterns() const noexcept
+        {
+            return m_excludePatterns;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TestFilter::GetShardIndex() const noexcept
+        {
+            return m_shardIndex;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TestFilter::GetShardCount() const noexcept
+        {
+            return m_shardCount;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestFilter::IsEmpty() const noexcept
+        {
+            return m_includePatterns.empty() && m_excludePatterns.empty() && m_shardCount == 1;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestFilter::IsExplicitlyIncluded(const std::string& in_testCaseName, const std::string& in_testName) const noexcept
+        {
+            return IsAnyPatternMatch(in_testCaseName, in_testName, m_includePatterns);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestFilter::IsMatch(const std::string& in_testCaseName, const std::string& in_testName) const noexcept
+        {
+            if (!m_includePatterns.empty() && !IsAnyPatternMatch(in_testCaseName, in_testName, m_includePatterns))
+            {
+                return false;
+            }
+            
+            return !IsAnyPatternMatch(in_testCaseName, in_testName, m_excludePatterns);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestFilter::IsInShard(u32 in_matchIndex) const noexcept
+        {
+            return (in_matchIndex % m_shardCount) == m_shardIndex;
+        }
+    }
+}
@@ -0,0 +1,127 @@
+//
+//  TestFilter.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_CORE_TESTFILTER_H_
+#define _COMMON_CORE_TESTFILTER_H_
+
+#include <CSTest.h>
+
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Describes which tests should be run. Tests are selected using include and
+        /// exclude patterns, and the selected tests can then be split across a number
+        /// of shards so that several processes can each run a part of the suite.
+        ///
+        /// A pattern is in the form "TestCase" or "TestCase/Test", where each part can
+        /// contain the '*' and '?' wildcards. A pattern without a test part matches
+        /// all tests in the test case. If there are no include patterns then every
+        /// test is included.
+        ///
+        /// Shards are assigned round-robin over the tests which match the patterns, so
+        /// the given index must be the position of the test within those which match.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class TestFilter final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// Constructs a filter which selects all tests.
+            //------------------------------------------------------------------------------
+            TestFilter() = default;
+            //------------------------------------------------------------------------------
+            /// @param in_includePatterns - The patterns for tests which should be run. If
+            /// empty all tests are included.
+            /// @param in_excludePatterns - The patterns for tests which should not be run.
+            /// These take precedence over the include patterns.
+            /// @param in_shardIndex - [Optional] The index of the shard which should be
+            /// run. Must be less than the shard count.
+            /// @param in_shardCount - [Optional] The number of shards the tests are split
+            /// into.
+            //------------------------------------------------------------------------------
+            TestFilter(const std::vector<std::string>& in_includePatterns, const std::vector<std::string>& in_excludePatterns, u32 in_shardIndex = 0, u32 in_shardCount = 1) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The patterns for tests which should be run.
+            //------------------------------------------------------------------------------
+            const std::vector<std::string>& GetIncludePatterns() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The patterns for tests which should not be run.
+            //------------------------------------------------------------------------------
+            const std::vector<std::string>& GetExcludePatterns() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The index of the shard which should be run.
+            //------------------------------------------------------------------------------
+            u32 GetShardIndex() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of shards the tests are split into.
+            //------------------------------------------------------------------------------
+            u32 GetShardCount() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not every test will be selected by this filter.
+            //------------------------------------------------------------------------------
+            bool IsEmpty() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_testCaseName - The name of the test case.
+            /// @param in_testName - [Optional] The name of the test. Tests without
+            /// individual names, such as unit test cases, should leave this empty.
+            ///
+            /// @return Whether or not the given test is explicitly named by one of the
+            /// include patterns.
+            //------------------------------------------------------------------------------
+            bool IsExplicitlyIncluded(const std::string& in_testCaseName, const std::string& in_testName = "") const noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_testCaseName - The name of the test case.
+            /// @param in_testName - [Optional] The name of the test. Tests without
+            /// individual names, such as unit test cases, should leave this empty.
+            ///
+            /// @return Whether or not the given test matches the include and exclude
+            /// patterns. Shards are not considered.
+            //------------------------------------------------------------------------------
+            bool IsMatch(const std::string& in_testCaseName, const std::string& in_testName = "") const noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_matchIndex - The index of the test within all tests which match
+            /// the patterns.
+            ///
+            /// @return Whether or not the test belongs to the shard which should be run.
+            //------------------------------------------------------------------------------
+            bool IsInShard(u32 in_matchIndex) const noexcept;
+            
+        private:
+            std::vector<std::string> m_includePatterns;
+            std::vector<std::string> m_excludePatterns;
+            u32 m_shardIndex = 0;
+            u32 m_shardCount = 1;
+        };
+    }
+}
+
+#endif
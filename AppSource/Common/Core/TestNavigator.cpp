@@ -27,6 +27,8 @@
 //
 
 #include <Common/Core/TestNavigator.h>
+#include <Common/Core/TestConfig.h>
+#include <Common/Report/ReportExporter.h>
 #include <Common/UI/BasicWidgetFactory.h>
 
 #include <ChilliSource/Core/Base.h>
@@ -101,11 +103,24 @@ namespace CSTest
             {
                 CS::Application::Get()->GetStateManager()->Pop();
             });
+            
+            auto testConfig = CS::Application::Get()->GetSystem<TestConfig>();
+            if (testConfig && testConfig->IsProfiled(m_title))
+            {
+                m_profiler = SamplingProfilerUPtr(new SamplingProfiler(m_title));
+            }
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         void TestNavigator::OnDestroy() noexcept
         {
+            if (m_profiler)
+            {
+                m_profiler->Stop();
+                ReportExporter().Export(*m_profiler);
+                m_profiler.reset();
+            }
+            
             m_backPressedConnection.reset();
             m_backButton.reset();
             
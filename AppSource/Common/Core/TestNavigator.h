@@ -30,6 +30,8 @@
 #define _COMMON_CORE_TESTNAVIGATOR_H_
 
 #include <CSTest.h>
+#include <Common/Performance/SamplingProfiler.h>
+
 #include <ChilliSource/Core/System.h>
 
 namespace CSTest
@@ -40,6 +42,10 @@ namespace CSTest
         /// A system which provides navigation back to the previous test menu. It also
         /// provides the test with title text.
         ///
+        /// If the title is selected by the "Profile" test config patterns, the state
+        /// is run under the sampling profiler from initialisation until it is
+        /// destroyed, at which point the profile is exported.
+        ///
         /// @author Ian Copland
         //------------------------------------------------------------------------------
        class TestNavigator final : public CS::StateSystem
@@ -116,6 +122,8 @@ namespace CSTest
             CS::WidgetSPtr m_backButton;
             
             CS::EventConnectionUPtr m_backPressedConnection;
+            
+            SamplingProfilerUPtr m_profiler;
         };
     }
 }
@@ -0,0 +1,241 @@
+//
+//  TimerService.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Core/TimerService.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// Orders heap entries such that the earliest fire time is at the top of the
+            /// heap. Ties are broken by the order in which the timers were scheduled.
+            ///
+            /// @param in_a - The first entry.
+            /// @param in_b - The second entry.
+            ///
+            /// @return Whether or not the first entry should fire after the second.
+            //------------------------------------------------------------------------------
+            template <typename TEntry> bool FiresAfter(const TEntry& in_a, const TEntry& in_b) noexcept
+            {
+                return in_a.m_fireTime > in_b.m_fireTime || (in_a.m_fireTime == in_b.m_fireTime && in_a.m_sequence > in_b.m_sequence);
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        /// The shared state of a single timer, owned by both its handle and the heap.
+        //------------------------------------------------------------------------------
+        struct TimerService::Timer final
+        {
+            Delegate m_delegate;
+            f64 m_periodSeconds = 0.0;
+            std::atomic<bool> m_pending;
+        };
+        
+        CS_DEFINE_NAMEDTYPE(TimerService);
+        
+        constexpr std::size_t TimerService::k_minCompactionSize;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TimerService::Handle::Handle(const std::shared_ptr<Timer>& in_timer) noexcept
+            : m_timer(in_timer)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TimerService::Handle::Handle(Handle&& in_other) noexcept
+            : m_timer(std::move(in_other.m_timer))
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TimerService::Handle& TimerService::Handle::operator=(Handle&& in_other) noexcept
+        {
+            if (this != &in_other)
+            {
+                Cancel();
+                m_timer = std::move(in_other.m_timer);
+            }
+            
+            return *this;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TimerService::Handle::Cancel() noexcept
+        {
+            if (m_timer)
+            {
+                m_timer->m_pending = false;
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TimerService::Handle::IsPending() const noexcept
+        {
+            return m_timer && m_timer->m_pending;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TimerService::Handle::~Handle() noexcept
+        {
+            Cancel();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TimerServiceUPtr TimerService::Create() noexcept
+        {
+            return TimerServiceUPtr(new TimerService());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TimerService::IsA(CS::InterfaceIDType in_interfaceId) const noexcept
+        {
+            return (TimerService::InterfaceID == in_interfaceId);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TimerService::Handle TimerService::ScheduleOnce(f32 in_delaySeconds, const Delegate& in_delegate) noexcept
+        {
+            CS_ASSERT(CS::Application::Get()->GetTaskScheduler()->IsMainThread(), "Timers must be scheduled on the main thread.");
+            CS_ASSERT(in_delaySeconds >= 0.0f, "The timer delay cannot be negative.");
+            CS_ASSERT(in_delegate, "A valid delegate must be supplied.");
+            
+            auto timer = std::make_shared<Timer>();
+            timer->m_delegate = in_delegate;
+            timer->m_pending = true;
+            
+            Push(m_currentTime + f64(in_delaySeconds), timer);
+            
+            return Handle(timer);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TimerService::Handle TimerService::ScheduleRepeating(f32 in_periodSeconds, const Delegate& in_delegate) noexcept
+        {
+            CS_ASSERT(CS::Application::Get()->GetTaskScheduler()->IsMainThread(), "Timers must be scheduled on the main thread.");
+            CS_ASSERT(in_periodSeconds > 0.0f, "The timer period must be greater than zero.");
+            CS_ASSERT(in_delegate, "A valid delegate must be supplied.");
+            
+            auto timer = std::make_shared<Timer>();
+            timer->m_delegate = in_delegate;
+            timer->m_periodSeconds = f64(in_periodSeconds);
+            timer->m_pending = true;
+            
+            Push(m_currentTime + timer->m_periodSeconds, timer);
+            
+            return Handle(timer);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TimerService::GetNumScheduledTimers() const noexcept
+        {
+            return u32(m_heap.size());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TimerService::Push(f64 in_fireTime, const std::shared_ptr<Timer>& in_timer) noexcept
+        {
+            // Cancelled timers remain in the heap until they would have fired. Compacting whenever the heap doubles in
+            // size bounds the number of dead entries while keeping the cost amortised O(1) per timer.
+            if (m_heap.size() >= m_compactionSize)
+            {
+                Compact();
+                m_compactionSize = std::max(k_minCompactionSize, m_heap.size() * 2);
+            }
+            
+            m_heap.push_back(HeapEntry { in_fireTime, m_nextSequence++, in_timer });
+            std::push_heap(m_heap.begin(), m_heap.end(), FiresAfter<HeapEntry>);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TimerService::Compact() noexcept
+        {
+            m_heap.erase(std::remove_if(m_heap.begin(), m_heap.end(), [](const HeapEntry& in_entry) { return !in_entry.m_timer->m_pending; }), m_heap.end());
+            std::make_heap(m_heap.begin(), m_heap.end(), FiresAfter<HeapEntry>);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TimerService::OnUpdate(f32 in_deltaTime) noexcept
+        {
+            m_currentTime += f64(in_deltaTime);
+            
+            while (!m_heap.empty() && m_heap.front().m_fireTime <= m_currentTime)
+            {
+                std::pop_heap(m_heap.begin(), m_heap.end(), FiresAfter<HeapEntry>);
+                auto entry = std::move(m_heap.back());
+                m_heap.pop_back();
+                
+                auto& timer = entry.m_timer;
+                if (!timer->m_pending)
+                {
+                    continue;
+                }
+                
+                if (timer->m_periodSeconds == 0.0)
+                {
+                    timer->m_pending = false;
+                }
+                
+                // The delegate may cancel this timer or schedule new ones, so the heap must not be referenced across the call.
+                timer->m_delegate();
+                
+                if (timer->m_periodSeconds > 0.0 && timer->m_pending)
+                {
+                    // Repeating timers are scheduled relative to when they should have fired, rather than the current time,
+                    // to avoid drift. If more than a whole period has been missed the timer only fires once.
+                    auto nextFireTime = entry.m_fireTime + timer->m_periodSeconds;
+                    if (nextFireTime <= m_currentTime)
+                    {
+                        nextFireTime = m_currentTime + timer->m_periodSeconds;
+                    }
+                    
+                    Push(nextFireTime, timer);
+                }
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TimerService::OnDestroy() noexcept
+        {
+            for (auto& entry : m_heap)
+            {
+                entry.m_timer->m_pending = false;
+            }
+            
+            m_heap.clear();
+        }
+    }
+}
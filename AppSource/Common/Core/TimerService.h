@@ -0,0 +1,214 @@
+//
+//  TimerService.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_CORE_TIMERSERVICE_H_
+#define _COMMON_CORE_TIMERSERVICE_H_
+
+#include <CSTest.h>
+
+#include <ChilliSource/Core/System.h>
+
+#include <functional>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An app system which provides one-shot and repeating timers. It replaces the
+        /// need for each object which requires a timeout or periodic callback to own
+        /// its own CS::Timer.
+        ///
+        /// Pending timers are stored in a min-heap ordered by fire time, so each update
+        /// only needs to inspect the earliest timer: an update in which no timers fire
+        /// is O(1), and each timer which fires costs O(log n). Cancelling a timer only
+        /// marks it as cancelled; it is discarded when it reaches the top of the heap,
+        /// or when the heap is compacted.
+        ///
+        /// Timers are scheduled and fired on the main thread. Handles can be cancelled
+        /// from any thread.
+        //------------------------------------------------------------------------------
+        class TimerService final : public CS::AppSystem
+        {
+            struct Timer;
+            
+        public:
+            CS_DECLARE_NAMEDTYPE(TimerService);
+            //------------------------------------------------------------------------------
+            /// A delegate which is called when a timer fires. This is always called on
+            /// the main thread.
+            //------------------------------------------------------------------------------
+            using Delegate = std::function<void() noexcept>;
+            //------------------------------------------------------------------------------
+            /// A handle to a scheduled timer. The timer is cancelled when the handle is
+            /// destroyed, so the handle must be kept for as long as the timer is needed.
+            ///
+            /// Cancelling is thread-safe, but a handle should not be moved or destroyed
+            /// while it is being cancelled on another thread.
+            //------------------------------------------------------------------------------
+            class Handle final
+            {
+            public:
+                CS_DECLARE_NOCOPY(Handle);
+                //------------------------------------------------------------------------------
+                /// Constructs a handle which does not refer to a timer.
+                //------------------------------------------------------------------------------
+                Handle() = default;
+                //------------------------------------------------------------------------------
+                /// @param in_other - The handle to move from.
+                //------------------------------------------------------------------------------
+                Handle(Handle&& in_other) noexcept;
+                //------------------------------------------------------------------------------
+                /// Cancels any timer currently referred to by this handle, then takes
+                /// ownership of the timer referred to by the other.
+                ///
+                /// @param in_other - The handle to move from.
+                ///
+                /// @return This handle.
+                //------------------------------------------------------------------------------
+                Handle& operator=(Handle&& in_other) noexcept;
+                //------------------------------------------------------------------------------
+                /// Prevents the timer from firing again. If the timer is currently firing the
+                /// delegate will complete, but a repeating timer will not be rescheduled.
+                /// Does nothing if the handle does not refer to a timer.
+                //------------------------------------------------------------------------------
+                void Cancel() noexcept;
+                //------------------------------------------------------------------------------
+                /// @return Whether or not the handle refers to a timer which has neither been
+                /// cancelled nor, if it is a one-shot timer, fired.
+                //------------------------------------------------------------------------------
+                bool IsPending() const noexcept;
+                //------------------------------------------------------------------------------
+                /// Cancels the timer.
+                //------------------------------------------------------------------------------
+                ~Handle() noexcept;
+                
+            private:
+                friend class TimerService;
+                //------------------------------------------------------------------------------
+                /// @param in_timer - The timer the handle refers to.
+                //------------------------------------------------------------------------------
+                Handle(const std::shared_ptr<Timer>& in_timer) noexcept;
+                
+                std::shared_ptr<Timer> m_timer;
+            };
+            //------------------------------------------------------------------------------
+            /// Allows querying of whether or not this system implements the interface
+            /// described by the given interface Id.
+            ///
+            /// @param in_interfaceId - The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //------------------------------------------------------------------------------
+            bool IsA(CS::InterfaceIDType in_interfaceId) const noexcept override;
+            //------------------------------------------------------------------------------
+            /// Schedules a delegate to be called once after the given delay. This must be
+            /// called on the main thread.
+            ///
+            /// @param in_delaySeconds - The delay before the delegate is called.
+            /// @param in_delegate - The delegate.
+            ///
+            /// @return The handle to the timer.
+            //------------------------------------------------------------------------------
+            Handle ScheduleOnce(f32 in_delaySeconds, const Delegate& in_delegate) noexcept;
+            //------------------------------------------------------------------------------
+            /// Schedules a delegate to be called repeatedly with the given period, until
+            /// the timer is cancelled. This must be called on the main thread.
+            ///
+            /// @param in_periodSeconds - The period of the timer. Must be greater than
+            /// zero.
+            /// @param in_delegate - The delegate.
+            ///
+            /// @return The handle to the timer.
+            //------------------------------------------------------------------------------
+            Handle ScheduleRepeating(f32 in_periodSeconds, const Delegate& in_delegate) noexcept;
+            //------------------------------------------------------------------------------
+            /// This must be called on the main thread.
+            ///
+            /// @return The number of timers in the heap, including any which have been
+            /// cancelled but not yet discarded.
+            //------------------------------------------------------------------------------
+            u32 GetNumScheduledTimers() const noexcept;
+            
+        private:
+            friend class CS::Application;
+            
+            static constexpr std::size_t k_minCompactionSize = 64;
+            //------------------------------------------------------------------------------
+            /// An entry in the timer heap. The sequence number ensures timers with the same
+            /// fire time are fired in the order they were scheduled.
+            //------------------------------------------------------------------------------
+            struct HeapEntry final
+            {
+                f64 m_fireTime;
+                u64 m_sequence;
+                std::shared_ptr<Timer> m_timer;
+            };
+            //------------------------------------------------------------------------------
+            /// A factory method for creating new instances of the system.
+            ///
+            /// @return The new instance.
+            //------------------------------------------------------------------------------
+            static TimerServiceUPtr Create() noexcept;
+            //------------------------------------------------------------------------------
+            /// Default constructor. Declared private to ensure the system is created
+            /// through Application::CreateSystem<>().
+            //------------------------------------------------------------------------------
+            TimerService() = default;
+            //------------------------------------------------------------------------------
+            /// Adds a timer to the heap, compacting the heap first if enough entries have
+            /// been added since it was last compacted.
+            ///
+            /// @param in_fireTime - The time at which the timer should fire.
+            /// @param in_timer - The timer.
+            //------------------------------------------------------------------------------
+            void Push(f64 in_fireTime, const std::shared_ptr<Timer>& in_timer) noexcept;
+            //------------------------------------------------------------------------------
+            /// Removes all cancelled timers from the heap.
+            //------------------------------------------------------------------------------
+            void Compact() noexcept;
+            //------------------------------------------------------------------------------
+            /// Fires all timers which are due.
+            ///
+            /// @param in_deltaTime - The time since the last update.
+            //------------------------------------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Cancels all remaining timers.
+            //------------------------------------------------------------------------------
+            void OnDestroy() noexcept override;
+            
+            f64 m_currentTime = 0.0;
+            u64 m_nextSequence = 0;
+            std::vector<HeapEntry> m_heap;
+            std::size_t m_compactionSize = k_minCompactionSize;
+        };
+    }
+}
+
+#endif
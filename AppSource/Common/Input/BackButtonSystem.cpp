@@ -44,6 +44,12 @@ namespace CSTest
             return (BackButtonSystem::InterfaceID == interfaceId);
         }
 
+        //-----------------------------------------------------
+        void BackButtonSystem::SetEnabled(bool isEnabled) noexcept
+        {
+            m_isEnabled = isEnabled;
+        }
+
         //-----------------------------------------------------
         void BackButtonSystem::OnResume() noexcept
         {
@@ -63,7 +69,7 @@ namespace CSTest
         //-----------------------------------------------------
         void BackButtonSystem::OnDeviceButtonPressed(const CS::DeviceButtonSystem::DeviceButton& buttonPressed) noexcept
         {
-            if (buttonPressed == CS::DeviceButtonSystem::DeviceButton::k_backButton)
+            if (m_isEnabled && buttonPressed == CS::DeviceButtonSystem::DeviceButton::k_backButton)
             {
                 auto stateManager = CS::Application::Get()->GetStateManager();
                 CS_ASSERT(stateManager, "No state manager active.");
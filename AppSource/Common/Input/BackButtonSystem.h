@@ -54,6 +54,14 @@ namespace CSTest
             ///
             bool IsA(CS::InterfaceIDType interfaceId) const noexcept override;
 
+            /// Sets whether or not back button presses are acted on. This allows states
+            /// to prevent navigation while they have work in progress. Defaults to true.
+            ///
+            /// @param isEnabled
+            ///     Whether or not back button presses are acted on.
+            ///
+            void SetEnabled(bool isEnabled) noexcept;
+
         private:
             friend class CS::State;
 
@@ -84,6 +92,7 @@ namespace CSTest
             void OnDeviceButtonPressed(const CS::DeviceButtonSystem::DeviceButton& buttonPressed) noexcept;
 
             CS::EventConnectionUPtr m_deviceButtonConnection;
+            bool m_isEnabled = true;
         };
     }
 }
@@ -0,0 +1,102 @@
+//
+//  AlignedAllocator.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Memory/AlignedAllocator.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <cstdint>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        constexpr std::size_t AlignedAllocator::k_maxAlignment;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AlignedAllocator::AlignedAllocator(CS::IAllocator& in_allocator, std::size_t in_alignment) noexcept
+            : m_allocator(in_allocator), m_alignment(in_alignment)
+        {
+            CS_ASSERT(in_alignment > 0 && (in_alignment & (in_alignment - 1)) == 0, "Alignment must be a power of two.");
+            CS_ASSERT(in_alignment <= k_maxAlignment, "Alignment is too large.");
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::size_t AlignedAllocator::GetAlignment() const noexcept
+        {
+            return m_alignment;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::size_t AlignedAllocator::GetMaxAllocationSize() const noexcept
+        {
+            auto maxAllocationSize = m_allocator.GetMaxAllocationSize();
+            return (maxAllocationSize > m_alignment) ? maxAllocationSize - m_alignment : 0;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void* AlignedAllocator::Allocate(std::size_t in_allocationSize) noexcept
+        {
+            CS_ASSERT(in_allocationSize <= GetMaxAllocationSize(), "Allocation is too large for the aligned allocator.");
+            
+            return AllocateAligned(m_allocator, in_allocationSize, m_alignment);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AlignedAllocator::Deallocate(void* in_pointer) noexcept
+        {
+            DeallocateAligned(m_allocator, in_pointer, m_alignment);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void* AlignedAllocator::AllocateAligned(CS::IAllocator& in_allocator, std::size_t in_allocationSize, std::size_t in_alignment) noexcept
+        {
+            CS_ASSERT(in_alignment > 0 && (in_alignment & (in_alignment - 1)) == 0, "Alignment must be a power of two.");
+            CS_ASSERT(in_alignment <= k_maxAlignment, "Alignment is too large.");
+            CS_ASSERT(in_allocationSize + in_alignment <= in_allocator.GetMaxAllocationSize(), "Allocation is too large for the allocator once aligned.");
+            
+            // At least one byte is always skipped, so there is room to store the offset before the aligned address.
+            auto rawAddress = reinterpret_cast<std::uintptr_t>(in_allocator.Allocate(in_allocationSize + in_alignment));
+            auto alignedAddress = (rawAddress + in_alignment) & ~std::uintptr_t(in_alignment - 1);
+            
+            auto aligned = reinterpret_cast<u8*>(alignedAddress);
+            aligned[-1] = u8(alignedAddress - rawAddress - 1);
+            
+            return aligned;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AlignedAllocator::DeallocateAligned(CS::IAllocator& in_allocator, void* in_pointer, std::size_t in_alignment) noexcept
+        {
+            auto aligned = static_cast<u8*>(in_pointer);
+            CS_ASSERT((reinterpret_cast<std::uintptr_t>(aligned) & (in_alignment - 1)) == 0, "Pointer was not allocated with this alignment.");
+            
+            in_allocator.Deallocate(aligned - aligned[-1] - 1);
+        }
+    }
+}
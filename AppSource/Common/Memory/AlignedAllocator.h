@@ -0,0 +1,124 @@
+//
+//  AlignedAllocator.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_ALIGNEDALLOCATOR_H_
+#define _COMMON_MEMORY_ALIGNEDALLOCATOR_H_
+
+#include <CSTest.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An allocator which returns memory from another allocator with a greater
+        /// alignment than it would otherwise provide. This allows types with an
+        /// alignment requirement above the default, such as SIMD vector types or
+        /// structures isolated to their own cache line, to be allocated from a linear
+        /// or paged linear allocator using CS::MakeUnique(), CS::MakeShared() or
+        /// CS::MakeUniqueArray(). For example, to allocate from a frame allocator:
+        ///
+        ///     Common::AlignedAllocator allocator(frameAllocatorSystem->GetAllocator(), alignof(Matrix4));
+        ///     auto matrices = CS::MakeUniqueArray<Matrix4>(allocator, numMatrices);
+        ///
+        /// Each allocation is over-allocated by the alignment, and the offset to the
+        /// aligned address is stored in the byte before it so the original allocation
+        /// can be found when it is deallocated. Allocations therefore cost up to the
+        /// alignment in additional bytes, and can't exceed the max allocation size of
+        /// the wrapped allocator less the alignment.
+        ///
+        /// This is thread-safe provided the wrapped allocator is.
+        //------------------------------------------------------------------------------
+        class AlignedAllocator final : public CS::IAllocator
+        {
+        public:
+            CS_DECLARE_NOCOPY(AlignedAllocator);
+            
+            static constexpr std::size_t k_maxAlignment = 128;
+            //------------------------------------------------------------------------------
+            /// @param in_allocator - The allocator to allocate from. Must outlive this.
+            /// @param in_alignment - The alignment of each allocation. Must be a power of
+            /// two no greater than k_maxAlignment.
+            //------------------------------------------------------------------------------
+            AlignedAllocator(CS::IAllocator& in_allocator, std::size_t in_alignment) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The alignment of each allocation.
+            //------------------------------------------------------------------------------
+            std::size_t GetAlignment() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Allocates from the given allocator, aligned to the given alignment. This
+            /// allows the alignment to vary between allocations without constructing an
+            /// AlignedAllocator for each.
+            ///
+            /// @param in_allocator - The allocator to allocate from.
+            /// @param in_allocationSize - The size of the allocation. Must be no greater
+            /// than the max allocation size of the allocator less the alignment.
+            /// @param in_alignment - The alignment of the allocation. Must be a power of
+            /// two no greater than k_maxAlignment.
+            ///
+            /// @return The aligned memory.
+            //------------------------------------------------------------------------------
+            static void* AllocateAligned(CS::IAllocator& in_allocator, std::size_t in_allocationSize, std::size_t in_alignment) noexcept;
+            //------------------------------------------------------------------------------
+            /// Returns memory allocated with AllocateAligned() to the allocator it was
+            /// allocated from.
+            ///
+            /// @param in_allocator - The allocator the memory was allocated from.
+            /// @param in_pointer - The aligned memory to deallocate.
+            /// @param in_alignment - The alignment it was allocated with.
+            //------------------------------------------------------------------------------
+            static void DeallocateAligned(CS::IAllocator& in_allocator, void* in_pointer, std::size_t in_alignment) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The max allocation size of the wrapped allocator, less the space
+            /// needed to align an allocation.
+            //------------------------------------------------------------------------------
+            std::size_t GetMaxAllocationSize() const noexcept override;
+            //------------------------------------------------------------------------------
+            /// Allocates from the wrapped allocator, aligned to the alignment.
+            ///
+            /// @param in_allocationSize - The size of the allocation.
+            ///
+            /// @return The aligned memory.
+            //------------------------------------------------------------------------------
+            void* Allocate(std::size_t in_allocationSize) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Returns the original allocation to the wrapped allocator.
+            ///
+            /// @param in_pointer - The aligned memory to deallocate.
+            //------------------------------------------------------------------------------
+            void Deallocate(void* in_pointer) noexcept override;
+            
+        private:
+            CS::IAllocator& m_allocator;
+            const std::size_t m_alignment;
+        };
+    }
+}
+
+#endif
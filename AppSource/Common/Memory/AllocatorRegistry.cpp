@@ -0,0 +1,108 @@
+//
+//  AllocatorRegistry.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Memory/AllocatorRegistry.h>
+
+#include <Common/Memory/TrackedAllocator.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <algorithm>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        CS_DEFINE_NAMEDTYPE(AllocatorRegistry);
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AllocatorRegistryUPtr AllocatorRegistry::Create() noexcept
+        {
+            return AllocatorRegistryUPtr(new AllocatorRegistry());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool AllocatorRegistry::IsA(CS::InterfaceIDType in_interfaceId) const noexcept
+        {
+            return (AllocatorRegistry::InterfaceID == in_interfaceId);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<AllocatorStats> AllocatorRegistry::GetStats() const noexcept
+        {
+            std::vector<AllocatorStats> output;
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (auto allocator : m_allocators)
+            {
+                output.push_back(allocator->GetStats());
+            }
+            lock.unlock();
+            
+            std::stable_sort(output.begin(), output.end(), [](const AllocatorStats& in_a, const AllocatorStats& in_b) noexcept
+            {
+                return in_a.GetName() < in_b.GetName();
+            });
+            
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool AllocatorRegistry::TryGetStats(const std::string& in_name, AllocatorStats& out_stats) const noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (auto allocator : m_allocators)
+            {
+                if (allocator->GetName() == in_name)
+                {
+                    out_stats = allocator->GetStats();
+                    return true;
+                }
+            }
+            
+            return false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AllocatorRegistry::Add(const TrackedAllocator* in_allocator) noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_allocators.push_back(in_allocator);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AllocatorRegistry::Remove(const TrackedAllocator* in_allocator) noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            auto it = std::find(m_allocators.begin(), m_allocators.end(), in_allocator);
+            CS_ASSERT(it != m_allocators.end(), "Allocator is not in the registry.");
+            m_allocators.erase(it);
+        }
+    }
+}
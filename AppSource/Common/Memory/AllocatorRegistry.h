@@ -0,0 +1,107 @@
+//
+//  AllocatorRegistry.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_ALLOCATORREGISTRY_H_
+#define _COMMON_MEMORY_ALLOCATORREGISTRY_H_
+
+#include <CSTest.h>
+
+#include <Common/Memory/AllocatorStats.h>
+
+#include <ChilliSource/Core/System.h>
+
+#include <mutex>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An app system which keeps track of every live TrackedAllocator, so that
+        /// their usage can be queried in one place, for example by a debug overlay or
+        /// when writing a report. Tracked allocators add and remove themselves.
+        ///
+        /// This is thread-safe.
+        //------------------------------------------------------------------------------
+        class AllocatorRegistry final : public CS::AppSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(AllocatorRegistry);
+            //------------------------------------------------------------------------------
+            /// Allows querying of whether or not this system implements the interface
+            /// described by the given interface Id.
+            ///
+            /// @param in_interfaceId - The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //------------------------------------------------------------------------------
+            bool IsA(CS::InterfaceIDType in_interfaceId) const noexcept override;
+            //------------------------------------------------------------------------------
+            /// @return A snapshot of the usage of each live tracked allocator, ordered by
+            /// name.
+            //------------------------------------------------------------------------------
+            std::vector<AllocatorStats> GetStats() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_name - The name of the allocator.
+            /// @param out_stats - [Out] The usage of the allocator, if it was found.
+            ///
+            /// @return Whether or not a live tracked allocator with the given name was
+            /// found. If more than one has the name, the first which was added is used.
+            //------------------------------------------------------------------------------
+            bool TryGetStats(const std::string& in_name, AllocatorStats& out_stats) const noexcept;
+            
+        private:
+            friend class CS::Application;
+            friend class TrackedAllocator;
+            //------------------------------------------------------------------------------
+            /// A factory method for creating new instances of the system.
+            ///
+            /// @return The new instance.
+            //------------------------------------------------------------------------------
+            static AllocatorRegistryUPtr Create() noexcept;
+            //------------------------------------------------------------------------------
+            /// Default constructor. Declared private to ensure the system is created
+            /// through Application::CreateSystem<>().
+            //------------------------------------------------------------------------------
+            AllocatorRegistry() = default;
+            //------------------------------------------------------------------------------
+            /// @param in_allocator - The tracked allocator to add.
+            //------------------------------------------------------------------------------
+            void Add(const TrackedAllocator* in_allocator) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_allocator - The tracked allocator to remove.
+            //------------------------------------------------------------------------------
+            void Remove(const TrackedAllocator* in_allocator) noexcept;
+            
+            mutable std::mutex m_mutex;
+            std::vector<const TrackedAllocator*> m_allocators;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,120 @@
+//
+//  AllocatorStats.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Memory/AllocatorStats.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AllocatorStats::AllocatorStats(const std::string& in_name, u64 in_numAllocations, u64 in_numDeallocations, u64 in_bytesInUse, u64 in_peakBytesInUse, u64 in_reservedBytes, u64 in_peakWastedBytes,
+                                       u32 in_peakUsageNumPages, u32 in_numPages, u32 in_peakNumPages, const std::vector<u32>& in_pageHistory) noexcept
+            : m_name(in_name), m_numAllocations(in_numAllocations), m_numDeallocations(in_numDeallocations), m_bytesInUse(in_bytesInUse), m_peakBytesInUse(in_peakBytesInUse), m_reservedBytes(in_reservedBytes),
+              m_peakWastedBytes(in_peakWastedBytes), m_peakUsageNumPages(in_peakUsageNumPages), m_numPages(in_numPages), m_peakNumPages(in_peakNumPages), m_pageHistory(in_pageHistory)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& AllocatorStats::GetName() const noexcept
+        {
+            return m_name;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocatorStats::GetNumAllocations() const noexcept
+        {
+            return m_numAllocations;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocatorStats::GetNumDeallocations() const noexcept
+        {
+            return m_numDeallocations;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocatorStats::GetBytesInUse() const noexcept
+        {
+            return m_bytesInUse;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocatorStats::GetPeakBytesInUse() const noexcept
+        {
+            return m_peakBytesInUse;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocatorStats::GetReservedBytes() const noexcept
+        {
+            return m_reservedBytes;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocatorStats::GetPeakWastedBytes() const noexcept
+        {
+            return m_peakWastedBytes;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 AllocatorStats::GetPeakWastedBytesPerPage() const noexcept
+        {
+            if (m_peakUsageNumPages == 0)
+            {
+                return 0.0f;
+            }
+            
+            return f32(m_peakWastedBytes) / f32(m_peakUsageNumPages);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 AllocatorStats::GetPeakUsageNumPages() const noexcept
+        {
+            return m_peakUsageNumPages;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 AllocatorStats::GetNumPages() const noexcept
+        {
+            return m_numPages;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 AllocatorStats::GetPeakNumPages() const noexcept
+        {
+            return m_peakNumPages;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<u32>& AllocatorStats::GetPageHistory() const noexcept
+        {
+            return m_pageHistory;
+        }
+    }
+}
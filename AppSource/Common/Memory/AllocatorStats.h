@@ -0,0 +1,149 @@
+//
+//  AllocatorStats.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_ALLOCATORSTATS_H_
+#define _COMMON_MEMORY_ALLOCATORSTATS_H_
+
+#include <CSTest.h>
+
+#include <string>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An immutable snapshot of the usage of a single allocator, as recorded by a
+        /// TrackedAllocator.
+        ///
+        /// Reserved bytes are those the allocator has taken from its backing memory:
+        /// the consumed portion of a linear allocator's buffer, or every page of a
+        /// paged linear allocator. Wasted bytes are the reserved bytes which were not
+        /// in use at the moment usage peaked, which includes alignment padding, memory
+        /// from deallocations which a linear allocator cannot reclaim, and the unused
+        /// ends of pages.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class AllocatorStats final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// Constructs an empty instance, describing no allocations.
+            //------------------------------------------------------------------------------
+            AllocatorStats() = default;
+            //------------------------------------------------------------------------------
+            /// @param in_name - The name of the allocator.
+            /// @param in_numAllocations - The number of allocations made.
+            /// @param in_numDeallocations - The number of deallocations made.
+            /// @param in_bytesInUse - The number of bytes currently allocated.
+            /// @param in_peakBytesInUse - The highest number of bytes allocated at once.
+            /// @param in_reservedBytes - The number of bytes currently reserved.
+            /// @param in_peakWastedBytes - The number of reserved bytes which were not in
+            /// use when usage peaked.
+            /// @param in_peakUsageNumPages - The number of pages held when usage peaked.
+            /// @param in_numPages - The current number of pages.
+            /// @param in_peakNumPages - The highest number of pages held at once.
+            /// @param in_pageHistory - The most recent page counts, in the order they
+            /// were observed. A count is only added when it differs from the last.
+            //------------------------------------------------------------------------------
+            AllocatorStats(const std::string& in_name, u64 in_numAllocations, u64 in_numDeallocations, u64 in_bytesInUse, u64 in_peakBytesInUse, u64 in_reservedBytes, u64 in_peakWastedBytes,
+                           u32 in_peakUsageNumPages, u32 in_numPages, u32 in_peakNumPages, const std::vector<u32>& in_pageHistory) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the allocator.
+            //------------------------------------------------------------------------------
+            const std::string& GetName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of allocations made.
+            //------------------------------------------------------------------------------
+            u64 GetNumAllocations() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of deallocations made.
+            //------------------------------------------------------------------------------
+            u64 GetNumDeallocations() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of bytes requested by allocations which have not yet
+            /// been deallocated.
+            //------------------------------------------------------------------------------
+            u64 GetBytesInUse() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The highest number of bytes which were in use at once.
+            //------------------------------------------------------------------------------
+            u64 GetPeakBytesInUse() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of bytes the allocator currently has reserved, or zero
+            /// if this isn't known for the type of allocator.
+            //------------------------------------------------------------------------------
+            u64 GetReservedBytes() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of reserved bytes which were not in use when usage
+            /// peaked.
+            //------------------------------------------------------------------------------
+            u64 GetPeakWastedBytes() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of reserved bytes per page which were not in use when
+            /// usage peaked, or zero if the allocator isn't paged.
+            //------------------------------------------------------------------------------
+            f32 GetPeakWastedBytesPerPage() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of pages held when usage peaked. This can be lower
+            /// than the peak number of pages, as pages may be acquired later without
+            /// usage exceeding its peak.
+            //------------------------------------------------------------------------------
+            u32 GetPeakUsageNumPages() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The current number of pages, or zero if the allocator isn't
+            /// paged.
+            //------------------------------------------------------------------------------
+            u32 GetNumPages() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The highest number of pages held at once.
+            //------------------------------------------------------------------------------
+            u32 GetPeakNumPages() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The most recent page counts, in the order they were observed.
+            //------------------------------------------------------------------------------
+            const std::vector<u32>& GetPageHistory() const noexcept;
+            
+        private:
+            std::string m_name;
+            u64 m_numAllocations = 0;
+            u64 m_numDeallocations = 0;
+            u64 m_bytesInUse = 0;
+            u64 m_peakBytesInUse = 0;
+            u64 m_reservedBytes = 0;
+            u64 m_peakWastedBytes = 0;
+            u32 m_peakUsageNumPages = 0;
+            u32 m_numPages = 0;
+            u32 m_peakNumPages = 0;
+            std::vector<u32> m_pageHistory;
+        };
+    }
+}
+
+#endif
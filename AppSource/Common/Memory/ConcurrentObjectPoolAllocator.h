@@ -0,0 +1,225 @@
+//
+//  ConcurrentObjectPoolAllocator.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_CONCURRENTOBJECTPOOLALLOCATOR_H_
+#define _COMMON_MEMORY_CONCURRENTOBJECTPOOLALLOCATOR_H_
+
+#include <CSTest.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Memory.h>
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// A thread-safe, lock-free equivalent of CS::ObjectPoolAllocator. Objects can
+        /// be allocated on one thread and deallocated on another, for example created
+        /// in a background task and released on the main thread.
+        ///
+        /// Free slots are kept in a lock-free stack. The head of the stack is a slot
+        /// index packed with a tag which is incremented on every change, so a thread
+        /// which has been pre-empted mid-pop cannot be fooled by the same slot being
+        /// popped and pushed again in the meantime (the ABA problem).
+        ///
+        /// Each slot holds a single TType, so this cannot be used with CS::MakeShared()
+        /// or CS::MakeUniqueArray(), which allocate more than a single object.
+        ///
+        /// If the limit policy is k_expand, allocations made once the pool is exhausted
+        /// are taken from the global heap. These are also thread-safe, but not lock-free.
+        //------------------------------------------------------------------------------
+        template <typename TType> class ConcurrentObjectPoolAllocator final : public CS::IAllocator
+        {
+        public:
+            CS_DECLARE_NOCOPY(ConcurrentObjectPoolAllocator);
+            //------------------------------------------------------------------------------
+            /// Creates a new pool with the given number of slots.
+            ///
+            /// @param in_numObjects - The number of objects the pool can hold.
+            /// @param in_limitPolicy - What should happen when the pool is exhausted.
+            //------------------------------------------------------------------------------
+            ConcurrentObjectPoolAllocator(std::size_t in_numObjects, CS::ObjectPoolAllocatorLimitPolicy in_limitPolicy = CS::ObjectPoolAllocatorLimitPolicy::k_fixed) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The size of a single slot.
+            //------------------------------------------------------------------------------
+            std::size_t GetMaxAllocationSize() const noexcept override;
+            //------------------------------------------------------------------------------
+            /// @return The number of objects the pool can hold before it is exhausted.
+            //------------------------------------------------------------------------------
+            std::size_t GetCapacity() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Allocates a single slot. This is thread-safe.
+            ///
+            /// @param in_allocationSize - The size of the allocation. This must not be
+            /// larger than a single slot.
+            ///
+            /// @return The allocated memory.
+            //------------------------------------------------------------------------------
+            void* Allocate(std::size_t in_allocationSize) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Returns a slot to the pool. This is thread-safe, and need not be called on
+            /// the thread which allocated the slot.
+            ///
+            /// @param in_pointer - The memory to deallocate.
+            //------------------------------------------------------------------------------
+            void Deallocate(void* in_pointer) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Allocates memory for a single object, without constructing it. This is
+            /// thread-safe.
+            ///
+            /// @return The allocated memory.
+            //------------------------------------------------------------------------------
+            TType* Allocate() noexcept;
+            //------------------------------------------------------------------------------
+            /// Returns the memory for a single object to the pool, without destroying it.
+            /// This is thread-safe.
+            ///
+            /// @param in_object - The memory to deallocate.
+            //------------------------------------------------------------------------------
+            void Deallocate(TType* in_object) noexcept;
+            
+        private:
+            using Slot = typename std::aligned_storage<sizeof(TType), alignof(TType)>::type;
+            
+            static constexpr u32 k_nullIndex = 0xffffffff;
+            //------------------------------------------------------------------------------
+            /// @param in_head - The head which is being replaced.
+            /// @param in_index - The index of the new head.
+            ///
+            /// @return The new head, with the tag incremented.
+            //------------------------------------------------------------------------------
+            static u64 MakeHead(u64 in_head, u32 in_index) noexcept;
+            
+            const std::size_t m_capacity;
+            const CS::ObjectPoolAllocatorLimitPolicy m_limitPolicy;
+            std::unique_ptr<Slot[]> m_slots;
+            std::unique_ptr<std::atomic<u32>[]> m_nextIndices;
+            std::atomic<u64> m_head;
+        };
+        
+        template <typename TType> constexpr u32 ConcurrentObjectPoolAllocator<TType>::k_nullIndex;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> ConcurrentObjectPoolAllocator<TType>::ConcurrentObjectPoolAllocator(std::size_t in_numObjects, CS::ObjectPoolAllocatorLimitPolicy in_limitPolicy) noexcept
+            : m_capacity(in_numObjects), m_limitPolicy(in_limitPolicy), m_slots(new Slot[in_numObjects]), m_nextIndices(new std::atomic<u32>[in_numObjects])
+        {
+            CS_ASSERT(in_numObjects > 0 && in_numObjects < k_nullIndex, "Invalid number of objects.");
+            
+            for (std::size_t i = 0; i < in_numObjects; ++i)
+            {
+                m_nextIndices[i].store((i + 1 < in_numObjects) ? u32(i + 1) : k_nullIndex, std::memory_order_relaxed);
+            }
+            
+            m_head.store(0, std::memory_order_release);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> std::size_t ConcurrentObjectPoolAllocator<TType>::GetMaxAllocationSize() const noexcept
+        {
+            return sizeof(Slot);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> std::size_t ConcurrentObjectPoolAllocator<TType>::GetCapacity() const noexcept
+        {
+            return m_capacity;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> void* ConcurrentObjectPoolAllocator<TType>::Allocate(std::size_t in_allocationSize) noexcept
+        {
+            CS_ASSERT(in_allocationSize <= sizeof(Slot), "Allocation is larger than a pool slot.");
+            
+            auto head = m_head.load(std::memory_order_acquire);
+            while (u32(head) != k_nullIndex)
+            {
+                auto index = u32(head);
+                
+                // If another thread pops this slot first the read index may be stale, but
+                // the tag in the head will have changed so the exchange below will fail.
+                auto nextIndex = m_nextIndices[index].load(std::memory_order_relaxed);
+                if (m_head.compare_exchange_weak(head, MakeHead(head, nextIndex), std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    return &m_slots[index];
+                }
+            }
+            
+            if (m_limitPolicy != CS::ObjectPoolAllocatorLimitPolicy::k_expand)
+            {
+                CS_LOG_FATAL("Concurrent object pool has been exhausted.");
+            }
+            
+            return new Slot();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> void ConcurrentObjectPoolAllocator<TType>::Deallocate(void* in_pointer) noexcept
+        {
+            auto slot = static_cast<Slot*>(in_pointer);
+            if (slot < m_slots.get() || slot >= m_slots.get() + m_capacity)
+            {
+                CS_ASSERT(m_limitPolicy == CS::ObjectPoolAllocatorLimitPolicy::k_expand, "Pointer was not allocated from this pool.");
+                delete slot;
+                return;
+            }
+            
+            auto index = u32(slot - m_slots.get());
+            auto head = m_head.load(std::memory_order_relaxed);
+            do
+            {
+                m_nextIndices[index].store(u32(head), std::memory_order_relaxed);
+            }
+            while (!m_head.compare_exchange_weak(head, MakeHead(head, index), std::memory_order_release, std::memory_order_relaxed));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> TType* ConcurrentObjectPoolAllocator<TType>::Allocate() noexcept
+        {
+            return static_cast<TType*>(Allocate(sizeof(TType)));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> void ConcurrentObjectPoolAllocator<TType>::Deallocate(TType* in_object) noexcept
+        {
+            Deallocate(static_cast<void*>(in_object));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> u64 ConcurrentObjectPoolAllocator<TType>::MakeHead(u64 in_head, u32 in_index) noexcept
+        {
+            return (((in_head >> 32) + 1) << 32) | u64(in_index);
+        }
+    }
+}
+
+#endif
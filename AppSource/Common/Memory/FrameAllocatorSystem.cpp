@@ -0,0 +1,173 @@
+//
+//  FrameAllocatorSystem.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Memory/FrameAllocatorSystem.h>
+
+#include <Common/Core/TestConfig.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Core/Threading.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            std::atomic<u32> g_nextInstanceId(1);
+            
+            //------------------------------------------------------------------------------
+            /// The calling thread's allocators, along with the Id of the system instance
+            /// which owns them. The Id guards against a stale pointer being used if the
+            /// system is ever recreated.
+            //------------------------------------------------------------------------------
+            thread_local u32 t_instanceId = 0;
+            thread_local void* t_threadAllocators = nullptr;
+        }
+        
+        CS_DEFINE_NAMEDTYPE(FrameAllocatorSystem);
+        
+        constexpr std::size_t FrameAllocatorSystem::k_pageSize;
+        constexpr u32 FrameAllocatorSystem::k_numBuffers;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        FrameAllocatorSystemUPtr FrameAllocatorSystem::Create() noexcept
+        {
+            return FrameAllocatorSystemUPtr(new FrameAllocatorSystem());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        FrameAllocatorSystem::FrameAllocatorSystem() noexcept
+            : m_instanceId(g_nextInstanceId++), m_frameIndex(0)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool FrameAllocatorSystem::IsA(CS::InterfaceIDType in_interfaceId) const noexcept
+        {
+            return (FrameAllocatorSystem::InterfaceID == in_interfaceId);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        CS::IAllocator& FrameAllocatorSystem::GetAllocator() noexcept
+        {
+            auto frameIndex = GetFrameIndex();
+            auto& threadAllocators = GetThreadAllocators(frameIndex);
+            auto& allocator = *threadAllocators.m_allocators[frameIndex % k_numBuffers];
+            
+            if (threadAllocators.m_frameIndex != frameIndex)
+            {
+                // The allocator for this frame was last used at least two frames ago, so
+                // nothing allocated from it can still be in use.
+                allocator.Reset();
+                threadAllocators.m_frameIndex = frameIndex;
+            }
+            
+            auto& trackedAllocator = threadAllocators.m_trackedAllocators[frameIndex % k_numBuffers];
+            if (trackedAllocator)
+            {
+                return *trackedAllocator;
+            }
+            
+            return allocator;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 FrameAllocatorSystem::GetNumThreads() const noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return u32(m_threadAllocators.size());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 FrameAllocatorSystem::GetFrameIndex() const noexcept
+        {
+            auto application = CS::Application::Get();
+            if (application->GetTaskScheduler()->IsMainThread())
+            {
+                return application->GetFrameIndex();
+            }
+            
+            return m_frameIndex.load(std::memory_order_acquire);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        FrameAllocatorSystem::ThreadAllocators& FrameAllocatorSystem::GetThreadAllocators(u32 in_frameIndex) noexcept
+        {
+            if (t_instanceId != m_instanceId)
+            {
+                std::unique_ptr<ThreadAllocators> threadAllocators(new ThreadAllocators());
+                for (auto& allocator : threadAllocators->m_allocators)
+                {
+                    allocator.reset(new CS::PagedLinearAllocator(k_pageSize));
+                }
+                threadAllocators->m_frameIndex = in_frameIndex;
+                
+                t_instanceId = m_instanceId;
+                t_threadAllocators = threadAllocators.get();
+                
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_isTracked)
+                {
+                    auto namePrefix = "FrameAllocator/Thread" + CS::ToString(u32(m_threadAllocators.size())) + "/";
+                    for (u32 i = 0; i < k_numBuffers; ++i)
+                    {
+                        threadAllocators->m_trackedAllocators[i].reset(new TrackedAllocator(namePrefix + CS::ToString(i), *threadAllocators->m_allocators[i]));
+                    }
+                }
+                
+                m_threadAllocators.push_back(std::move(threadAllocators));
+            }
+            
+            return *static_cast<ThreadAllocators*>(t_threadAllocators);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void FrameAllocatorSystem::OnInit() noexcept
+        {
+            auto testConfig = CS::Application::Get()->GetSystem<TestConfig>();
+            m_isTracked = testConfig && testConfig->IsAllocatorStatsEnabled();
+            
+            m_frameIndex.store(CS::Application::Get()->GetFrameIndex(), std::memory_order_release);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void FrameAllocatorSystem::OnUpdate(f32 in_deltaTime) noexcept
+        {
+            m_frameIndex.store(CS::Application::Get()->GetFrameIndex(), std::memory_order_release);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void FrameAllocatorSystem::OnDestroy() noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_threadAllocators.clear();
+        }
+    }
+}
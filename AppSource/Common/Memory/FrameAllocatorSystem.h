@@ -0,0 +1,163 @@
+//
+//  FrameAllocatorSystem.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_FRAMEALLOCATORSYSTEM_H_
+#define _COMMON_MEMORY_FRAMEALLOCATORSYSTEM_H_
+
+#include <CSTest.h>
+
+#include <Common/Memory/TrackedAllocator.h>
+
+#include <ChilliSource/Core/Memory.h>
+#include <ChilliSource/Core/System.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An app system which provides each thread with its own frame scoped
+        /// allocator. Allocation from a frame allocator requires no locking, as each
+        /// thread only ever allocates from its own.
+        ///
+        /// Each thread owns two paged linear allocators, used on alternating frames.
+        /// The allocator for the current frame is reset the first time the thread
+        /// requests it in a new frame, at which point anything allocated from it at
+        /// least two frames previously is discarded. This means allocations made
+        /// during one frame may be kept until the end of the following frame, but
+        /// must be released before then.
+        ///
+        /// The current frame is read directly from the application on the main
+        /// thread. Other threads see the frame index as of the last update of this
+        /// system.
+        ///
+        /// If allocator stats are enabled in the TestConfig, each allocator is wrapped
+        /// in a TrackedAllocator named "FrameAllocator/Thread<index>/<buffer>", so its
+        /// usage can be read from the AllocatorRegistry.
+        //------------------------------------------------------------------------------
+        class FrameAllocatorSystem final : public CS::AppSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(FrameAllocatorSystem);
+            
+            static constexpr std::size_t k_pageSize = 64 * 1024;
+            static constexpr u32 k_numBuffers = 2;
+            //------------------------------------------------------------------------------
+            /// Allows querying of whether or not this system implements the interface
+            /// described by the given interface Id.
+            ///
+            /// @param in_interfaceId - The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //------------------------------------------------------------------------------
+            bool IsA(CS::InterfaceIDType in_interfaceId) const noexcept override;
+            //------------------------------------------------------------------------------
+            /// Gets the calling thread's allocator for the current frame, creating the
+            /// thread's allocators if this is the first time it has requested one. The
+            /// returned allocator must only be used from the calling thread.
+            ///
+            /// @return The frame allocator for the calling thread.
+            //------------------------------------------------------------------------------
+            CS::IAllocator& GetAllocator() noexcept;
+            //------------------------------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @return The number of threads which have requested a frame allocator.
+            //------------------------------------------------------------------------------
+            u32 GetNumThreads() const noexcept;
+            
+        private:
+            friend class CS::Application;
+            //------------------------------------------------------------------------------
+            /// The frame allocators owned by a single thread, along with the frame in
+            /// which the thread last requested one.
+            //------------------------------------------------------------------------------
+            struct ThreadAllocators final
+            {
+                std::array<std::unique_ptr<CS::PagedLinearAllocator>, k_numBuffers> m_allocators;
+                std::array<TrackedAllocatorUPtr, k_numBuffers> m_trackedAllocators;
+                u32 m_frameIndex = 0;
+            };
+            //------------------------------------------------------------------------------
+            /// A factory method for creating new instances of the system.
+            ///
+            /// @return The new instance.
+            //------------------------------------------------------------------------------
+            static FrameAllocatorSystemUPtr Create() noexcept;
+            //------------------------------------------------------------------------------
+            /// Default constructor. Declared private to ensure the system is created
+            /// through Application::CreateSystem<>().
+            //------------------------------------------------------------------------------
+            FrameAllocatorSystem() noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The current frame index, as seen by the calling thread.
+            //------------------------------------------------------------------------------
+            u32 GetFrameIndex() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Gets the allocators owned by the calling thread, creating them if they
+            /// don't yet exist.
+            ///
+            /// @param in_frameIndex - The current frame index.
+            ///
+            /// @return The allocators for the calling thread.
+            //------------------------------------------------------------------------------
+            ThreadAllocators& GetThreadAllocators(u32 in_frameIndex) noexcept;
+            //------------------------------------------------------------------------------
+            /// Records the frame index which is seen by background threads, and whether
+            /// or not the allocators should be tracked.
+            //------------------------------------------------------------------------------
+            void OnInit() noexcept override;
+            //------------------------------------------------------------------------------
+            /// Records the frame index which is seen by background threads.
+            ///
+            /// @param in_deltaTime - The time since the last update.
+            //------------------------------------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Releases every thread's allocators. This happens here rather than on
+            /// destruction so that any tracked allocators are removed from the
+            /// AllocatorRegistry before it is destroyed. Frame allocators must not be
+            /// requested after this point.
+            //------------------------------------------------------------------------------
+            void OnDestroy() noexcept override;
+            
+            const u32 m_instanceId;
+            std::atomic<u32> m_frameIndex;
+            bool m_isTracked = false;
+            
+            mutable std::mutex m_mutex;
+            std::vector<std::unique_ptr<ThreadAllocators>> m_threadAllocators;
+        };
+    }
+}
+
+#endif
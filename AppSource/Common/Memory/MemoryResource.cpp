@@ -0,0 +1,78 @@
+//
+//  MemoryResource.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Memory/MemoryResource.h>
+
+#include <Common/Memory/AlignedAllocator.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AllocatorMemoryResource::AllocatorMemoryResource(CS::IAllocator& in_allocator) noexcept
+            : m_allocator(in_allocator)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        CS::IAllocator& AllocatorMemoryResource::GetAllocator() const noexcept
+        {
+            return m_allocator;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void* AllocatorMemoryResource::Allocate(std::size_t in_numBytes, std::size_t in_alignment) noexcept
+        {
+            if (in_alignment > alignof(std::max_align_t))
+            {
+                return AlignedAllocator::AllocateAligned(m_allocator, in_numBytes, in_alignment);
+            }
+            
+            return m_allocator.Allocate(in_numBytes);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AllocatorMemoryResource::Deallocate(void* in_pointer, std::size_t in_numBytes, std::size_t in_alignment) noexcept
+        {
+            if (in_alignment > alignof(std::max_align_t))
+            {
+                AlignedAllocator::DeallocateAligned(m_allocator, in_pointer, in_alignment);
+                return;
+            }
+            
+            m_allocator.Deallocate(in_pointer);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool AllocatorMemoryResource::IsEqual(const MemoryResource& in_other) const noexcept
+        {
+            return (this == &in_other);
+        }
+    }
+}
@@ -0,0 +1,146 @@
+//
+//  MemoryResource.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_MEMORYRESOURCE_H_
+#define _COMMON_MEMORY_MEMORYRESOURCE_H_
+
+#include <CSTest.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+#include <cstddef>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An interface for a source of memory which can be shared by containers of
+        /// different types, modelled on std::pmr::memory_resource. The app is built
+        /// against C++11, so this and PolymorphicAllocator stand in for std::pmr
+        /// until that is available; they mirror its interface so that moving to it
+        /// only requires a change of names.
+        ///
+        /// Whether or not an implementation is thread-safe depends on the memory it
+        /// allocates from.
+        //------------------------------------------------------------------------------
+        class MemoryResource
+        {
+        public:
+            CS_DECLARE_NOCOPY(MemoryResource);
+            
+            MemoryResource() = default;
+            //------------------------------------------------------------------------------
+            /// Allocates memory with at least the given size and alignment.
+            ///
+            /// @param in_numBytes - The size of the allocation.
+            /// @param in_alignment - [Optional] The alignment of the allocation. Must be
+            /// a power of two.
+            ///
+            /// @return The allocated memory.
+            //------------------------------------------------------------------------------
+            virtual void* Allocate(std::size_t in_numBytes, std::size_t in_alignment = alignof(std::max_align_t)) noexcept = 0;
+            //------------------------------------------------------------------------------
+            /// Deallocates memory previously returned by Allocate().
+            ///
+            /// @param in_pointer - The memory to deallocate.
+            /// @param in_numBytes - The size which was passed to Allocate().
+            /// @param in_alignment - [Optional] The alignment which was passed to
+            /// Allocate().
+            //------------------------------------------------------------------------------
+            virtual void Deallocate(void* in_pointer, std::size_t in_numBytes, std::size_t in_alignment = alignof(std::max_align_t)) noexcept = 0;
+            //------------------------------------------------------------------------------
+            /// @param in_other - Another memory resource.
+            ///
+            /// @return Whether or not memory allocated from this resource can be
+            /// deallocated from the other, and vice versa.
+            //------------------------------------------------------------------------------
+            virtual bool IsEqual(const MemoryResource& in_other) const noexcept = 0;
+            //------------------------------------------------------------------------------
+            /// Virtual destructor.
+            //------------------------------------------------------------------------------
+            virtual ~MemoryResource() noexcept {}
+        };
+        //------------------------------------------------------------------------------
+        /// A memory resource which allocates from a CS::IAllocator, such as a
+        /// CS::LinearAllocator, CS::PagedLinearAllocator or CS::ObjectPoolAllocator.
+        /// This allows standard containers, through PolymorphicAllocator, to allocate
+        /// from a frame or scratch allocator rather than the global heap.
+        ///
+        /// Allocations with an alignment above alignof(std::max_align_t) are aligned
+        /// in the same way as an AlignedAllocator, so cost up to the alignment in
+        /// additional bytes. An object pool can only be used by containers
+        /// which allocate a single node at a time, such as std::list, and only where
+        /// the node fits in a pool slot.
+        ///
+        /// This is thread-safe provided the wrapped allocator is.
+        //------------------------------------------------------------------------------
+        class AllocatorMemoryResource final : public MemoryResource
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_allocator - The allocator to allocate from. Must outlive this.
+            //------------------------------------------------------------------------------
+            AllocatorMemoryResource(CS::IAllocator& in_allocator) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The allocator which memory is allocated from.
+            //------------------------------------------------------------------------------
+            CS::IAllocator& GetAllocator() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Allocates from the wrapped allocator.
+            ///
+            /// @param in_numBytes - The size of the allocation.
+            /// @param in_alignment - [Optional] The alignment of the allocation. Must be
+            /// a power of two.
+            ///
+            /// @return The allocated memory.
+            //------------------------------------------------------------------------------
+            void* Allocate(std::size_t in_numBytes, std::size_t in_alignment = alignof(std::max_align_t)) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Deallocates from the wrapped allocator.
+            ///
+            /// @param in_pointer - The memory to deallocate.
+            /// @param in_numBytes - The size which was passed to Allocate().
+            /// @param in_alignment - [Optional] The alignment which was passed to
+            /// Allocate().
+            //------------------------------------------------------------------------------
+            void Deallocate(void* in_pointer, std::size_t in_numBytes, std::size_t in_alignment = alignof(std::max_align_t)) noexcept override;
+            //------------------------------------------------------------------------------
+            /// @param in_other - Another memory resource.
+            ///
+            /// @return Whether or not the other resource is this resource. Resources
+            /// which wrap the same allocator are not considered equal.
+            //------------------------------------------------------------------------------
+            bool IsEqual(const MemoryResource& in_other) const noexcept override;
+            
+        private:
+            CS::IAllocator& m_allocator;
+        };
+    }
+}
+
+#endif
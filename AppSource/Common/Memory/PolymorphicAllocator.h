@@ -0,0 +1,164 @@
+//
+//  PolymorphicAllocator.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_POLYMORPHICALLOCATOR_H_
+#define _COMMON_MEMORY_POLYMORPHICALLOCATOR_H_
+
+#include <CSTest.h>
+
+#include <Common/Memory/MemoryResource.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <cstddef>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// A standard library allocator which allocates from a MemoryResource, modelled
+        /// on std::pmr::polymorphic_allocator. This allows standard containers to
+        /// allocate from a CS allocator, for example:
+        ///
+        ///     AllocatorMemoryResource resource(frameAllocatorSystem->GetAllocator());
+        ///     std::vector<CS::RenderPass, PolymorphicAllocator<CS::RenderPass>> renderPasses(&resource);
+        ///
+        /// A copy of a container allocates from the same resource as the original. As
+        /// with std::pmr::polymorphic_allocator, the allocator is not propagated when
+        /// a container is assigned or swapped.
+        //------------------------------------------------------------------------------
+        template <typename TType> class PolymorphicAllocator
+        {
+        public:
+            using value_type = TType;
+            //------------------------------------------------------------------------------
+            /// @param in_resource - The memory resource to allocate from. Must outlive
+            /// the allocator and any copies of it.
+            //------------------------------------------------------------------------------
+            PolymorphicAllocator(MemoryResource* in_resource) noexcept;
+            //------------------------------------------------------------------------------
+            /// Constructs an allocator which allocates from the same memory resource as
+            /// another, of a different value type.
+            ///
+            /// @param in_other - The other allocator.
+            //------------------------------------------------------------------------------
+            template <typename TOtherType> PolymorphicAllocator(const PolymorphicAllocator<TOtherType>& in_other) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The memory resource which is allocated from.
+            //------------------------------------------------------------------------------
+            MemoryResource* GetResource() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Allocates memory for the given number of objects, without constructing
+            /// them.
+            ///
+            /// @param in_numObjects - The number of objects.
+            ///
+            /// @return The allocated memory.
+            //------------------------------------------------------------------------------
+            TType* allocate(std::size_t in_numObjects) noexcept;
+            //------------------------------------------------------------------------------
+            /// Deallocates memory for the given number of objects, without destroying
+            /// them.
+            ///
+            /// @param in_objects - The memory to deallocate.
+            /// @param in_numObjects - The number of objects which were allocated.
+            //------------------------------------------------------------------------------
+            void deallocate(TType* in_objects, std::size_t in_numObjects) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The allocator used by a copy of a container, which allocates from
+            /// the same resource.
+            //------------------------------------------------------------------------------
+            PolymorphicAllocator select_on_container_copy_construction() const noexcept;
+            
+        private:
+            MemoryResource* m_resource;
+        };
+        //------------------------------------------------------------------------------
+        /// @param in_a - An allocator.
+        /// @param in_b - Another allocator.
+        ///
+        /// @return Whether or not memory allocated by one can be deallocated by the
+        /// other.
+        //------------------------------------------------------------------------------
+        template <typename TType, typename TOtherType> bool operator==(const PolymorphicAllocator<TType>& in_a, const PolymorphicAllocator<TOtherType>& in_b) noexcept
+        {
+            return in_a.GetResource()->IsEqual(*in_b.GetResource());
+        }
+        //------------------------------------------------------------------------------
+        /// @param in_a - An allocator.
+        /// @param in_b - Another allocator.
+        ///
+        /// @return Whether or not memory allocated by one cannot be deallocated by the
+        /// other.
+        //------------------------------------------------------------------------------
+        template <typename TType, typename TOtherType> bool operator!=(const PolymorphicAllocator<TType>& in_a, const PolymorphicAllocator<TOtherType>& in_b) noexcept
+        {
+            return !(in_a == in_b);
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> PolymorphicAllocator<TType>::PolymorphicAllocator(MemoryResource* in_resource) noexcept
+            : m_resource(in_resource)
+        {
+            CS_ASSERT(in_resource, "Memory resource cannot be null.");
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> template <typename TOtherType> PolymorphicAllocator<TType>::PolymorphicAllocator(const PolymorphicAllocator<TOtherType>& in_other) noexcept
+            : m_resource(in_other.GetResource())
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> MemoryResource* PolymorphicAllocator<TType>::GetResource() const noexcept
+        {
+            return m_resource;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> TType* PolymorphicAllocator<TType>::allocate(std::size_t in_numObjects) noexcept
+        {
+            return static_cast<TType*>(m_resource->Allocate(in_numObjects * sizeof(TType), alignof(TType)));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> void PolymorphicAllocator<TType>::deallocate(TType* in_objects, std::size_t in_numObjects) noexcept
+        {
+            m_resource->Deallocate(in_objects, in_numObjects * sizeof(TType), alignof(TType));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> PolymorphicAllocator<TType> PolymorphicAllocator<TType>::select_on_container_copy_construction() const noexcept
+        {
+            return *this;
+        }
+    }
+}
+
+#endif
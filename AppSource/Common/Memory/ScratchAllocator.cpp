@@ -0,0 +1,207 @@
+//
+//  ScratchAllocator.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Memory/ScratchAllocator.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <cstddef>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            constexpr std::size_t k_alignment = alignof(std::max_align_t);
+            
+            //------------------------------------------------------------------------------
+            /// @param in_offset - An offset into a page.
+            ///
+            /// @return The offset rounded up to the allocation alignment.
+            //------------------------------------------------------------------------------
+            std::size_t Align(std::size_t in_offset) noexcept
+            {
+                return (in_offset + k_alignment - 1) & ~(k_alignment - 1);
+            }
+        }
+        
+        constexpr std::size_t ScratchAllocator::k_defaultPageSize;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ScratchAllocator::ScopedMarker::ScopedMarker(ScratchAllocator& in_allocator) noexcept
+            : m_allocator(in_allocator), m_marker(in_allocator.GetMarker())
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ScratchAllocator::ScopedMarker::~ScopedMarker() noexcept
+        {
+            m_allocator.Rewind(m_marker);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ScratchAllocator::ScratchAllocator(std::size_t in_pageSize) noexcept
+            : m_pageSize(in_pageSize)
+        {
+            m_pages.push_back(CreatePage());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ScratchAllocator::ScratchAllocator(CS::IAllocator& in_backingAllocator, std::size_t in_pageSize) noexcept
+            : m_backingAllocator(&in_backingAllocator), m_pageSize(in_pageSize)
+        {
+            CS_ASSERT(in_pageSize <= in_backingAllocator.GetMaxAllocationSize(), "Page size is too large for the backing allocator.");
+            
+            m_pages.push_back(CreatePage());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::size_t ScratchAllocator::GetMaxAllocationSize() const noexcept
+        {
+            return m_pageSize;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::size_t ScratchAllocator::GetPageSize() const noexcept
+        {
+            return m_pageSize;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::size_t ScratchAllocator::GetNumPages() const noexcept
+        {
+            return m_pages.size();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void* ScratchAllocator::Allocate(std::size_t in_allocationSize) noexcept
+        {
+            CS_ASSERT(in_allocationSize <= m_pageSize, "Allocation is larger than a page.");
+            
+            auto offset = Align(m_offset);
+            if (offset + in_allocationSize > m_pageSize)
+            {
+                ++m_pageIndex;
+                if (m_pageIndex == m_pages.size())
+                {
+                    m_pages.push_back(CreatePage());
+                }
+                
+                offset = 0;
+            }
+            
+            m_offset = offset + in_allocationSize;
+            ++m_numActiveAllocations;
+            
+            return m_pages[m_pageIndex] + offset;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ScratchAllocator::Deallocate(void* in_pointer) noexcept
+        {
+            CS_ASSERT(m_numActiveAllocations > 0, "Deallocating when there are no active allocations.");
+            
+            --m_numActiveAllocations;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ScratchAllocator::Marker ScratchAllocator::GetMarker() const noexcept
+        {
+            Marker marker;
+            marker.m_pageIndex = m_pageIndex;
+            marker.m_offset = m_offset;
+            marker.m_numActiveAllocations = m_numActiveAllocations;
+            return marker;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ScratchAllocator::Rewind(const Marker& in_marker) noexcept
+        {
+            CS_ASSERT(in_marker.m_pageIndex < m_pageIndex || (in_marker.m_pageIndex == m_pageIndex && in_marker.m_offset <= m_offset), "Cannot rewind to a marker after the current position.");
+            CS_ASSERT(m_numActiveAllocations <= in_marker.m_numActiveAllocations, "Cannot rewind while allocations made after the marker are still active.");
+            
+            ReleasePages(in_marker.m_pageIndex + 1);
+            m_pageIndex = in_marker.m_pageIndex;
+            m_offset = in_marker.m_offset;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ScratchAllocator::Reset() noexcept
+        {
+            CS_ASSERT(m_numActiveAllocations == 0, "Cannot reset while there are active allocations.");
+            
+            m_pageIndex = 0;
+            m_offset = 0;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ScratchAllocator::ResetAndShrink() noexcept
+        {
+            Reset();
+            ReleasePages(1);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u8* ScratchAllocator::CreatePage() noexcept
+        {
+            if (m_backingAllocator)
+            {
+                return static_cast<u8*>(m_backingAllocator->Allocate(m_pageSize));
+            }
+            
+            return new u8[m_pageSize];
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ScratchAllocator::ReleasePages(std::size_t in_numPages) noexcept
+        {
+            while (m_pages.size() > in_numPages)
+            {
+                if (m_backingAllocator)
+                {
+                    m_backingAllocator->Deallocate(m_pages.back());
+                }
+                else
+                {
+                    delete[] m_pages.back();
+                }
+                
+                m_pages.pop_back();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ScratchAllocator::~ScratchAllocator() noexcept
+        {
+            CS_ASSERT(m_numActiveAllocations == 0, "Scratch allocator destroyed while there are active allocations.");
+            
+            ReleasePages(0);
+        }
+    }
+}
@@ -0,0 +1,202 @@
+//
+//  ScratchAllocator.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_SCRATCHALLOCATOR_H_
+#define _COMMON_MEMORY_SCRATCHALLOCATOR_H_
+
+#include <CSTest.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// A paged linear allocator which, in addition to being reset, can be rewound
+        /// to a previously captured marker. This allows nested temporary work to reuse
+        /// the same memory, rather than growing the allocator for each piece of work:
+        ///
+        ///     {
+        ///         ScratchAllocator::ScopedMarker marker(scratchAllocator);
+        ///         auto visibleObjects = CS::MakeUniqueArray<RenderObject>(scratchAllocator, numObjects);
+        ///         ...
+        ///     }
+        ///
+        /// Rewinding releases any pages acquired after the marker was captured. All
+        /// allocations made after the marker must have been deallocated before it is
+        /// rewound to, so markers must be rewound in the reverse of the order in which
+        /// they were captured. Allocations made before the marker may be deallocated
+        /// at any time, including while the marker is in scope.
+        ///
+        /// Pages are allocated from the backing allocator if one is given, otherwise
+        /// from the global heap. Allocations are aligned to alignof(std::max_align_t),
+        /// and can't be larger than the page size.
+        ///
+        /// This is not thread-safe.
+        //------------------------------------------------------------------------------
+        class ScratchAllocator final : public CS::IAllocator
+        {
+        public:
+            CS_DECLARE_NOCOPY(ScratchAllocator);
+            
+            static constexpr std::size_t k_defaultPageSize = 4096;
+            //------------------------------------------------------------------------------
+            /// A position in the allocator, which it can later be rewound to. A default
+            /// constructed marker refers to the start of the allocator.
+            //------------------------------------------------------------------------------
+            class Marker final
+            {
+            private:
+                friend class ScratchAllocator;
+                
+                u32 m_pageIndex = 0;
+                std::size_t m_offset = 0;
+                u32 m_numActiveAllocations = 0;
+            };
+            //------------------------------------------------------------------------------
+            /// Captures a marker on construction and rewinds the allocator to it on
+            /// destruction.
+            //------------------------------------------------------------------------------
+            class ScopedMarker final
+            {
+            public:
+                CS_DECLARE_NOCOPY(ScopedMarker);
+                //------------------------------------------------------------------------------
+                /// @param in_allocator - The allocator to capture a marker of. Must outlive
+                /// this.
+                //------------------------------------------------------------------------------
+                ScopedMarker(ScratchAllocator& in_allocator) noexcept;
+                //------------------------------------------------------------------------------
+                /// Rewinds the allocator to the marker.
+                //------------------------------------------------------------------------------
+                ~ScopedMarker() noexcept;
+                
+            private:
+                ScratchAllocator& m_allocator;
+                Marker m_marker;
+            };
+            //------------------------------------------------------------------------------
+            /// Creates a new scratch allocator, allocating pages from the global heap.
+            ///
+            /// @param in_pageSize - [Optional] The size of each page.
+            //------------------------------------------------------------------------------
+            ScratchAllocator(std::size_t in_pageSize = k_defaultPageSize) noexcept;
+            //------------------------------------------------------------------------------
+            /// Creates a new scratch allocator, allocating pages from the given allocator.
+            ///
+            /// @param in_backingAllocator - The allocator pages are allocated from. Must
+            /// outlive this.
+            /// @param in_pageSize - [Optional] The size of each page.
+            //------------------------------------------------------------------------------
+            ScratchAllocator(CS::IAllocator& in_backingAllocator, std::size_t in_pageSize = k_defaultPageSize) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The page size.
+            //------------------------------------------------------------------------------
+            std::size_t GetMaxAllocationSize() const noexcept override;
+            //------------------------------------------------------------------------------
+            /// @return The size of each page.
+            //------------------------------------------------------------------------------
+            std::size_t GetPageSize() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of pages currently held, including any retained after
+            /// a reset.
+            //------------------------------------------------------------------------------
+            std::size_t GetNumPages() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Allocates from the current page, moving to the next page if the current
+            /// one doesn't have enough space.
+            ///
+            /// @param in_allocationSize - The size of the allocation.
+            ///
+            /// @return The allocated memory.
+            //------------------------------------------------------------------------------
+            void* Allocate(std::size_t in_allocationSize) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Records that an allocation is no longer in use. The memory is not
+            /// reclaimed until the allocator is rewound or reset.
+            ///
+            /// @param in_pointer - The memory to deallocate.
+            //------------------------------------------------------------------------------
+            void Deallocate(void* in_pointer) noexcept override;
+            //------------------------------------------------------------------------------
+            /// @return A marker at the current position of the allocator.
+            //------------------------------------------------------------------------------
+            Marker GetMarker() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Rewinds the allocator to the given marker, releasing any pages acquired
+            /// after it. Every allocation made since the marker was captured must have
+            /// been deallocated.
+            ///
+            /// Only the number of active allocations is checked, so this asserts if
+            /// there are more active allocations than when the marker was captured.
+            /// An allocation made after the marker which is still active isn't
+            /// detected if an allocation made before it has since been deallocated.
+            ///
+            /// @param in_marker - The marker to rewind to.
+            //------------------------------------------------------------------------------
+            void Rewind(const Marker& in_marker) noexcept;
+            //------------------------------------------------------------------------------
+            /// Rewinds the allocator to the start, retaining all pages. All allocations
+            /// must have been deallocated.
+            //------------------------------------------------------------------------------
+            void Reset() noexcept;
+            //------------------------------------------------------------------------------
+            /// Rewinds the allocator to the start, releasing all but the first page. All
+            /// allocations must have been deallocated.
+            //------------------------------------------------------------------------------
+            void ResetAndShrink() noexcept;
+            //------------------------------------------------------------------------------
+            /// Releases all pages. All allocations must have been deallocated.
+            //------------------------------------------------------------------------------
+            ~ScratchAllocator() noexcept;
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// @return A new page, allocated from the backing allocator or global heap.
+            //------------------------------------------------------------------------------
+            u8* CreatePage() noexcept;
+            //------------------------------------------------------------------------------
+            /// Releases all pages after the given number.
+            ///
+            /// @param in_numPages - The number of pages to keep.
+            //------------------------------------------------------------------------------
+            void ReleasePages(std::size_t in_numPages) noexcept;
+            
+            CS::IAllocator* m_backingAllocator = nullptr;
+            const std::size_t m_pageSize;
+            std::vector<u8*> m_pages;
+            u32 m_pageIndex = 0;
+            std::size_t m_offset = 0;
+            u32 m_numActiveAllocations = 0;
+        };
+    }
+}
+
+#endif
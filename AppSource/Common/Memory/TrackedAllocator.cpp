@@ -0,0 +1,177 @@
+//
+//  TrackedAllocator.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Memory/TrackedAllocator.h>
+
+#include <Common/Memory/AllocatorRegistry.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <algorithm>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        constexpr u32 TrackedAllocator::k_maxPageHistory;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TrackedAllocator::TrackedAllocator(const std::string& in_name, CS::IAllocator& in_allocator) noexcept
+            : TrackedAllocator(in_name, in_allocator, []() noexcept { return Reservation(); })
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TrackedAllocator::TrackedAllocator(const std::string& in_name, CS::LinearAllocator& in_allocator) noexcept
+            : TrackedAllocator(in_name, in_allocator, [&in_allocator]() noexcept
+            {
+                Reservation reservation;
+                reservation.m_reservedBytes = in_allocator.GetBufferSize() - in_allocator.GetFreeSpace();
+                return reservation;
+            })
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TrackedAllocator::TrackedAllocator(const std::string& in_name, CS::PagedLinearAllocator& in_allocator) noexcept
+            : TrackedAllocator(in_name, in_allocator, [&in_allocator]() noexcept
+            {
+                Reservation reservation;
+                reservation.m_numPages = u32(in_allocator.GetNumPages());
+                reservation.m_reservedBytes = u64(in_allocator.GetNumPages()) * u64(in_allocator.GetPageSize());
+                return reservation;
+            })
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TrackedAllocator::TrackedAllocator(const std::string& in_name, CS::IAllocator& in_allocator, const ReservationDelegate& in_reservationDelegate) noexcept
+            : m_name(in_name), m_allocator(in_allocator), m_reservationDelegate(in_reservationDelegate)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            UpdateReservation();
+            lock.unlock();
+            
+            auto application = CS::Application::Get();
+            if (application)
+            {
+                m_registry = application->GetSystem<AllocatorRegistry>();
+                if (m_registry)
+                {
+                    m_registry->Add(this);
+                }
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& TrackedAllocator::GetName() const noexcept
+        {
+            return m_name;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::size_t TrackedAllocator::GetMaxAllocationSize() const noexcept
+        {
+            return m_allocator.GetMaxAllocationSize();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void* TrackedAllocator::Allocate(std::size_t in_allocationSize) noexcept
+        {
+            auto pointer = m_allocator.Allocate(in_allocationSize);
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_allocationSizes.emplace(pointer, in_allocationSize);
+            ++m_numAllocations;
+            m_bytesInUse += in_allocationSize;
+            UpdateReservation();
+            
+            if (m_bytesInUse > m_peakBytesInUse)
+            {
+                m_peakBytesInUse = m_bytesInUse;
+                m_peakWastedBytes = (m_reservation.m_reservedBytes > m_bytesInUse) ? m_reservation.m_reservedBytes - m_bytesInUse : 0;
+                m_peakUsageNumPages = m_reservation.m_numPages;
+            }
+            
+            return pointer;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TrackedAllocator::Deallocate(void* in_pointer) noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto it = m_allocationSizes.find(in_pointer);
+            CS_ASSERT(it != m_allocationSizes.end(), "Pointer was not allocated from this allocator.");
+            
+            ++m_numDeallocations;
+            m_bytesInUse -= it->second;
+            m_allocationSizes.erase(it);
+            lock.unlock();
+            
+            m_allocator.Deallocate(in_pointer);
+            
+            lock.lock();
+            UpdateReservation();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AllocatorStats TrackedAllocator::GetStats() const noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            std::vector<u32> pageHistory(m_pageHistory.begin(), m_pageHistory.end());
+            return AllocatorStats(m_name, m_numAllocations, m_numDeallocations, m_bytesInUse, m_peakBytesInUse, m_reservation.m_reservedBytes, m_peakWastedBytes,
+                                  m_peakUsageNumPages, m_reservation.m_numPages, m_peakNumPages, pageHistory);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TrackedAllocator::UpdateReservation() noexcept
+        {
+            m_reservation = m_reservationDelegate();
+            m_peakNumPages = std::max(m_peakNumPages, m_reservation.m_numPages);
+            
+            if (m_reservation.m_numPages > 0 && (m_pageHistory.empty() || m_pageHistory.back() != m_reservation.m_numPages))
+            {
+                m_pageHistory.push_back(m_reservation.m_numPages);
+                if (m_pageHistory.size() > k_maxPageHistory)
+                {
+                    m_pageHistory.pop_front();
+                }
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TrackedAllocator::~TrackedAllocator() noexcept
+        {
+            if (m_registry)
+            {
+                m_registry->Remove(this);
+            }
+        }
+    }
+}
@@ -0,0 +1,170 @@
+//
+//  TrackedAllocator.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_MEMORY_TRACKEDALLOCATOR_H_
+#define _COMMON_MEMORY_TRACKEDALLOCATOR_H_
+
+#include <CSTest.h>
+
+#include <Common/Memory/AllocatorStats.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An allocator which records the usage of another, under a name. Allocations
+        /// should be made through the tracked allocator, rather than directly from the
+        /// allocator it wraps, but the wrapped allocator can still be reset directly.
+        ///
+        /// If an AllocatorRegistry exists, the tracked allocator is added to it for the
+        /// duration of its lifetime so its stats can be queried by name.
+        ///
+        /// The size of each live allocation is recorded, so tracking adds the cost of a
+        /// lock and a hash map insertion to every allocation. It is intended for
+        /// diagnostics rather than for permanent use.
+        ///
+        /// This is thread-safe provided the wrapped allocator is, though the stats can
+        /// always be read from any thread.
+        //------------------------------------------------------------------------------
+        class TrackedAllocator final : public CS::IAllocator
+        {
+        public:
+            CS_DECLARE_NOCOPY(TrackedAllocator);
+            
+            static constexpr u32 k_maxPageHistory = 64;
+            //------------------------------------------------------------------------------
+            /// Tracks an allocator of any type. Only allocation counts and bytes in use
+            /// are recorded.
+            ///
+            /// @param in_name - The name of the allocator.
+            /// @param in_allocator - The allocator to track. Must outlive this.
+            //------------------------------------------------------------------------------
+            TrackedAllocator(const std::string& in_name, CS::IAllocator& in_allocator) noexcept;
+            //------------------------------------------------------------------------------
+            /// Tracks a linear allocator, additionally recording the consumed portion of
+            /// its buffer as reserved bytes.
+            ///
+            /// @param in_name - The name of the allocator.
+            /// @param in_allocator - The allocator to track. Must outlive this.
+            //------------------------------------------------------------------------------
+            TrackedAllocator(const std::string& in_name, CS::LinearAllocator& in_allocator) noexcept;
+            //------------------------------------------------------------------------------
+            /// Tracks a paged linear allocator, additionally recording its pages as
+            /// reserved bytes along with the history of its page count.
+            ///
+            /// @param in_name - The name of the allocator.
+            /// @param in_allocator - The allocator to track. Must outlive this.
+            //------------------------------------------------------------------------------
+            TrackedAllocator(const std::string& in_name, CS::PagedLinearAllocator& in_allocator) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the allocator.
+            //------------------------------------------------------------------------------
+            const std::string& GetName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The max allocation size of the wrapped allocator.
+            //------------------------------------------------------------------------------
+            std::size_t GetMaxAllocationSize() const noexcept override;
+            //------------------------------------------------------------------------------
+            /// Allocates from the wrapped allocator, recording the allocation.
+            ///
+            /// @param in_allocationSize - The size of the allocation.
+            ///
+            /// @return The allocated memory.
+            //------------------------------------------------------------------------------
+            void* Allocate(std::size_t in_allocationSize) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Deallocates from the wrapped allocator, recording the deallocation.
+            ///
+            /// @param in_pointer - The memory to deallocate.
+            //------------------------------------------------------------------------------
+            void Deallocate(void* in_pointer) noexcept override;
+            //------------------------------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @return A snapshot of the allocator's usage. The reserved bytes and page
+            /// count are as of the last allocation or deallocation.
+            //------------------------------------------------------------------------------
+            AllocatorStats GetStats() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Removes the allocator from the registry.
+            //------------------------------------------------------------------------------
+            ~TrackedAllocator() noexcept;
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// The memory reserved by the wrapped allocator.
+            //------------------------------------------------------------------------------
+            struct Reservation final
+            {
+                u64 m_reservedBytes = 0;
+                u32 m_numPages = 0;
+            };
+            
+            using ReservationDelegate = std::function<Reservation() noexcept>;
+            //------------------------------------------------------------------------------
+            /// @param in_name - The name of the allocator.
+            /// @param in_allocator - The allocator to track.
+            /// @param in_reservationDelegate - Reads the memory reserved by the allocator.
+            /// This is only called on a thread which is using the allocator.
+            //------------------------------------------------------------------------------
+            TrackedAllocator(const std::string& in_name, CS::IAllocator& in_allocator, const ReservationDelegate& in_reservationDelegate) noexcept;
+            //------------------------------------------------------------------------------
+            /// Reads the memory reserved by the wrapped allocator, updating the page
+            /// history and peaks. The mutex must be locked.
+            //------------------------------------------------------------------------------
+            void UpdateReservation() noexcept;
+            
+            const std::string m_name;
+            CS::IAllocator& m_allocator;
+            const ReservationDelegate m_reservationDelegate;
+            AllocatorRegistry* m_registry = nullptr;
+            
+            mutable std::mutex m_mutex;
+            std::unordered_map<void*, std::size_t> m_allocationSizes;
+            u64 m_numAllocations = 0;
+            u64 m_numDeallocations = 0;
+            u64 m_bytesInUse = 0;
+            u64 m_peakBytesInUse = 0;
+            Reservation m_reservation;
+            u64 m_peakWastedBytes = 0;
+            u32 m_peakUsageNumPages = 0;
+            u32 m_peakNumPages = 0;
+            std::deque<u32> m_pageHistory;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,59 @@
+//
+//  AllocationStats.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/AllocationStats.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AllocationStats::AllocationStats(u64 in_numAllocations, u64 in_numBytes, u64 in_peakLiveBytes) noexcept
+            : m_numAllocations(in_numAllocations), m_numBytes(in_numBytes), m_peakLiveBytes(in_peakLiveBytes)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocationStats::GetNumAllocations() const noexcept
+        {
+            return m_numAllocations;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocationStats::GetNumBytes() const noexcept
+        {
+            return m_numBytes;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocationStats::GetPeakLiveBytes() const noexcept
+        {
+            return m_peakLiveBytes;
+        }
+    }
+}
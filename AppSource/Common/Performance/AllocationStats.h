@@ -0,0 +1,80 @@
+//
+//  AllocationStats.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_PERFORMANCE_ALLOCATIONSTATS_H_
+#define _COMMON_PERFORMANCE_ALLOCATIONSTATS_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An immutable container for the heap allocations made while a test was
+        /// running, as recorded by an AllocationTracker.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class AllocationStats final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// Constructs an empty instance, describing no allocations.
+            //------------------------------------------------------------------------------
+            AllocationStats() = default;
+            //------------------------------------------------------------------------------
+            /// @param in_numAllocations - The number of allocations made.
+            /// @param in_numBytes - The total number of bytes allocated.
+            /// @param in_peakLiveBytes - The highest number of bytes which were live at
+            /// once, above the number which were live when tracking began.
+            //------------------------------------------------------------------------------
+            AllocationStats(u64 in_numAllocations, u64 in_numBytes, u64 in_peakLiveBytes) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of allocations made.
+            //------------------------------------------------------------------------------
+            u64 GetNumAllocations() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The total number of bytes allocated. This counts every allocation,
+            /// including those which have since been freed.
+            //------------------------------------------------------------------------------
+            u64 GetNumBytes() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The highest number of bytes which were live at once, above the
+            /// number which were live when tracking began.
+            //------------------------------------------------------------------------------
+            u64 GetPeakLiveBytes() const noexcept;
+            
+        private:
+            u64 m_numAllocations = 0;
+            u64 m_numBytes = 0;
+            u64 m_peakLiveBytes = 0;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,325 @@
+//
+//  AllocationTracker.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/AllocationTracker.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            std::atomic<u64> g_numAllocations(0);
+            std::atomic<u64> g_numBytes(0);
+            std::atomic<u64> g_liveBytes(0);
+            std::atomic<u64> g_peakLiveBytes(0);
+            
+#ifdef CSTEST_ENABLE_ALLOCATION_TRACKING
+            // Each allocation is prefixed with its size so that it can be subtracted from the live bytes when freed. The header
+            // is padded to the maximum alignment so that the returned pointer is as aligned as one returned by malloc.
+            constexpr std::size_t k_headerSize = alignof(std::max_align_t);
+            
+            //------------------------------------------------------------------------------
+            /// The header which precedes over-aligned allocations. As the offset from the
+            /// start of the block depends on the alignment, the block itself is stored
+            /// along with the size.
+            //------------------------------------------------------------------------------
+            struct AlignedHeader final
+            {
+                void* m_block;
+                std::size_t m_size;
+            };
+            
+            //------------------------------------------------------------------------------
+            /// Raises the peak live bytes to the given value if it is higher.
+            ///
+            /// @param in_liveBytes - The current number of live bytes.
+            //------------------------------------------------------------------------------
+            void UpdatePeakLiveBytes(u64 in_liveBytes) noexcept
+            {
+                auto peakLiveBytes = g_peakLiveBytes.load(std::memory_order_relaxed);
+                while (in_liveBytes > peakLiveBytes && !g_peakLiveBytes.compare_exchange_weak(peakLiveBytes, in_liveBytes, std::memory_order_relaxed))
+                {
+                }
+            }
+            //------------------------------------------------------------------------------
+            /// Records an allocation of the given size.
+            ///
+            /// @param in_size - The number of bytes allocated.
+            //------------------------------------------------------------------------------
+            void RecordAllocation(std::size_t in_size) noexcept
+            {
+                g_numAllocations.fetch_add(1, std::memory_order_relaxed);
+                g_numBytes.fetch_add(in_size, std::memory_order_relaxed);
+                UpdatePeakLiveBytes(g_liveBytes.fetch_add(in_size, std::memory_order_relaxed) + in_size);
+            }
+            //------------------------------------------------------------------------------
+            /// Allocates a block of memory with a size header, and records it.
+            ///
+            /// @param in_size - The number of bytes requested.
+            ///
+            /// @return The allocated memory, or null if the allocation failed.
+            //------------------------------------------------------------------------------
+            void* TrackedAllocate(std::size_t in_size) noexcept
+            {
+                auto block = static_cast<u8*>(std::malloc(in_size + k_headerSize));
+                if (!block)
+                {
+                    return nullptr;
+                }
+                
+                *reinterpret_cast<std::size_t*>(block) = in_size;
+                RecordAllocation(in_size);
+                
+                return block + k_headerSize;
+            }
+            //------------------------------------------------------------------------------
+            /// Allocates a block of memory with the given alignment, preceded by an
+            /// AlignedHeader, and records it.
+            ///
+            /// @param in_size - The number of bytes requested.
+            /// @param in_alignment - The alignment of the memory. Must be a power of two.
+            ///
+            /// @return The allocated memory, or null if the allocation failed.
+            //------------------------------------------------------------------------------
+            void* TrackedAllocateAligned(std::size_t in_size, std::size_t in_alignment) noexcept
+            {
+                auto block = static_cast<u8*>(std::malloc(in_size + in_alignment + sizeof(AlignedHeader)));
+                if (!block)
+                {
+                    return nullptr;
+                }
+                
+                auto address = (reinterpret_cast<std::uintptr_t>(block) + sizeof(AlignedHeader) + in_alignment - 1) & ~std::uintptr_t(in_alignment - 1);
+                auto memory = reinterpret_cast<u8*>(address);
+                
+                auto header = reinterpret_cast<AlignedHeader*>(memory - sizeof(AlignedHeader));
+                header->m_block = block;
+                header->m_size = in_size;
+                RecordAllocation(in_size);
+                
+                return memory;
+            }
+            //------------------------------------------------------------------------------
+            /// Allocates memory as operator new requires; calling the new handler until
+            /// the allocation succeeds, and throwing if there is no new handler.
+            ///
+            /// @param in_size - The number of bytes requested.
+            /// @param in_alignment - [Optional] The alignment of the memory, which must be
+            /// freed with TrackedDeallocateAligned(). If zero the memory is allocated with
+            /// TrackedAllocate() instead.
+            ///
+            /// @return The allocated memory.
+            //------------------------------------------------------------------------------
+            void* TrackedAllocateOrThrow(std::size_t in_size, std::size_t in_alignment = 0)
+            {
+                while (true)
+                {
+                    auto memory = (in_alignment == 0) ? TrackedAllocate(in_size) : TrackedAllocateAligned(in_size, in_alignment);
+                    if (memory)
+                    {
+                        return memory;
+                    }
+                    
+                    auto newHandler = std::get_new_handler();
+                    if (!newHandler)
+                    {
+                        throw std::bad_alloc();
+                    }
+                    
+                    newHandler();
+                }
+            }
+            //------------------------------------------------------------------------------
+            /// Frees memory allocated with TrackedAllocate(), and records it.
+            ///
+            /// @param in_memory - The memory to free. Can be null.
+            //------------------------------------------------------------------------------
+            void TrackedDeallocate(void* in_memory) noexcept
+            {
+                if (!in_memory)
+                {
+                    return;
+                }
+                
+                auto block = static_cast<u8*>(in_memory) - k_headerSize;
+                g_liveBytes.fetch_sub(*reinterpret_cast<std::size_t*>(block), std::memory_order_relaxed);
+                
+                std::free(block);
+            }
+            //------------------------------------------------------------------------------
+            /// Frees memory allocated with TrackedAllocateAligned(), and records it.
+            ///
+            /// @param in_memory - The memory to free. Can be null.
+            //------------------------------------------------------------------------------
+            void TrackedDeallocateAligned(void* in_memory) noexcept
+            {
+                if (!in_memory)
+                {
+                    return;
+                }
+                
+                auto header = reinterpret_cast<AlignedHeader*>(static_cast<u8*>(in_memory) - sizeof(AlignedHeader));
+                g_liveBytes.fetch_sub(header->m_size, std::memory_order_relaxed);
+                
+                std::free(header->m_block);
+            }
+#endif
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool AllocationTracker::IsEnabled() noexcept
+        {
+#ifdef CSTEST_ENABLE_ALLOCATION_TRACKING
+            return true;
+#else
+            return false;
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 AllocationTracker::GetTotalNumAllocations() noexcept
+        {
+            return g_numAllocations.load();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AllocationTracker::AllocationTracker() noexcept
+            : m_startNumAllocations(g_numAllocations.load()), m_startNumBytes(g_numBytes.load()), m_startLiveBytes(g_liveBytes.load())
+        {
+            g_peakLiveBytes.store(m_startLiveBytes);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AllocationStats AllocationTracker::GetStats() const noexcept
+        {
+            auto peakLiveBytes = g_peakLiveBytes.load();
+            
+            return AllocationStats(g_numAllocations.load() - m_startNumAllocations, g_numBytes.load() - m_startNumBytes, (peakLiveBytes > m_startLiveBytes) ? peakLiveBytes - m_startLiveBytes : 0);
+        }
+    }
+}
+
+#ifdef CSTEST_ENABLE_ALLOCATION_TRACKING
+
+//------------------------------------------------------------------------------
+// Replacements for the global allocation functions. Every form must be replaced,
+// as memory from the tracked allocator can't be freed by the default one. The
+// over-aligned forms only exist from C++17.
+//------------------------------------------------------------------------------
+void* operator new(std::size_t in_size)
+{
+    return CSTest::Common::TrackedAllocateOrThrow(in_size);
+}
+void* operator new[](std::size_t in_size)
+{
+    return CSTest::Common::TrackedAllocateOrThrow(in_size);
+}
+void* operator new(std::size_t in_size, const std::nothrow_t&) noexcept
+{
+    return CSTest::Common::TrackedAllocate(in_size);
+}
+void* operator new[](std::size_t in_size, const std::nothrow_t&) noexcept
+{
+    return CSTest::Common::TrackedAllocate(in_size);
+}
+void operator delete(void* in_memory) noexcept
+{
+    CSTest::Common::TrackedDeallocate(in_memory);
+}
+void operator delete[](void* in_memory) noexcept
+{
+    CSTest::Common::TrackedDeallocate(in_memory);
+}
+void operator delete(void* in_memory, const std::nothrow_t&) noexcept
+{
+    CSTest::Common::TrackedDeallocate(in_memory);
+}
+void operator delete[](void* in_memory, const std::nothrow_t&) noexcept
+{
+    CSTest::Common::TrackedDeallocate(in_memory);
+}
+void operator delete(void* in_memory, std::size_t) noexcept
+{
+    CSTest::Common::TrackedDeallocate(in_memory);
+}
+void operator delete[](void* in_memory, std::size_t) noexcept
+{
+    CSTest::Common::TrackedDeallocate(in_memory);
+}
+
+#ifdef __cpp_aligned_new
+void* operator new(std::size_t in_size, std::align_val_t in_alignment)
+{
+    return CSTest::Common::TrackedAllocateOrThrow(in_size, std::size_t(in_alignment));
+}
+void* operator new[](std::size_t in_size, std::align_val_t in_alignment)
+{
+    return CSTest::Common::TrackedAllocateOrThrow(in_size, std::size_t(in_alignment));
+}
+void* operator new(std::size_t in_size, std::align_val_t in_alignment, const std::nothrow_t&) noexcept
+{
+    return CSTest::Common::TrackedAllocateAligned(in_size, std::size_t(in_alignment));
+}
+void* operator new[](std::size_t in_size, std::align_val_t in_alignment, const std::nothrow_t&) noexcept
+{
+    return CSTest::Common::TrackedAllocateAligned(in_size, std::size_t(in_alignment));
+}
+void operator delete(void* in_memory, std::align_val_t) noexcept
+{
+    CSTest::Common::TrackedDeallocateAligned(in_memory);
+}
+void operator delete[](void* in_memory, std::align_val_t) noexcept
+{
+    CSTest::Common::TrackedDeallocateAligned(in_memory);
+}
+void operator delete(void* in_memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    CSTest::Common::TrackedDeallocateAligned(in_memory);
+}
+void operator delete[](void* in_memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    CSTest::Common::TrackedDeallocateAligned(in_memory);
+}
+void operator delete(void* in_memory, std::size_t, std::align_val_t) noexcept
+{
+    CSTest::Common::TrackedDeallocateAligned(in_memory);
+}
+void operator delete[](void* in_memory, std::size_t, std::align_val_t) noexcept
+{
+    CSTest::Common::TrackedDeallocateAligned(in_memory);
+}
+#endif
+
+#endif
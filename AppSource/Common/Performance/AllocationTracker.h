@@ -0,0 +1,88 @@
+//
+//  AllocationTracker.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_PERFORMANCE_ALLOCATIONTRACKER_H_
+#define _COMMON_PERFORMANCE_ALLOCATIONTRACKER_H_
+
+#include <CSTest.h>
+
+#include <Common/Performance/AllocationStats.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Measures the heap allocations made between the tracker being constructed
+        /// and the stats being read.
+        ///
+        /// Allocations are counted by replacing the global operator new and operator
+        /// delete, which is only done if the app is built with the
+        /// CSTEST_ENABLE_ALLOCATION_TRACKING preprocessor flag. Every project defines
+        /// it when CSTEST_ALLOCATION_TRACKING=1 is set in the environment or passed as
+        /// an MSBuild or xcodebuild property. Without it the allocators are untouched
+        /// and all stats are zero.
+        ///
+        /// The counters are global, so every allocation made by the process while the
+        /// tracker is active is included, regardless of which thread made it. Only
+        /// one tracker should be active at a time, as constructing a tracker resets
+        /// the peak live bytes.
+        ///
+        /// This is thread-safe.
+        //------------------------------------------------------------------------------
+        class AllocationTracker final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @return Whether or not the global allocation hooks are compiled in.
+            //------------------------------------------------------------------------------
+            static bool IsEnabled() noexcept;
+            //------------------------------------------------------------------------------
+            /// Unlike constructing a tracker, this doesn't affect any active tracker, so
+            /// can be used to count the allocations made by part of a tracked test.
+            ///
+            /// @return The number of allocations made by the process since it started.
+            //------------------------------------------------------------------------------
+            static u64 GetTotalNumAllocations() noexcept;
+            //------------------------------------------------------------------------------
+            /// Begins tracking allocations.
+            //------------------------------------------------------------------------------
+            AllocationTracker() noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The allocations made since the tracker was constructed.
+            //------------------------------------------------------------------------------
+            AllocationStats GetStats() const noexcept;
+            
+        private:
+            u64 m_startNumAllocations;
+            u64 m_startNumBytes;
+            u64 m_startLiveBytes;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,321 @@
+//
+//  PerformanceBaseline.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/PerformanceBaseline.h>
+
+#include <IntegrationTest/TestSystem/Report.h>
+#include <UnitTest/TestSystem/Report.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+#include <ChilliSource/Core/Json.h>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            constexpr char k_versionKey[] = "Version";
+            constexpr char k_entriesKey[] = "Entries";
+            constexpr u32 k_version = 1;
+            
+            //------------------------------------------------------------------------------
+            /// @param in_values - The values. Must not be empty.
+            ///
+            /// @return The median of the given values.
+            //------------------------------------------------------------------------------
+            f32 CalcMedian(std::vector<f32> in_values) noexcept
+            {
+                CS_ASSERT(!in_values.empty(), "Cannot calculate the median of no values.");
+                
+                std::sort(in_values.begin(), in_values.end());
+                
+                auto middle = in_values.size() / 2;
+                return (in_values.size() % 2 == 0) ? (in_values[middle - 1] + in_values[middle]) * 0.5f : in_values[middle];
+            }
+        }
+        
+        constexpr char PerformanceBaseline::k_integrationTestSuite[];
+        constexpr char PerformanceBaseline::k_unitTestSuite[];
+        constexpr char PerformanceBaseline::k_durationMetric[];
+        constexpr char PerformanceBaseline::k_medianMetric[];
+        constexpr char PerformanceBaseline::k_p95Metric[];
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string PerformanceBaseline::CreateKey(const std::string& in_suiteName, const std::string& in_testCaseName, const std::string& in_testName) noexcept
+        {
+            CS_ASSERT(!in_suiteName.empty(), "A suite name must be supplied.");
+            CS_ASSERT(!in_testCaseName.empty(), "A test case name must be supplied.");
+            
+            auto key = in_suiteName + "/" + in_testCaseName;
+            if (!in_testName.empty())
+            {
+                key += "/" + in_testName;
+            }
+            
+            return key;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PerformanceBaseline::FromJson(const std::string& in_json, PerformanceBaseline& out_baseline) noexcept
+        {
+            Json::Value root;
+            Json::Reader reader;
+            if (!reader.parse(in_json, root) || !root.isObject())
+            {
+                return false;
+            }
+            
+            if (root.get(k_versionKey, 0).asUInt() != k_version)
+            {
+                CS_LOG_WARNING("Performance baseline has an unsupported version.");
+                return false;
+            }
+            
+            PerformanceBaseline baseline;
+            
+            const auto& entries = root[k_entriesKey];
+            if (entries.isObject())
+            {
+                for (const auto& key : entries.getMemberNames())
+                {
+                    const auto& metrics = entries[key];
+                    if (!metrics.isObject())
+                    {
+                        continue;
+                    }
+                    
+                    for (const auto& metricName : metrics.getMemberNames())
+                    {
+                        if (metrics[metricName].isNumeric())
+                        {
+                            baseline.SetMetric(key, metricName, f32(metrics[metricName].asDouble()));
+                        }
+                    }
+                }
+            }
+            
+            out_baseline = std::move(baseline);
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceBaseline PerformanceBaseline::FromReport(const IntegrationTest::Report& in_report) noexcept
+        {
+            std::map<std::string, std::map<std::string, std::vector<f32>>> runValues;
+            
+            for (const auto& testResult : in_report.GetTestResults())
+            {
+                if (!testResult.HasPassed())
+                {
+                    continue;
+                }
+                
+                auto key = CreateKey(k_integrationTestSuite, testResult.GetDesc().GetTestCaseName(), testResult.GetDesc().GetTestName());
+                auto& metrics = runValues[key];
+                metrics[k_durationMetric].push_back(testResult.GetDurationSeconds());
+                
+                if (testResult.HasBenchmarkStats())
+                {
+                    metrics[k_medianMetric].push_back(testResult.GetBenchmarkStats().GetMedianSeconds());
+                    metrics[k_p95Metric].push_back(testResult.GetBenchmarkStats().GetP95Seconds());
+                }
+            }
+            
+            PerformanceBaseline baseline;
+            for (const auto& entry : runValues)
+            {
+                for (const auto& metric : entry.second)
+                {
+                    baseline.SetMetric(entry.first, metric.first, CalcMedian(metric.second));
+                }
+            }
+            
+            return baseline;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceBaseline PerformanceBaseline::FromReport(const UnitTest::Report& in_report) noexcept
+        {
+            PerformanceBaseline baseline;
+            
+            for (const auto& testCaseResult : in_report.GetTestCaseResults())
+            {
+                if (testCaseResult.HasPassed())
+                {
+                    auto key = CreateKey(k_unitTestSuite, testCaseResult.GetName(), "");
+                    baseline.SetMetric(key, k_durationMetric, testCaseResult.GetDurationSeconds());
+                    
+                    for (const auto& benchmarkResult : testCaseResult.GetBenchmarkResults())
+                    {
+                        auto benchmarkKey = CreateKey(k_unitTestSuite, testCaseResult.GetName(), benchmarkResult.GetName());
+                        baseline.SetMetric(benchmarkKey, k_medianMetric, benchmarkResult.GetMedianSeconds());
+                    }
+                    
+                    for (const auto& sectionResult : testCaseResult.GetSectionResults())
+                    {
+                        auto sectionKey = CreateKey(k_unitTestSuite, testCaseResult.GetName(), sectionResult.GetName());
+                        baseline.SetMetric(sectionKey, k_durationMetric, sectionResult.GetDurationSeconds());
+                    }
+                }
+            }
+            
+            return baseline;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PerformanceBaseline::Load(CS::StorageLocation in_storageLocation, const std::string& in_filePath, PerformanceBaseline& out_baseline) noexcept
+        {
+            auto fileSystem = CS::Application::Get()->GetFileSystem();
+            
+            std::string contents;
+            if (!fileSystem->ReadFile(in_storageLocation, in_filePath, contents))
+            {
+                return false;
+            }
+            
+            return FromJson(contents, out_baseline);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void PerformanceBaseline::SetMetric(const std::string& in_key, const std::string& in_metricName, f32 in_value) noexcept
+        {
+            m_entries[in_key][in_metricName] = in_value;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PerformanceBaseline::TryGetMetric(const std::string& in_key, const std::string& in_metricName, f32& out_value) const noexcept
+        {
+            auto entryIt = m_entries.find(in_key);
+            if (entryIt == m_entries.end())
+            {
+                return false;
+            }
+            
+            auto metricIt = entryIt->second.find(in_metricName);
+            if (metricIt == entryIt->second.end())
+            {
+                return false;
+            }
+            
+            out_value = metricIt->second;
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PerformanceBaseline::IsEmpty() const noexcept
+        {
+            return m_entries.empty();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 PerformanceBaseline::AddMissingMetrics(const PerformanceBaseline& in_baseline) noexcept
+        {
+            u32 numAdded = 0;
+            
+            for (const auto& entry : in_baseline.m_entries)
+            {
+                auto& metrics = m_entries[entry.first];
+                
+                for (const auto& metric : entry.second)
+                {
+                    if (metrics.find(metric.first) == metrics.end())
+                    {
+                        metrics.insert(metric);
+                        ++numAdded;
+                    }
+                }
+            }
+            
+            return numAdded;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<PerformanceRegression> PerformanceBaseline::FindRegressions(const PerformanceBaseline& in_current, f32 in_tolerance, f32 in_minSeconds) const noexcept
+        {
+            CS_ASSERT(in_tolerance >= 0.0f, "The tolerance cannot be negative.");
+            
+            std::vector<PerformanceRegression> regressions;
+            
+            for (const auto& entry : in_current.m_entries)
+            {
+                for (const auto& metric : entry.second)
+                {
+                    f32 baselineValue = 0.0f;
+                    if (TryGetMetric(entry.first, metric.first, baselineValue) && baselineValue >= in_minSeconds && baselineValue > 0.0f && metric.second > baselineValue * (1.0f + in_tolerance))
+                    {
+                        regressions.push_back(PerformanceRegression(entry.first, metric.first, baselineValue, metric.second));
+                    }
+                }
+            }
+            
+            return regressions;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string PerformanceBaseline::ToJson() const noexcept
+        {
+            Json::Value entries(Json::objectValue);
+            for (const auto& entry : m_entries)
+            {
+                Json::Value metrics(Json::objectValue);
+                for (const auto& metric : entry.second)
+                {
+                    metrics[metric.first] = f64(metric.second);
+                }
+                
+                entries[entry.first] = metrics;
+            }
+            
+            Json::Value root(Json::objectValue);
+            root[k_versionKey] = k_version;
+            root[k_entriesKey] = entries;
+            
+            return root.toStyledString();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PerformanceBaseline::Save(CS::StorageLocation in_storageLocation, const std::string& in_filePath) const noexcept
+        {
+            auto fileSystem = CS::Application::Get()->GetFileSystem();
+            
+            auto directoryEnd = in_filePath.find_last_of('/');
+            if (directoryEnd != std::string::npos)
+            {
+                fileSystem->CreateDirectoryPath(in_storageLocation, in_filePath.substr(0, directoryEnd + 1));
+            }
+            
+            return fileSystem->WriteFile(in_storageLocation, in_filePath, ToJson());
+        }
+    }
+}
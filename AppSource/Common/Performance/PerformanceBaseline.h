@@ -0,0 +1,180 @@
+//
+//  PerformanceBaseline.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_PERFORMANCE_PERFORMANCEBASELINE_H_
+#define _COMMON_PERFORMANCE_PERFORMANCEBASELINE_H_
+
+#include <CSTest.h>
+
+#include <Common/Performance/PerformanceRegression.h>
+
+#include <map>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// A set of named performance metrics for each test in a run, keyed by suite,
+        /// test case and test name. The same schema is used for both the unit and
+        /// integration tests. All metrics are durations in seconds, where smaller is
+        /// better.
+        ///
+        /// Baselines can be serialised to and from json, and saved to disk so that
+        /// subsequent runs can be compared against them.
+        ///
+        /// This is not thread-safe.
+        //------------------------------------------------------------------------------
+        class PerformanceBaseline final
+        {
+        public:
+            static constexpr char k_integrationTestSuite[] = "IntegrationTest";
+            static constexpr char k_unitTestSuite[] = "UnitTest";
+            static constexpr char k_durationMetric[] = "DurationSeconds";
+            static constexpr char k_medianMetric[] = "MedianSeconds";
+            static constexpr char k_p95Metric[] = "P95Seconds";
+            //------------------------------------------------------------------------------
+            /// @param in_suiteName - The name of the test suite, i.e. k_unitTestSuite.
+            /// @param in_testCaseName - The name of the test case.
+            /// @param in_testName - The name of the test. This can be empty for suites
+            /// which are only keyed by test case.
+            ///
+            /// @return The key used to identify the given test in a baseline.
+            //------------------------------------------------------------------------------
+            static std::string CreateKey(const std::string& in_suiteName, const std::string& in_testCaseName, const std::string& in_testName) noexcept;
+            //------------------------------------------------------------------------------
+            /// Attempts to parse a baseline from the given json string.
+            ///
+            /// @param in_json - The json string.
+            /// @param out_baseline - [Out] The parsed baseline. This is only set if
+            /// parsing succeeded.
+            ///
+            /// @return Whether or not the baseline was parsed successfully.
+            //------------------------------------------------------------------------------
+            static bool FromJson(const std::string& in_json, PerformanceBaseline& out_baseline) noexcept;
+            //------------------------------------------------------------------------------
+            /// Builds the metrics for the given integration test report. Only tests which
+            /// passed are included, as the timings of failed tests are not meaningful. If
+            /// a test was repeated, the median of each metric across its passing runs is
+            /// used.
+            ///
+            /// @param in_report - The report.
+            ///
+            /// @return The metrics for the report.
+            //------------------------------------------------------------------------------
+            static PerformanceBaseline FromReport(const IntegrationTest::Report& in_report) noexcept;
+            //------------------------------------------------------------------------------
+            /// Builds the metrics for the given unit test report. Only test cases which
+            /// passed are included, as the timings of failed test cases are not
+            /// meaningful. Each benchmark within a test case is keyed by the test case
+            /// and benchmark names, and records the median iteration duration.
+            ///
+            /// @param in_report - The report.
+            ///
+            /// @return The metrics for the report.
+            //------------------------------------------------------------------------------
+            static PerformanceBaseline FromReport(const UnitTest::Report& in_report) noexcept;
+            //------------------------------------------------------------------------------
+            /// Attempts to load a baseline from the given file.
+            ///
+            /// @param in_storageLocation - The storage location of the file.
+            /// @param in_filePath - The file path.
+            /// @param out_baseline - [Out] The loaded baseline. This is only set if
+            /// loading succeeded.
+            ///
+            /// @return Whether or not the baseline was loaded successfully.
+            //------------------------------------------------------------------------------
+            static bool Load(CS::StorageLocation in_storageLocation, const std::string& in_filePath, PerformanceBaseline& out_baseline) noexcept;
+            //------------------------------------------------------------------------------
+            /// Sets the value of the given metric, replacing any existing value.
+            ///
+            /// @param in_key - The key of the test, as created by CreateKey().
+            /// @param in_metricName - The name of the metric.
+            /// @param in_value - The value of the metric in seconds.
+            //------------------------------------------------------------------------------
+            void SetMetric(const std::string& in_key, const std::string& in_metricName, f32 in_value) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_key - The key of the test, as created by CreateKey().
+            /// @param in_metricName - The name of the metric.
+            /// @param out_value - [Out] The value of the metric. This is only set if the
+            /// metric exists.
+            ///
+            /// @return Whether or not the metric exists.
+            //------------------------------------------------------------------------------
+            bool TryGetMetric(const std::string& in_key, const std::string& in_metricName, f32& out_value) const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not the baseline contains any metrics.
+            //------------------------------------------------------------------------------
+            bool IsEmpty() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Adds any metrics in the given baseline which do not already exist in this
+            /// one. Existing metrics are never changed.
+            ///
+            /// @param in_baseline - The baseline to take new metrics from.
+            ///
+            /// @return The number of metrics which were added.
+            //------------------------------------------------------------------------------
+            u32 AddMissingMetrics(const PerformanceBaseline& in_baseline) noexcept;
+            //------------------------------------------------------------------------------
+            /// Compares the given run against this baseline, finding any metrics which
+            /// have increased by more than the given tolerance. Metrics which only exist
+            /// in one of the two are ignored.
+            ///
+            /// @param in_current - The metrics for the current run.
+            /// @param in_tolerance - The fraction by which a metric can increase before
+            /// it is considered a regression, i.e. 0.3 allows a 30% slowdown.
+            /// @param in_minSeconds - Metrics whose baseline value is below this are too
+            /// small to measure reliably and are ignored.
+            ///
+            /// @return The list of regressed metrics.
+            //------------------------------------------------------------------------------
+            std::vector<PerformanceRegression> FindRegressions(const PerformanceBaseline& in_current, f32 in_tolerance, f32 in_minSeconds) const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The baseline as a json string.
+            //------------------------------------------------------------------------------
+            std::string ToJson() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Saves the baseline to the given file as json.
+            ///
+            /// @param in_storageLocation - The storage location of the file. Must be
+            /// writable.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return Whether or not the file was written successfully.
+            //------------------------------------------------------------------------------
+            bool Save(CS::StorageLocation in_storageLocation, const std::string& in_filePath) const noexcept;
+            
+        private:
+            using MetricMap = std::map<std::string, f32>;
+            
+            std::map<std::string, MetricMap> m_entries;
+        };
+    }
+}
+
+#endif
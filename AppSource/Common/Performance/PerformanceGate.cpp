@@ -0,0 +1,146 @@
+//
+//  PerformanceGate.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/PerformanceGate.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        constexpr char PerformanceGate::k_defaultBaselineFilePath[];
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceGate::Result::Result(bool in_passed, const std::vector<PerformanceRegression>& in_regressions) noexcept
+            : m_passed(in_passed), m_regressions(in_regressions)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PerformanceGate::Result::HasPassed() const noexcept
+        {
+            return m_passed;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<PerformanceRegression>& PerformanceGate::Result::GetRegressions() const noexcept
+        {
+            return m_regressions;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceGate::PerformanceGate(Mode in_mode, f32 in_tolerance, f32 in_minSeconds, BaselineUpdate in_baselineUpdate, const std::string& in_baselineFilePath) noexcept
+            : m_mode(in_mode), m_tolerance(in_tolerance), m_minSeconds(in_minSeconds), m_baselineUpdate(in_baselineUpdate), m_baselineFilePath(in_baselineFilePath)
+        {
+            CS_ASSERT(m_tolerance >= 0.0f, "The tolerance cannot be negative.");
+            CS_ASSERT(!m_baselineFilePath.empty(), "A baseline file path must be supplied.");
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceGate::Mode PerformanceGate::GetMode() const noexcept
+        {
+            return m_mode;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 PerformanceGate::GetTolerance() const noexcept
+        {
+            return m_tolerance;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceGate::BaselineUpdate PerformanceGate::GetBaselineUpdate() const noexcept
+        {
+            return m_baselineUpdate;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceGate::Result PerformanceGate::Compare(const PerformanceBaseline& in_baseline, const PerformanceBaseline& in_current) const noexcept
+        {
+            if (m_mode == Mode::k_disabled)
+            {
+                return Result();
+            }
+            
+            auto regressions = in_baseline.FindRegressions(in_current, m_tolerance, m_minSeconds);
+            for (const auto& regression : regressions)
+            {
+                auto message = "Performance regression in " + regression.GetKey() + " " + regression.GetMetricName() + ": " + CS::ToString(regression.GetCurrentValue()) +
+                    "s against a baseline of " + CS::ToString(regression.GetBaselineValue()) + "s (+" + CS::ToString(u32(regression.GetIncrease() * 100.0f)) + "%).";
+                
+                if (m_mode == Mode::k_fail)
+                {
+                    CS_LOG_ERROR(message);
+                }
+                else
+                {
+                    CS_LOG_WARNING(message);
+                }
+            }
+            
+            return Result(m_mode != Mode::k_fail || regressions.empty(), regressions);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceGate::Result PerformanceGate::Evaluate(const PerformanceBaseline& in_current) const noexcept
+        {
+            if (m_mode == Mode::k_disabled || in_current.IsEmpty())
+            {
+                return Result();
+            }
+            
+            PerformanceBaseline baseline;
+            if (!PerformanceBaseline::Load(CS::StorageLocation::k_saveData, m_baselineFilePath, baseline))
+            {
+                if (m_baselineUpdate != BaselineUpdate::k_none)
+                {
+                    CS_LOG_VERBOSE("No performance baseline found; recording the current run as the baseline.");
+                    in_current.Save(CS::StorageLocation::k_saveData, m_baselineFilePath);
+                }
+                return Result();
+            }
+            
+            auto result = Compare(baseline, in_current);
+            
+            if (m_baselineUpdate == BaselineUpdate::k_replace)
+            {
+                auto updatedBaseline = in_current;
+                updatedBaseline.AddMissingMetrics(baseline);
+                updatedBaseline.Save(CS::StorageLocation::k_saveData, m_baselineFilePath);
+            }
+            else if (m_baselineUpdate == BaselineUpdate::k_addMissing && baseline.AddMissingMetrics(in_current) > 0)
+            {
+                baseline.Save(CS::StorageLocation::k_saveData, m_baselineFilePath);
+            }
+            
+            return result;
+        }
+    }
+}
@@ -0,0 +1,168 @@
+//
+//  PerformanceGate.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_PERFORMANCE_PERFORMANCEGATE_H_
+#define _COMMON_PERFORMANCE_PERFORMANCEGATE_H_
+
+#include <CSTest.h>
+
+#include <Common/Performance/PerformanceBaseline.h>
+
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Compares the metrics from a test run against the baseline persisted in
+        /// save data, reporting any metrics which have regressed beyond the
+        /// configured tolerance.
+        ///
+        /// If no baseline exists the current metrics become the baseline. Metrics
+        /// which are new since the baseline was recorded are added to it, but
+        /// existing metrics are never changed so that a series of small slowdowns
+        /// cannot creep past the tolerance. To accept a new baseline the file should
+        /// be deleted, or the gate constructed with BaselineUpdate::k_replace. Sharded
+        /// runs only measure part of the suite so should use BaselineUpdate::k_none.
+        ///
+        /// This is immutable and therefore thread-safe, though Evaluate() accesses the
+        /// file system and should only be called from one thread at a time.
+        //------------------------------------------------------------------------------
+        class PerformanceGate final
+        {
+        public:
+            static constexpr f32 k_defaultTolerance = 0.3f;
+            static constexpr f32 k_defaultMinSeconds = 0.001f;
+            static constexpr char k_defaultBaselineFilePath[] = "Performance/Baseline.json";
+            //------------------------------------------------------------------------------
+            /// The action taken when a regression is found.
+            //------------------------------------------------------------------------------
+            enum class Mode
+            {
+                k_disabled,
+                k_warn,
+                k_fail
+            };
+            //------------------------------------------------------------------------------
+            /// How the persisted baseline is updated after a run has been compared.
+            //------------------------------------------------------------------------------
+            enum class BaselineUpdate
+            {
+                k_none,
+                k_addMissing,
+                k_replace
+            };
+            //------------------------------------------------------------------------------
+            /// The outcome of comparing a run against the baseline.
+            ///
+            /// This is immutable and therefore thread-safe.
+            //------------------------------------------------------------------------------
+            class Result final
+            {
+            public:
+                //------------------------------------------------------------------------------
+                /// Constructs a passing result with no regressions.
+                //------------------------------------------------------------------------------
+                Result() = default;
+                //------------------------------------------------------------------------------
+                /// @param in_passed - Whether or not the run passed the gate.
+                /// @param in_regressions - The list of regressed metrics.
+                //------------------------------------------------------------------------------
+                Result(bool in_passed, const std::vector<PerformanceRegression>& in_regressions) noexcept;
+                //------------------------------------------------------------------------------
+                /// @return Whether or not the run passed the gate. This is only false if the
+                /// gate is in fail mode and at least one metric regressed.
+                //------------------------------------------------------------------------------
+                bool HasPassed() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The list of regressed metrics.
+                //------------------------------------------------------------------------------
+                const std::vector<PerformanceRegression>& GetRegressions() const noexcept;
+                
+            private:
+                bool m_passed = true;
+                std::vector<PerformanceRegression> m_regressions;
+            };
+            //------------------------------------------------------------------------------
+            /// @param in_mode - [Optional] The action taken when a regression is found.
+            /// @param in_tolerance - [Optional] The fraction by which a metric can increase
+            /// before it is considered a regression.
+            /// @param in_minSeconds - [Optional] Metrics whose baseline value is below
+            /// this are ignored.
+            /// @param in_baselineUpdate - [Optional] How the persisted baseline is updated
+            /// after the current run has been compared.
+            /// @param in_baselineFilePath - [Optional] The path to the baseline file in
+            /// save data.
+            //------------------------------------------------------------------------------
+            PerformanceGate(Mode in_mode = Mode::k_warn, f32 in_tolerance = k_defaultTolerance, f32 in_minSeconds = k_defaultMinSeconds, BaselineUpdate in_baselineUpdate = BaselineUpdate::k_addMissing,
+                            const std::string& in_baselineFilePath = k_defaultBaselineFilePath) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The action taken when a regression is found.
+            //------------------------------------------------------------------------------
+            Mode GetMode() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The fraction by which a metric can increase before it is
+            /// considered a regression.
+            //------------------------------------------------------------------------------
+            f32 GetTolerance() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return How the persisted baseline is updated after the current run has
+            /// been compared.
+            //------------------------------------------------------------------------------
+            BaselineUpdate GetBaselineUpdate() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Compares the given metrics against the given baseline, logging any
+            /// regressions. Unlike Evaluate() this doesn't access the file system.
+            ///
+            /// @param in_baseline - The baseline metrics.
+            /// @param in_current - The metrics for the current run.
+            ///
+            /// @return The result of the comparison.
+            //------------------------------------------------------------------------------
+            Result Compare(const PerformanceBaseline& in_baseline, const PerformanceBaseline& in_current) const noexcept;
+            //------------------------------------------------------------------------------
+            /// Compares the given metrics against the persisted baseline, logging any
+            /// regressions, and then updates the persisted baseline as described above.
+            ///
+            /// @param in_current - The metrics for the current run.
+            ///
+            /// @return The result of the comparison.
+            //------------------------------------------------------------------------------
+            Result Evaluate(const PerformanceBaseline& in_current) const noexcept;
+            
+        private:
+            Mode m_mode;
+            f32 m_tolerance;
+            f32 m_minSeconds;
+            BaselineUpdate m_baselineUpdate;
+            std::string m_baselineFilePath;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,72 @@
+//
+//  PerformanceRegression.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/PerformanceRegression.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PerformanceRegression::PerformanceRegression(const std::string& in_key, const std::string& in_metricName, f32 in_baselineValue, f32 in_currentValue) noexcept
+            : m_key(in_key), m_metricName(in_metricName), m_baselineValue(in_baselineValue), m_currentValue(in_currentValue)
+        {
+            CS_ASSERT(m_baselineValue > 0.0f, "The baseline value of a regressed metric must be positive.");
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& PerformanceRegression::GetKey() const noexcept
+        {
+            return m_key;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& PerformanceRegression::GetMetricName() const noexcept
+        {
+            return m_metricName;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 PerformanceRegression::GetBaselineValue() const noexcept
+        {
+            return m_baselineValue;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 PerformanceRegression::GetCurrentValue() const noexcept
+        {
+            return m_currentValue;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 PerformanceRegression::GetIncrease() const noexcept
+        {
+            return (m_currentValue - m_baselineValue) / m_baselineValue;
+        }
+    }
+}
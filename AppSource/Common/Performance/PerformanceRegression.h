@@ -0,0 +1,84 @@
+//
+//  PerformanceRegression.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_PERFORMANCE_PERFORMANCEREGRESSION_H_
+#define _COMMON_PERFORMANCE_PERFORMANCEREGRESSION_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Describes a single metric which has regressed relative to the performance
+        /// baseline.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class PerformanceRegression final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_key - The baseline key of the test the metric belongs to.
+            /// @param in_metricName - The name of the metric.
+            /// @param in_baselineValue - The value of the metric in the baseline.
+            /// @param in_currentValue - The value of the metric in the current run.
+            //------------------------------------------------------------------------------
+            PerformanceRegression(const std::string& in_key, const std::string& in_metricName, f32 in_baselineValue, f32 in_currentValue) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The baseline key of the test the metric belongs to.
+            //------------------------------------------------------------------------------
+            const std::string& GetKey() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the metric.
+            //------------------------------------------------------------------------------
+            const std::string& GetMetricName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The value of the metric in the baseline.
+            //------------------------------------------------------------------------------
+            f32 GetBaselineValue() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The value of the metric in the current run.
+            //------------------------------------------------------------------------------
+            f32 GetCurrentValue() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The fraction by which the metric has increased relative to the
+            /// baseline, i.e. 0.3 for a 30% slowdown.
+            //------------------------------------------------------------------------------
+            f32 GetIncrease() const noexcept;
+            
+        private:
+            std::string m_key;
+            std::string m_metricName;
+            f32 m_baselineValue;
+            f32 m_currentValue;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,90 @@
+//
+//  ProcessMemory.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/ProcessMemory.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#if defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_RPI
+#   include <cstdio>
+#   include <unistd.h>
+#elif defined CS_TARGETPLATFORM_IOS
+#   include <mach/mach.h>
+#elif defined CS_TARGETPLATFORM_WINDOWS
+#   include <Windows.h>
+#   include <Psapi.h>
+#endif
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 ProcessMemory::GetResidentBytes() noexcept
+        {
+#if defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_RPI
+            // The second field of statm is the number of resident pages.
+            auto file = std::fopen("/proc/self/statm", "r");
+            if (!file)
+            {
+                return 0;
+            }
+            
+            unsigned long long totalPages = 0, residentPages = 0;
+            auto numRead = std::fscanf(file, "%llu %llu", &totalPages, &residentPages);
+            std::fclose(file);
+            
+            if (numRead != 2)
+            {
+                return 0;
+            }
+            
+            return u64(residentPages) * u64(sysconf(_SC_PAGESIZE));
+#elif defined CS_TARGETPLATFORM_IOS
+            mach_task_basic_info_data_t info;
+            mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+            if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+            {
+                return 0;
+            }
+            
+            return u64(info.resident_size);
+#elif defined CS_TARGETPLATFORM_WINDOWS
+            PROCESS_MEMORY_COUNTERS counters;
+            if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            {
+                return 0;
+            }
+            
+            return u64(counters.WorkingSetSize);
+#else
+            return 0;
+#endif
+        }
+    }
+}
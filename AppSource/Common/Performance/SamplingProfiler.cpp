@@ -0,0 +1,417 @@
+//
+//  SamplingProfiler.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/SamplingProfiler.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+#if defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_RPI
+#   include <cerrno>
+#   include <cstdint>
+#   include <cstdlib>
+#   include <cxxabi.h>
+#   include <dlfcn.h>
+#   include <signal.h>
+#   include <sys/time.h>
+#   include <ucontext.h>
+#   include <thread>
+#   if defined CS_TARGETPLATFORM_ANDROID
+#       include <unwind.h>
+#   else
+#       include <execinfo.h>
+#   endif
+#   define CSTEST_SAMPLINGPROFILER_SUPPORTED
+#endif
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+#ifdef CSTEST_SAMPLINGPROFILER_SUPPORTED
+            std::atomic<SamplingProfiler*> g_activeProfiler(nullptr);
+            std::atomic<u32> g_numRunningHandlers(0);
+            struct sigaction g_previousAction;
+            
+#   ifdef CS_TARGETPLATFORM_ANDROID
+            //------------------------------------------------------------------------------
+            /// The output of CaptureBacktrace().
+            //------------------------------------------------------------------------------
+            struct BacktraceState final
+            {
+                void** m_frames;
+                u32 m_depth;
+                u32 m_maxDepth;
+            };
+            //------------------------------------------------------------------------------
+            /// Called by the unwinder for each frame in the call stack.
+            ///
+            /// @param in_context - The unwind context of the frame.
+            /// @param in_state - The backtrace state.
+            ///
+            /// @return Whether to continue unwinding.
+            //------------------------------------------------------------------------------
+            _Unwind_Reason_Code OnUnwindFrame(_Unwind_Context* in_context, void* in_state) noexcept
+            {
+                auto state = static_cast<BacktraceState*>(in_state);
+                if (state->m_depth >= state->m_maxDepth)
+                {
+                    return _URC_END_OF_STACK;
+                }
+                
+                state->m_frames[state->m_depth++] = reinterpret_cast<void*>(_Unwind_GetIP(in_context));
+                return _URC_NO_REASON;
+            }
+#   endif
+            //------------------------------------------------------------------------------
+            /// Captures the return addresses of the current call stack. Bionic doesn't
+            /// provide backtrace(), so the unwinder is used directly on Android.
+            ///
+            /// @param out_frames - The buffer to write the addresses to.
+            /// @param in_maxDepth - The size of the buffer.
+            ///
+            /// @return The number of addresses written.
+            //------------------------------------------------------------------------------
+            u32 CaptureBacktrace(void** out_frames, u32 in_maxDepth) noexcept
+            {
+#   ifdef CS_TARGETPLATFORM_ANDROID
+                BacktraceState state = { out_frames, 0, in_maxDepth };
+                _Unwind_Backtrace(OnUnwindFrame, &state);
+                return state.m_depth;
+#   else
+                return u32(backtrace(out_frames, s32(in_maxDepth)));
+#   endif
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_context - The user context passed to a signal handler.
+            ///
+            /// @return The address of the instruction which was interrupted by the signal.
+            //------------------------------------------------------------------------------
+            void* GetInterruptedAddress(void* in_context) noexcept
+            {
+                auto& machineContext = static_cast<ucontext_t*>(in_context)->uc_mcontext;
+                
+#   if defined __aarch64__
+                return reinterpret_cast<void*>(machineContext.pc);
+#   elif defined __arm__
+                return reinterpret_cast<void*>(machineContext.arm_pc);
+#   elif defined __x86_64__
+                return reinterpret_cast<void*>(machineContext.gregs[REG_RIP]);
+#   elif defined __i386__
+                return reinterpret_cast<void*>(machineContext.gregs[REG_EIP]);
+#   else
+                return nullptr;
+#   endif
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_address - A code address.
+            ///
+            /// @return A readable name for the function containing the given address.
+            //------------------------------------------------------------------------------
+            std::string Symbolicate(void* in_address) noexcept
+            {
+                Dl_info info;
+                if (dladdr(in_address, &info) != 0)
+                {
+                    if (info.dli_sname)
+                    {
+                        s32 status = 0;
+                        auto demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+                        if (demangled && status == 0)
+                        {
+                            std::string name = demangled;
+                            std::free(demangled);
+                            return name;
+                        }
+                        
+                        std::free(demangled);
+                        return info.dli_sname;
+                    }
+                    
+                    if (info.dli_fname)
+                    {
+                        std::string moduleName = info.dli_fname;
+                        std::ostringstream stream;
+                        stream << moduleName.substr(moduleName.find_last_of('/') + 1) << "+0x" << std::hex << (reinterpret_cast<std::uintptr_t>(in_address) - reinterpret_cast<std::uintptr_t>(info.dli_fbase));
+                        return stream.str();
+                    }
+                }
+                
+                std::ostringstream stream;
+                stream << in_address;
+                return stream.str();
+            }
+#endif
+        }
+        
+        constexpr u32 SamplingProfiler::k_defaultSamplesPerSecond;
+        constexpr u32 SamplingProfiler::k_maxSamples;
+        constexpr u32 SamplingProfiler::k_maxStackDepth;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool SamplingProfiler::IsSupported() noexcept
+        {
+#ifdef CSTEST_SAMPLINGPROFILER_SUPPORTED
+            return true;
+#else
+            return false;
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SamplingProfiler::SamplingProfiler(const std::string& in_name, u32 in_samplesPerSecond) noexcept
+            : m_name(in_name), m_nextSample(0), m_numDroppedSamples(0)
+        {
+            CS_ASSERT(in_samplesPerSecond > 0, "At least one sample must be taken per second.");
+            
+#ifdef CSTEST_SAMPLINGPROFILER_SUPPORTED
+            SamplingProfiler* noProfiler = nullptr;
+            if (!g_activeProfiler.compare_exchange_strong(noProfiler, this))
+            {
+                CS_LOG_WARNING("Cannot profile '" + m_name + "' as another profile is already running.");
+                return;
+            }
+            
+            m_frames.resize(k_maxSamples * k_maxStackDepth);
+            m_depths.resize(k_maxSamples);
+            
+            // The first backtrace loads the unwinder, which allocates, so it must happen before the first signal.
+            void* primingFrames[k_maxStackDepth];
+            CaptureBacktrace(primingFrames, k_maxStackDepth);
+            
+            struct sigaction action;
+            action.sa_sigaction = &SamplingProfiler::OnSignal;
+            action.sa_flags = SA_RESTART | SA_SIGINFO;
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGPROF, &action, &g_previousAction);
+            
+            auto intervalMicroseconds = std::max(1000000u / in_samplesPerSecond, 1u);
+            itimerval timer;
+            timer.it_interval.tv_sec = intervalMicroseconds / 1000000;
+            timer.it_interval.tv_usec = intervalMicroseconds % 1000000;
+            timer.it_value = timer.it_interval;
+            setitimer(ITIMER_PROF, &timer, nullptr);
+            
+            m_isRunning = true;
+#else
+            CS_LOG_WARNING("Cannot profile '" + m_name + "' as sampling is not supported on this platform.");
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& SamplingProfiler::GetName() const noexcept
+        {
+            return m_name;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool SamplingProfiler::IsRunning() const noexcept
+        {
+            return m_isRunning;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void SamplingProfiler::Stop() noexcept
+        {
+            if (!m_isRunning)
+            {
+                return;
+            }
+            
+#ifdef CSTEST_SAMPLINGPROFILER_SUPPORTED
+            itimerval timer = {};
+            setitimer(ITIMER_PROF, &timer, nullptr);
+            
+            g_activeProfiler = nullptr;
+            
+            // A signal may have been delivered to another thread before the timer was stopped, so wait for it to finish writing.
+            while (g_numRunningHandlers > 0)
+            {
+                std::this_thread::yield();
+            }
+            
+            // A signal may also still be pending once the timer has stopped. The default action would terminate the process, so
+            // it is ignored instead of being restored.
+            if (!(g_previousAction.sa_flags & SA_SIGINFO) && g_previousAction.sa_handler == SIG_DFL)
+            {
+                struct sigaction ignoreAction;
+                ignoreAction.sa_handler = SIG_IGN;
+                ignoreAction.sa_flags = 0;
+                sigemptyset(&ignoreAction.sa_mask);
+                sigaction(SIGPROF, &ignoreAction, nullptr);
+            }
+            else
+            {
+                sigaction(SIGPROF, &g_previousAction, nullptr);
+            }
+#endif
+            
+            m_isRunning = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 SamplingProfiler::GetNumSamples() const noexcept
+        {
+            CS_ASSERT(!m_isRunning, "The profiler must be stopped.");
+            
+            return std::min(m_nextSample.load(), u32(m_depths.size()));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 SamplingProfiler::GetNumDroppedSamples() const noexcept
+        {
+            CS_ASSERT(!m_isRunning, "The profiler must be stopped.");
+            
+            return m_numDroppedSamples;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string SamplingProfiler::ToFoldedStacks() const noexcept
+        {
+            CS_ASSERT(!m_isRunning, "The profiler must be stopped.");
+            
+            std::map<std::string, u32> stackCounts;
+            
+#ifdef CSTEST_SAMPLINGPROFILER_SUPPORTED
+            std::unordered_map<void*, std::string> symbols;
+            
+            auto numSamples = GetNumSamples();
+            for (u32 sampleIndex = 0; sampleIndex < numSamples; ++sampleIndex)
+            {
+                auto frames = &m_frames[sampleIndex * k_maxStackDepth];
+                auto depth = m_depths[sampleIndex];
+                if (depth == 0)
+                {
+                    continue;
+                }
+                
+                std::string stack;
+                for (auto frameIndex = depth; frameIndex > 0; --frameIndex)
+                {
+                    // Return addresses point to the instruction after the call, which may belong to the next function. The
+                    // innermost frame is the interrupted instruction itself so needs no adjustment.
+                    auto address = frames[frameIndex - 1];
+                    if (frameIndex > 1)
+                    {
+                        address = static_cast<u8*>(address) - 1;
+                    }
+                    
+                    auto symbolIt = symbols.find(address);
+                    if (symbolIt == symbols.end())
+                    {
+                        auto symbol = Symbolicate(address);
+                        std::replace(symbol.begin(), symbol.end(), ';', ':');
+                        symbolIt = symbols.emplace(address, symbol).first;
+                    }
+                    
+                    if (!stack.empty())
+                    {
+                        stack += ';';
+                    }
+                    stack += symbolIt->second;
+                }
+                
+                ++stackCounts[stack];
+            }
+#endif
+            
+            std::string output;
+            for (const auto& stackCount : stackCounts)
+            {
+                output += stackCount.first + " " + CS::ToString(stackCount.second) + "\n";
+            }
+            
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SamplingProfiler::~SamplingProfiler() noexcept
+        {
+            Stop();
+        }
+#ifdef CSTEST_SAMPLINGPROFILER_SUPPORTED
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void SamplingProfiler::OnSignal(s32 in_signal, siginfo_t* in_info, void* in_context) noexcept
+        {
+            auto savedErrno = errno;
+            
+            // The handler is counted as running before the profiler is read, so that Stop() can't return while it is in use.
+            ++g_numRunningHandlers;
+            
+            auto profiler = g_activeProfiler.load();
+            if (profiler)
+            {
+                profiler->RecordSample(GetInterruptedAddress(in_context));
+            }
+            
+            --g_numRunningHandlers;
+            
+            errno = savedErrno;
+        }
+#endif
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void SamplingProfiler::RecordSample(void* in_interruptedAddress) noexcept
+        {
+#ifdef CSTEST_SAMPLINGPROFILER_SUPPORTED
+            auto sampleIndex = m_nextSample++;
+            if (sampleIndex >= k_maxSamples)
+            {
+                ++m_numDroppedSamples;
+                return;
+            }
+            
+            auto frames = &m_frames[sampleIndex * k_maxStackDepth];
+            auto depth = CaptureBacktrace(frames, k_maxStackDepth);
+            
+            // The backtrace begins inside the handler, so the frames above the interrupted instruction are discarded. If the
+            // unwinder couldn't step through the signal frame then only the interrupted instruction is recorded.
+            auto interruptedIt = std::find(frames, frames + depth, in_interruptedAddress);
+            if (interruptedIt != frames + depth)
+            {
+                depth = u32(std::copy(interruptedIt, frames + depth, frames) - frames);
+            }
+            else
+            {
+                frames[0] = in_interruptedAddress;
+                depth = (in_interruptedAddress != nullptr) ? 1 : 0;
+            }
+            
+            m_depths[sampleIndex] = depth;
+#endif
+        }
+    }
+}
@@ -0,0 +1,158 @@
+//
+//  SamplingProfiler.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_PERFORMANCE_SAMPLINGPROFILER_H_
+#define _COMMON_PERFORMANCE_SAMPLINGPROFILER_H_
+
+#include <CSTest.h>
+
+#include <atomic>
+#include <vector>
+
+#if defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_RPI
+#   include <signal.h>
+#endif
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// A sampling CPU profiler which captures the call stack of the process at a
+        /// regular interval of CPU time. Samples are taken from a SIGPROF timer
+        /// signal, which is delivered to whichever thread is consuming CPU, so work
+        /// on the task scheduler's worker threads is included alongside the main
+        /// thread.
+        ///
+        /// Profiling starts when the profiler is constructed and ends when it is
+        /// stopped or destroyed. The samples can then be converted to the folded stack
+        /// format, with one line per unique call stack followed by the number of
+        /// times it was sampled, which is understood by flame graph tools such as
+        /// flamegraph.pl and speedscope.
+        ///
+        /// Sampling is only supported on Linux based platforms; Raspberry Pi and
+        /// Android. Elsewhere, or if another profiler is already running, the
+        /// profiler does nothing and takes no samples. The sample buffer is allocated
+        /// up front, and once it is full further samples are dropped.
+        ///
+        /// Function names are resolved from the dynamic symbol table, so on Raspberry
+        /// Pi the app must be linked with -rdynamic for them to be available. Without
+        /// it frames are written as the module name and offset, which can be resolved
+        /// offline with addr2line.
+        ///
+        /// This is not thread-safe and should only be used from the thread which
+        /// created it.
+        //------------------------------------------------------------------------------
+        class SamplingProfiler final
+        {
+        public:
+            CS_DECLARE_NOCOPY(SamplingProfiler);
+            
+            static constexpr u32 k_defaultSamplesPerSecond = 500;
+            static constexpr u32 k_maxSamples = 16384;
+            static constexpr u32 k_maxStackDepth = 48;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not sampling is supported on the current platform.
+            //------------------------------------------------------------------------------
+            static bool IsSupported() noexcept;
+            //------------------------------------------------------------------------------
+            /// Begins profiling.
+            ///
+            /// @param in_name - The name of the profile. This is used as the file name
+            /// when the profile is exported.
+            /// @param in_samplesPerSecond - [Optional] The number of samples to take per
+            /// second of CPU time.
+            //------------------------------------------------------------------------------
+            SamplingProfiler(const std::string& in_name, u32 in_samplesPerSecond = k_defaultSamplesPerSecond) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the profile.
+            //------------------------------------------------------------------------------
+            const std::string& GetName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not samples are currently being taken.
+            //------------------------------------------------------------------------------
+            bool IsRunning() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Stops profiling. Once stopped the profiler cannot be restarted.
+            //------------------------------------------------------------------------------
+            void Stop() noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of samples taken. Must be stopped.
+            //------------------------------------------------------------------------------
+            u32 GetNumSamples() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of samples which were dropped because the sample buffer
+            /// was full. Must be stopped.
+            //------------------------------------------------------------------------------
+            u32 GetNumDroppedSamples() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Symbolicates the samples and converts them to the folded stack format. The
+            /// outermost frame is first in each stack. Frames which can't be named are
+            /// written as the module name and offset, or the raw address. Must be
+            /// stopped.
+            ///
+            /// @return The samples in the folded stack format.
+            //------------------------------------------------------------------------------
+            std::string ToFoldedStacks() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Stops profiling if it is still running.
+            //------------------------------------------------------------------------------
+            ~SamplingProfiler() noexcept;
+            
+        private:
+#if defined CS_TARGETPLATFORM_ANDROID || defined CS_TARGETPLATFORM_RPI
+            //------------------------------------------------------------------------------
+            /// The SIGPROF handler. Records a sample to the active profiler, if there is
+            /// one. This must be async-signal-safe.
+            ///
+            /// @param in_signal - The signal number.
+            /// @param in_info - Information on the signal.
+            /// @param in_context - The user context of the interrupted thread.
+            //------------------------------------------------------------------------------
+            static void OnSignal(s32 in_signal, siginfo_t* in_info, void* in_context) noexcept;
+#endif
+            //------------------------------------------------------------------------------
+            /// Captures the call stack of the current thread into the next free sample.
+            /// This is called from the signal handler so must be async-signal-safe.
+            ///
+            /// @param in_interruptedAddress - The address of the instruction which was
+            /// interrupted by the signal.
+            //------------------------------------------------------------------------------
+            void RecordSample(void* in_interruptedAddress) noexcept;
+            
+            std::string m_name;
+            bool m_isRunning = false;
+            
+            std::vector<void*> m_frames;
+            std::vector<u32> m_depths;
+            std::atomic<u32> m_nextSample;
+            std::atomic<u32> m_numDroppedSamples;
+        };
+    }
+}
+
+#endif
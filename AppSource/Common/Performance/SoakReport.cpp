@@ -0,0 +1,224 @@
+//
+//  SoakReport.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/SoakReport.h>
+
+#include <IntegrationTest/TestSystem/Report.h>
+
+#include <algorithm>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// Calculates the least-squares slope of the given values against their
+            /// index.
+            ///
+            /// @param in_values - The values, one per pass.
+            ///
+            /// @return The change in value per pass, or zero if there are fewer than two
+            /// values.
+            //------------------------------------------------------------------------------
+            f64 CalcSlope(const std::vector<f64>& in_values) noexcept
+            {
+                if (in_values.size() < 2)
+                {
+                    return 0.0;
+                }
+                
+                auto count = f64(in_values.size());
+                auto meanIndex = (count - 1.0) / 2.0;
+                
+                f64 meanValue = 0.0;
+                for (auto value : in_values)
+                {
+                    meanValue += value;
+                }
+                meanValue /= count;
+                
+                f64 covariance = 0.0;
+                f64 variance = 0.0;
+                for (std::size_t i = 0; i < in_values.size(); ++i)
+                {
+                    auto indexOffset = f64(i) - meanIndex;
+                    covariance += indexOffset * (in_values[i] - meanValue);
+                    variance += indexOffset * indexOffset;
+                }
+                
+                return covariance / variance;
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SoakReport::Pass::Pass(u64 in_residentBytes, f32 in_durationSeconds, const IntegrationTest::Report& in_report) noexcept
+            : m_residentBytes(in_residentBytes), m_durationSeconds(in_durationSeconds), m_numFailedTests(in_report.GetNumFailedTests())
+        {
+            // Repeated tests are summed so that the drift reflects the total time spent in each test per pass.
+            for (const auto& testResult : in_report.GetTestResults())
+            {
+                m_testDurations[testResult.GetDesc().GetTestCaseName() + "/" + testResult.GetDesc().GetTestName()] += testResult.GetDurationSeconds();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 SoakReport::Pass::GetResidentBytes() const noexcept
+        {
+            return m_residentBytes;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 SoakReport::Pass::GetDurationSeconds() const noexcept
+        {
+            return m_durationSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 SoakReport::Pass::GetNumFailedTests() const noexcept
+        {
+            return m_numFailedTests;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::map<std::string, f32>& SoakReport::Pass::GetTestDurations() const noexcept
+        {
+            return m_testDurations;
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SoakReport::TestDrift::TestDrift(const std::string& in_testName, f32 in_firstSeconds, f32 in_lastSeconds, f32 in_secondsPerPass) noexcept
+            : m_testName(in_testName), m_firstSeconds(in_firstSeconds), m_lastSeconds(in_lastSeconds), m_secondsPerPass(in_secondsPerPass)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& SoakReport::TestDrift::GetTestName() const noexcept
+        {
+            return m_testName;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 SoakReport::TestDrift::GetFirstSeconds() const noexcept
+        {
+            return m_firstSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 SoakReport::TestDrift::GetLastSeconds() const noexcept
+        {
+            return m_lastSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 SoakReport::TestDrift::GetSecondsPerPass() const noexcept
+        {
+            return m_secondsPerPass;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 SoakReport::TestDrift::GetRelativeDriftPerPass() const noexcept
+        {
+            return (m_firstSeconds > 0.0f) ? m_secondsPerPass / m_firstSeconds : 0.0f;
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SoakReport::SoakReport(const std::vector<Pass>& in_passes) noexcept
+            : m_passes(in_passes)
+        {
+            if (m_passes.empty())
+            {
+                return;
+            }
+            
+            std::vector<f64> residentBytes;
+            std::vector<f64> durations;
+            for (const auto& pass : m_passes)
+            {
+                residentBytes.push_back(f64(pass.GetResidentBytes()));
+                durations.push_back(f64(pass.GetDurationSeconds()));
+            }
+            
+            m_residentBytesPerPass = CalcSlope(residentBytes);
+            m_durationSecondsPerPass = f32(CalcSlope(durations));
+            
+            // Tests which were not run in every pass, for example because they failed to start, are skipped as their drift can't be compared.
+            for (const auto& firstPassEntry : m_passes.front().GetTestDurations())
+            {
+                std::vector<f64> testDurations;
+                for (const auto& pass : m_passes)
+                {
+                    auto it = pass.GetTestDurations().find(firstPassEntry.first);
+                    if (it == pass.GetTestDurations().end())
+                    {
+                        break;
+                    }
+                    
+                    testDurations.push_back(f64(it->second));
+                }
+                
+                if (testDurations.size() == m_passes.size())
+                {
+                    m_testDrifts.push_back(TestDrift(firstPassEntry.first, f32(testDurations.front()), f32(testDurations.back()), f32(CalcSlope(testDurations))));
+                }
+            }
+            
+            std::stable_sort(m_testDrifts.begin(), m_testDrifts.end(), [](const TestDrift& in_a, const TestDrift& in_b)
+            {
+                return in_a.GetRelativeDriftPerPass() > in_b.GetRelativeDriftPerPass();
+            });
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<SoakReport::Pass>& SoakReport::GetPasses() const noexcept
+        {
+            return m_passes;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f64 SoakReport::GetResidentBytesPerPass() const noexcept
+        {
+            return m_residentBytesPerPass;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 SoakReport::GetDurationSecondsPerPass() const noexcept
+        {
+            return m_durationSecondsPerPass;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<SoakReport::TestDrift>& SoakReport::GetTestDrifts() const noexcept
+        {
+            return m_testDrifts;
+        }
+    }
+}
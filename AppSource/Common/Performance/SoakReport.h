@@ -0,0 +1,174 @@
+//
+//  SoakReport.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_PERFORMANCE_SOAKREPORT_H_
+#define _COMMON_PERFORMANCE_SOAKREPORT_H_
+
+#include <CSTest.h>
+
+#include <map>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An immutable container for the results of a soak run, in which the
+        /// integration tests are run repeatedly to catch slow leaks and gradual
+        /// slowdowns which a single pass would not show. Memory usage and test
+        /// durations are sampled after each pass, and the drift in each across passes
+        /// is calculated as the least-squares slope per pass.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class SoakReport final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// An immutable container for the samples taken after a single soak pass.
+            ///
+            /// This is immutable and therefore thread-safe.
+            //------------------------------------------------------------------------------
+            class Pass final
+            {
+            public:
+                //------------------------------------------------------------------------------
+                /// Constructs a new instance from the report of the pass.
+                ///
+                /// @param in_residentBytes - The resident set size of the process at the end
+                /// of the pass.
+                /// @param in_durationSeconds - The wall-clock time the pass took.
+                /// @param in_report - The integration test report for the pass.
+                //------------------------------------------------------------------------------
+                Pass(u64 in_residentBytes, f32 in_durationSeconds, const IntegrationTest::Report& in_report) noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The resident set size of the process at the end of the pass, or
+                /// zero if it isn't available on this platform.
+                //------------------------------------------------------------------------------
+                u64 GetResidentBytes() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The wall-clock time the pass took.
+                //------------------------------------------------------------------------------
+                f32 GetDurationSeconds() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The number of tests which failed in the pass.
+                //------------------------------------------------------------------------------
+                u32 GetNumFailedTests() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The duration of each test in the pass, keyed by
+                /// "<TestCase>/<Test>".
+                //------------------------------------------------------------------------------
+                const std::map<std::string, f32>& GetTestDurations() const noexcept;
+                
+            private:
+                u64 m_residentBytes;
+                f32 m_durationSeconds;
+                u32 m_numFailedTests;
+                std::map<std::string, f32> m_testDurations;
+            };
+            //------------------------------------------------------------------------------
+            /// An immutable description of how the duration of a single test changed
+            /// over the course of the soak run.
+            ///
+            /// This is immutable and therefore thread-safe.
+            //------------------------------------------------------------------------------
+            class TestDrift final
+            {
+            public:
+                //------------------------------------------------------------------------------
+                /// @param in_testName - The name of the test, in the form "<TestCase>/<Test>".
+                /// @param in_firstSeconds - The duration of the test in the first pass.
+                /// @param in_lastSeconds - The duration of the test in the last pass.
+                /// @param in_secondsPerPass - The least-squares slope of the duration across
+                /// all passes.
+                //------------------------------------------------------------------------------
+                TestDrift(const std::string& in_testName, f32 in_firstSeconds, f32 in_lastSeconds, f32 in_secondsPerPass) noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The name of the test, in the form "<TestCase>/<Test>".
+                //------------------------------------------------------------------------------
+                const std::string& GetTestName() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The duration of the test in the first pass.
+                //------------------------------------------------------------------------------
+                f32 GetFirstSeconds() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The duration of the test in the last pass.
+                //------------------------------------------------------------------------------
+                f32 GetLastSeconds() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The change in duration per pass.
+                //------------------------------------------------------------------------------
+                f32 GetSecondsPerPass() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The change in duration per pass as a fraction of the duration in
+                /// the first pass, i.e. 0.05 for a 5% slowdown per pass.
+                //------------------------------------------------------------------------------
+                f32 GetRelativeDriftPerPass() const noexcept;
+                
+            private:
+                std::string m_testName;
+                f32 m_firstSeconds;
+                f32 m_lastSeconds;
+                f32 m_secondsPerPass;
+            };
+            //------------------------------------------------------------------------------
+            /// Constructs a new instance from the given passes, and calculates the drift
+            /// across them.
+            ///
+            /// @param in_passes - The passes, in the order they were run.
+            //------------------------------------------------------------------------------
+            SoakReport(const std::vector<Pass>& in_passes) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The passes, in the order they were run.
+            //------------------------------------------------------------------------------
+            const std::vector<Pass>& GetPasses() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The change in resident set size per pass. This will be zero if
+            /// there are fewer than two passes, or memory usage isn't available.
+            //------------------------------------------------------------------------------
+            f64 GetResidentBytesPerPass() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The change in the wall-clock time of each pass, per pass.
+            //------------------------------------------------------------------------------
+            f32 GetDurationSecondsPerPass() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The drift of every test which was run in all passes, ordered by
+            /// relative drift, greatest slowdown first.
+            //------------------------------------------------------------------------------
+            const std::vector<TestDrift>& GetTestDrifts() const noexcept;
+            
+        private:
+            std::vector<Pass> m_passes;
+            f64 m_residentBytesPerPass = 0.0;
+            f32 m_durationSecondsPerPass = 0.0f;
+            std::vector<TestDrift> m_testDrifts;
+        };
+    }
+}
+
+#endif
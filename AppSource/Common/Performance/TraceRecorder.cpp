@@ -0,0 +1,329 @@
+//
+//  TraceRecorder.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Performance/TraceRecorder.h>
+
+#include <Common/Core/TestConfig.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            constexpr u32 k_processId = 1;
+            constexpr char k_frameCategory[] = "Frame";
+            constexpr char k_taskCategory[] = "Task";
+            
+            //------------------------------------------------------------------------------
+            /// @param in_taskType - The task type.
+            ///
+            /// @return The name of the task type, as it is shown on the timeline.
+            //------------------------------------------------------------------------------
+            std::string ToString(CS::TaskType in_taskType) noexcept
+            {
+                switch (in_taskType)
+                {
+                    case CS::TaskType::k_mainThread:
+                        return "MainThreadTask";
+                    case CS::TaskType::k_small:
+                        return "SmallTask";
+                    case CS::TaskType::k_large:
+                        return "LargeTask";
+                    case CS::TaskType::k_gameLogic:
+                        return "GameLogicTask";
+                    case CS::TaskType::k_system:
+                        return "SystemTask";
+                    case CS::TaskType::k_file:
+                        return "FileTask";
+                    default:
+                        CS_LOG_FATAL("Invalid task type.");
+                        return "";
+                }
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_string - The string to escape.
+            ///
+            /// @return The string escaped and quoted, such that it can be written as a
+            /// json string.
+            //------------------------------------------------------------------------------
+            std::string ToJsonString(const std::string& in_string) noexcept
+            {
+                std::string output = "\"";
+                for (auto character : in_string)
+                {
+                    switch (character)
+                    {
+                        case '"':
+                            output += "\\\"";
+                            break;
+                        case '\\':
+                            output += "\\\\";
+                            break;
+                        case '\n':
+                            output += "\\n";
+                            break;
+                        case '\t':
+                            output += "\\t";
+                            break;
+                        default:
+                            // Any other control characters are unlikely in event names, so are simply dropped.
+                            if (static_cast<unsigned char>(character) >= 0x20)
+                            {
+                                output += character;
+                            }
+                            break;
+                    }
+                }
+                
+                return output + "\"";
+            }
+        }
+        
+        CS_DEFINE_NAMEDTYPE(TraceRecorder);
+        
+        constexpr u32 TraceRecorder::k_maxEvents;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TraceRecorderUPtr TraceRecorder::Create() noexcept
+        {
+            return TraceRecorderUPtr(new TraceRecorder());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TraceRecorder::IsA(CS::InterfaceIDType in_interfaceId) const noexcept
+        {
+            return (TraceRecorder::InterfaceID == in_interfaceId);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TraceRecorder::IsEnabled() const noexcept
+        {
+            return m_isEnabled;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TraceRecorder::GetNumEvents() const noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return u32(m_events.size());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TraceRecorder::GetNumDroppedEvents() const noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return m_numDroppedEvents;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TraceRecorder::BeginAsyncEvent(const std::string& in_name, const std::string& in_category, u64 in_id) noexcept
+        {
+            if (m_isEnabled)
+            {
+                Record(in_name, in_category, Phase::k_asyncBegin, GetTimestamp(), 0, in_id);
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TraceRecorder::EndAsyncEvent(const std::string& in_name, const std::string& in_category, u64 in_id) noexcept
+        {
+            if (m_isEnabled)
+            {
+                Record(in_name, in_category, Phase::k_asyncEnd, GetTimestamp(), 0, in_id);
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        CS::Task TraceRecorder::WrapTask(CS::TaskType in_taskType, const CS::Task& in_task) noexcept
+        {
+            if (!m_isEnabled || !in_task)
+            {
+                return in_task;
+            }
+            
+            auto name = ToString(in_taskType);
+            return [=](const CS::TaskContext& in_taskContext) noexcept
+            {
+                auto startTimestamp = GetTimestamp();
+                in_task(in_taskContext);
+                Record(name, k_taskCategory, Phase::k_complete, startTimestamp, GetTimestamp() - startTimestamp);
+            };
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<CS::Task> TraceRecorder::WrapTasks(CS::TaskType in_taskType, const std::vector<CS::Task>& in_tasks) noexcept
+        {
+            if (!m_isEnabled)
+            {
+                return in_tasks;
+            }
+            
+            std::vector<CS::Task> tasks;
+            tasks.reserve(in_tasks.size());
+            for (const auto& task : in_tasks)
+            {
+                tasks.push_back(WrapTask(in_taskType, task));
+            }
+            
+            return tasks;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TraceRecorder::ScheduleTask(CS::TaskType in_taskType, const CS::Task& in_task) noexcept
+        {
+            CS::Application::Get()->GetTaskScheduler()->ScheduleTask(in_taskType, WrapTask(in_taskType, in_task));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TraceRecorder::ScheduleTasks(CS::TaskType in_taskType, const std::vector<CS::Task>& in_tasks) noexcept
+        {
+            CS::Application::Get()->GetTaskScheduler()->ScheduleTasks(in_taskType, WrapTasks(in_taskType, in_tasks));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TraceRecorder::ScheduleTasks(CS::TaskType in_taskType, const std::vector<CS::Task>& in_tasks, const CS::Task& in_completionTask) noexcept
+        {
+            CS::Application::Get()->GetTaskScheduler()->ScheduleTasks(in_taskType, WrapTasks(in_taskType, in_tasks), WrapTask(in_taskType, in_completionTask));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string TraceRecorder::ToJson() const noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            std::ostringstream stream;
+            stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            
+            for (u32 i = 0; i < u32(m_threads.size()); ++i)
+            {
+                stream << (i > 0 ? ",\n" : "\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << k_processId << ",\"tid\":" << i << ",\"args\":{\"name\":" << ToJsonString(m_threads[i].second) << "}}";
+            }
+            
+            for (const auto& event : m_events)
+            {
+                stream << ",\n{\"name\":" << ToJsonString(event.m_name) << ",\"cat\":" << ToJsonString(event.m_category) << ",\"pid\":" << k_processId << ",\"tid\":" << event.m_threadIndex << ",\"ts\":" << event.m_timestamp;
+                
+                switch (event.m_phase)
+                {
+                    case Phase::k_complete:
+                        stream << ",\"ph\":\"X\",\"dur\":" << event.m_duration << "}";
+                        break;
+                    case Phase::k_asyncBegin:
+                        stream << ",\"ph\":\"b\",\"id\":" << event.m_id << "}";
+                        break;
+                    case Phase::k_asyncEnd:
+                        stream << ",\"ph\":\"e\",\"id\":" << event.m_id << "}";
+                        break;
+                }
+            }
+            
+            stream << "\n]}\n";
+            return stream.str();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        s64 TraceRecorder::GetTimestamp() const noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_startTime).count();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TraceRecorder::Record(const std::string& in_name, const std::string& in_category, Phase in_phase, s64 in_timestamp, s64 in_duration, u64 in_id) noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            if (m_events.size() >= k_maxEvents)
+            {
+                ++m_numDroppedEvents;
+                return;
+            }
+            
+            m_events.push_back(Event { in_name, in_category, in_phase, GetCurrentThreadIndex(), in_timestamp, in_duration, in_id });
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TraceRecorder::GetCurrentThreadIndex() noexcept
+        {
+            auto threadId = std::this_thread::get_id();
+            
+            // There are only ever a handful of threads, so a linear search is cheaper than hashing.
+            auto it = std::find_if(m_threads.begin(), m_threads.end(), [&](const std::pair<std::thread::id, std::string>& in_thread) { return in_thread.first == threadId; });
+            if (it != m_threads.end())
+            {
+                return u32(it - m_threads.begin());
+            }
+            
+            auto threadIndex = u32(m_threads.size());
+            auto threadName = CS::Application::Get()->GetTaskScheduler()->IsMainThread() ? std::string("Main Thread") : "Worker " + CS::ToString(threadIndex);
+            m_threads.push_back(std::make_pair(threadId, threadName));
+            
+            return threadIndex;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TraceRecorder::OnInit() noexcept
+        {
+            auto testConfig = CS::Application::Get()->GetSystem<TestConfig>();
+            CS_ASSERT(testConfig, "The trace recorder requires the test config system, which must be created first.");
+            
+            m_isEnabled = testConfig->IsTraceEnabled();
+            m_startTime = std::chrono::steady_clock::now();
+            
+            if (m_isEnabled)
+            {
+                CS_LOG_VERBOSE("Tracing is enabled, the timeline will be exported when the integration tests complete.");
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TraceRecorder::OnUpdate(f32 in_deltaTime) noexcept
+        {
+            if (!m_isEnabled)
+            {
+                return;
+            }
+            
+            auto timestamp = GetTimestamp();
+            if (m_isFrameStarted)
+            {
+                Record("Frame " + CS::ToString(m_frameIndex), k_frameCategory, Phase::k_complete, m_frameStartTimestamp, timestamp - m_frameStartTimestamp);
+            }
+            
+            m_isFrameStarted = true;
+            m_frameIndex = CS::Application::Get()->GetFrameIndex();
+            m_frameStartTimestamp = timestamp;
+        }
+    }
+}
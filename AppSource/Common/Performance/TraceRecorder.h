@@ -0,0 +1,249 @@
+//
+//  TraceRecorder.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_PERFORMANCE_TRACERECORDER_H_
+#define _COMMON_PERFORMANCE_TRACERECORDER_H_
+
+#include <CSTest.h>
+
+#include <ChilliSource/Core/System.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// An app system which records a timeline of the tests, tasks and frames run
+        /// by the app, which can be exported in the chrome://tracing trace event
+        /// format. This makes pipeline bubbles and main thread stalls easy to spot.
+        ///
+        /// Tracing is enabled using the "Trace" test config option. When disabled
+        /// nothing is recorded, and tasks are scheduled without being wrapped.
+        ///
+        /// Each frame is recorded on the main thread as a span from the start of one
+        /// update to the start of the next. Tests are recorded as async spans, as
+        /// several can be in progress at once. Tasks are only recorded if they are
+        /// scheduled through this system, rather than directly with the task
+        /// scheduler; each run is recorded on the thread it ran on, named after its
+        /// task type. The test systems and integration tests schedule their tasks
+        /// through this system, so that each task they run appears on the timeline
+        /// of the worker thread which ran it.
+        ///
+        /// At most k_maxEvents are recorded, after which further events are dropped.
+        ///
+        /// Events can be recorded from any thread. Everything else should only be
+        /// accessed from the main thread.
+        //------------------------------------------------------------------------------
+        class TraceRecorder final : public CS::AppSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(TraceRecorder);
+            
+            static constexpr u32 k_maxEvents = 1000000;
+            
+            //------------------------------------------------------------------------------
+            /// Allows querying of whether or not this system implements the interface
+            /// described by the given interface Id.
+            ///
+            /// @param in_interfaceId - The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //------------------------------------------------------------------------------
+            bool IsA(CS::InterfaceIDType in_interfaceId) const noexcept override;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not tracing is enabled.
+            //------------------------------------------------------------------------------
+            bool IsEnabled() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of events which have been recorded.
+            //------------------------------------------------------------------------------
+            u32 GetNumEvents() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of events which were dropped because the maximum
+            /// number of events had already been recorded.
+            //------------------------------------------------------------------------------
+            u32 GetNumDroppedEvents() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Records the start of an async span, such as a test, which may overlap
+            /// other spans. Does nothing if tracing is disabled.
+            ///
+            /// @param in_name - The name of the span.
+            /// @param in_category - The category of the span.
+            /// @param in_id - An Id which is unique amongst the spans with the same name
+            /// and category which are in progress.
+            //------------------------------------------------------------------------------
+            void BeginAsyncEvent(const std::string& in_name, const std::string& in_category, u64 in_id) noexcept;
+            //------------------------------------------------------------------------------
+            /// Records the end of an async span. The name, category and Id must match
+            /// those passed to BeginAsyncEvent(). Does nothing if tracing is disabled.
+            ///
+            /// @param in_name - The name of the span.
+            /// @param in_category - The category of the span.
+            /// @param in_id - The Id of the span.
+            //------------------------------------------------------------------------------
+            void EndAsyncEvent(const std::string& in_name, const std::string& in_category, u64 in_id) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_taskType - The type of task which the given task will be
+            /// scheduled as.
+            /// @param in_task - The task.
+            ///
+            /// @return A task which runs the given task, recording the run. If tracing is
+            /// disabled, or the given task is empty, this is the given task.
+            //------------------------------------------------------------------------------
+            CS::Task WrapTask(CS::TaskType in_taskType, const CS::Task& in_task) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_taskType - The type of task which the given tasks will be
+            /// scheduled as.
+            /// @param in_tasks - The tasks.
+            ///
+            /// @return The given tasks, each wrapped as described by WrapTask().
+            //------------------------------------------------------------------------------
+            std::vector<CS::Task> WrapTasks(CS::TaskType in_taskType, const std::vector<CS::Task>& in_tasks) noexcept;
+            //------------------------------------------------------------------------------
+            /// Schedules the given task with the task scheduler, recording its run.
+            ///
+            /// @param in_taskType - The type of task.
+            /// @param in_task - The task.
+            //------------------------------------------------------------------------------
+            void ScheduleTask(CS::TaskType in_taskType, const CS::Task& in_task) noexcept;
+            //------------------------------------------------------------------------------
+            /// Schedules the given tasks with the task scheduler, recording each run.
+            ///
+            /// @param in_taskType - The type of the tasks.
+            /// @param in_tasks - The tasks.
+            //------------------------------------------------------------------------------
+            void ScheduleTasks(CS::TaskType in_taskType, const std::vector<CS::Task>& in_tasks) noexcept;
+            //------------------------------------------------------------------------------
+            /// Schedules the given tasks with the task scheduler, recording each run,
+            /// followed by the completion task once they have all finished.
+            ///
+            /// @param in_taskType - The type of the tasks.
+            /// @param in_tasks - The tasks.
+            /// @param in_completionTask - The task which is run once the others have
+            /// finished. This is run as the same type of task as the others.
+            //------------------------------------------------------------------------------
+            void ScheduleTasks(CS::TaskType in_taskType, const std::vector<CS::Task>& in_tasks, const CS::Task& in_completionTask) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The recorded events as a trace event format json string, which
+            /// can be loaded into chrome://tracing. Timestamps are in microseconds since
+            /// the system was initialised.
+            //------------------------------------------------------------------------------
+            std::string ToJson() const noexcept;
+            
+        private:
+            friend class CS::Application;
+            
+            //------------------------------------------------------------------------------
+            /// The trace event phases which are recorded.
+            //------------------------------------------------------------------------------
+            enum class Phase
+            {
+                k_complete,
+                k_asyncBegin,
+                k_asyncEnd
+            };
+            //------------------------------------------------------------------------------
+            /// A single recorded event. The duration is only used by complete events and
+            /// the Id only by async events.
+            //------------------------------------------------------------------------------
+            struct Event final
+            {
+                std::string m_name;
+                std::string m_category;
+                Phase m_phase;
+                u32 m_threadIndex;
+                s64 m_timestamp;
+                s64 m_duration;
+                u64 m_id;
+            };
+            //------------------------------------------------------------------------------
+            /// A factory method for creating new instances of the system.
+            ///
+            /// @return The new instance.
+            //------------------------------------------------------------------------------
+            static TraceRecorderUPtr Create() noexcept;
+            //------------------------------------------------------------------------------
+            /// Default constructor. Declared private to ensure the system is created
+            /// through Application::CreateSystem<>().
+            //------------------------------------------------------------------------------
+            TraceRecorder() = default;
+            //------------------------------------------------------------------------------
+            /// @return The current time in microseconds since the system was initialised.
+            //------------------------------------------------------------------------------
+            s64 GetTimestamp() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Records an event on the current thread, or drops it if the maximum number
+            /// of events has been reached.
+            ///
+            /// @param in_name - The name of the event.
+            /// @param in_category - The category of the event.
+            /// @param in_phase - The phase of the event.
+            /// @param in_timestamp - The start time of the event.
+            /// @param in_duration - [Optional] The duration of a complete event.
+            /// @param in_id - [Optional] The Id of an async event.
+            //------------------------------------------------------------------------------
+            void Record(const std::string& in_name, const std::string& in_category, Phase in_phase, s64 in_timestamp, s64 in_duration = 0, u64 in_id = 0) noexcept;
+            //------------------------------------------------------------------------------
+            /// Looks up the index of the current thread, registering the thread if it
+            /// has not been seen before. The mutex must be locked.
+            ///
+            /// @return The index of the current thread.
+            //------------------------------------------------------------------------------
+            u32 GetCurrentThreadIndex() noexcept;
+            //------------------------------------------------------------------------------
+            /// Reads whether or not tracing is enabled from the test config.
+            //------------------------------------------------------------------------------
+            void OnInit() noexcept override;
+            //------------------------------------------------------------------------------
+            /// Records the frame which has just finished.
+            ///
+            /// @param in_deltaTime - The time since the last update.
+            //------------------------------------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) noexcept override;
+            
+            bool m_isEnabled = false;
+            std::chrono::steady_clock::time_point m_startTime;
+            
+            mutable std::mutex m_mutex;
+            std::vector<Event> m_events;
+            u32 m_numDroppedEvents = 0;
+            std::vector<std::pair<std::thread::id, std::string>> m_threads;
+            
+            bool m_isFrameStarted = false;
+            u32 m_frameIndex = 0;
+            s64 m_frameStartTimestamp = 0;
+        };
+    }
+}
+
+#endif
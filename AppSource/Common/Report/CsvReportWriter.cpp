@@ -0,0 +1,95 @@
+//
+//  CsvReportWriter.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Report/CsvReportWriter.h>
+
+#include <Common/Performance/SoakReport.h>
+
+#include <iomanip>
+#include <sstream>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// @param in_seconds - A duration in seconds.
+            ///
+            /// @return The duration in the fixed point format expected by JUnit consumers.
+            //------------------------------------------------------------------------------
+            std::string ToTimeString(f64 in_seconds) noexcept
+            {
+                std::ostringstream stream;
+                stream << std::fixed << std::setprecision(6) << in_seconds;
+                return stream.str();
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string CsvReportWriter::ToCsv(const SoakReport& in_report) noexcept
+        {
+            if (in_report.GetPasses().empty())
+            {
+                return "";
+            }
+            
+            // Tests are written in the order of the first pass; any test missing from a later pass is left blank.
+            const auto& firstPassDurations = in_report.GetPasses().front().GetTestDurations();
+            
+            std::ostringstream stream;
+            stream << "Pass,ResidentBytes,DurationSeconds,NumFailedTests";
+            for (const auto& testDuration : firstPassDurations)
+            {
+                stream << ",\"" << testDuration.first << "\"";
+            }
+            stream << "\n";
+            
+            u32 passIndex = 0;
+            for (const auto& pass : in_report.GetPasses())
+            {
+                stream << passIndex++ << "," << pass.GetResidentBytes() << "," << ToTimeString(pass.GetDurationSeconds()) << "," << pass.GetNumFailedTests();
+                
+                for (const auto& testDuration : firstPassDurations)
+                {
+                    stream << ",";
+                    
+                    auto it = pass.GetTestDurations().find(testDuration.first);
+                    if (it != pass.GetTestDurations().end())
+                    {
+                        stream << ToTimeString(it->second);
+                    }
+                }
+                stream << "\n";
+            }
+            
+            return stream.str();
+        }
+    }
+}
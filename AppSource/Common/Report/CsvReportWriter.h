@@ -0,0 +1,57 @@
+//
+//  CsvReportWriter.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_REPORT_CSVREPORTWRITER_H_
+#define _COMMON_REPORT_CSVREPORTWRITER_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Converts soak reports to CSV, which can be charted directly to show drift
+        /// across passes.
+        ///
+        /// This is stateless and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class CsvReportWriter final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_report - The soak report.
+            ///
+            /// @return The report as a CSV string with one row per pass, containing the
+            /// resident set size, pass duration and the duration of each test.
+            //------------------------------------------------------------------------------
+            static std::string ToCsv(const SoakReport& in_report) noexcept;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,292 @@
+//
+//  JUnitReportWriter.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Report/JUnitReportWriter.h>
+
+#include <Common/Performance/AllocationTracker.h>
+#include <IntegrationTest/TestSystem/Report.h>
+#include <UnitTest/TestSystem/Report.h>
+
+#include <ChilliSource/Core/String.h>
+
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            constexpr char k_integrationTestSuiteName[] = "IntegrationTest";
+            constexpr char k_unitTestSuiteName[] = "UnitTest";
+            
+            //------------------------------------------------------------------------------
+            /// @param in_seconds - A duration in seconds.
+            ///
+            /// @return The duration in the fixed point format expected by JUnit consumers.
+            //------------------------------------------------------------------------------
+            std::string ToTimeString(f64 in_seconds) noexcept
+            {
+                std::ostringstream stream;
+                stream << std::fixed << std::setprecision(6) << in_seconds;
+                return stream.str();
+            }
+            //------------------------------------------------------------------------------
+            /// Writes the allocation stats as JUnit properties.
+            ///
+            /// @param in_allocationStats - The allocation stats.
+            /// @param in_indent - The indentation of each property element.
+            /// @param out_stream - The stream to write to.
+            //------------------------------------------------------------------------------
+            void WriteAllocationProperties(const AllocationStats& in_allocationStats, const std::string& in_indent, std::ostream& out_stream) noexcept
+            {
+                out_stream << in_indent << "<property name=\"NumAllocations\" value=\"" << in_allocationStats.GetNumAllocations() << "\"/>\n";
+                out_stream << in_indent << "<property name=\"NumAllocatedBytes\" value=\"" << in_allocationStats.GetNumBytes() << "\"/>\n";
+                out_stream << in_indent << "<property name=\"PeakLiveBytes\" value=\"" << in_allocationStats.GetPeakLiveBytes() << "\"/>\n";
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_failedTestCase - The failed unit test case.
+            ///
+            /// @return A readable description of each failed assertion in the test case.
+            //------------------------------------------------------------------------------
+            std::string GetFailureDescription(const UnitTest::FailedTestCase& in_failedTestCase) noexcept
+            {
+                std::string output;
+                
+                for (const auto& failedSection : in_failedTestCase.GetFailedSections())
+                {
+                    for (const auto& failedAssertion : failedSection.GetFailedAssertions())
+                    {
+                        output += failedSection.GetName() + ": " + failedAssertion.GetFilePath() + ":" + CS::ToString(failedAssertion.GetLine()) + ": " + failedAssertion.GetErrorMessage() + "\n";
+                    }
+                }
+                
+                return output;
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string JUnitReportWriter::EscapeXml(const std::string& in_string) noexcept
+        {
+            std::string output;
+            output.reserve(in_string.size());
+            
+            for (auto character : in_string)
+            {
+                switch (character)
+                {
+                    case '&':
+                        output += "&amp;";
+                        break;
+                    case '<':
+                        output += "&lt;";
+                        break;
+                    case '>':
+                        output += "&gt;";
+                        break;
+                    case '"':
+                        output += "&quot;";
+                        break;
+                    case '\'':
+                        output += "&apos;";
+                        break;
+                    case '\t':
+                    case '\n':
+                    case '\r':
+                        output += character;
+                        break;
+                    default:
+                        // XML 1.0 doesn't allow any other control characters, even as entities.
+                        output += (static_cast<unsigned char>(character) < 0x20) ? '?' : character;
+                        break;
+                }
+            }
+            
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string JUnitReportWriter::ToJUnitXml(const IntegrationTest::Report& in_report) noexcept
+        {
+            std::ostringstream testCasesStream;
+            f64 totalSeconds = 0.0;
+            
+            for (const auto& testResult : in_report.GetTestResults())
+            {
+                testCasesStream << "    <testcase classname=\"" << EscapeXml(testResult.GetDesc().GetTestCaseName()) << "\" name=\"" << EscapeXml(testResult.GetDesc().GetTestName())
+                    << "\" time=\"" << ToTimeString(testResult.GetDurationSeconds()) << "\">\n";
+                
+                testCasesStream << "      <properties>\n";
+                testCasesStream << "        <property name=\"NumFrames\" value=\"" << testResult.GetNumFrames() << "\"/>\n";
+                testCasesStream << "        <property name=\"MainThreadSeconds\" value=\"" << ToTimeString(testResult.GetMainThreadSeconds()) << "\"/>\n";
+                
+                if (AllocationTracker::IsEnabled())
+                {
+                    WriteAllocationProperties(testResult.GetAllocationStats(), "        ", testCasesStream);
+                }
+                
+                if (testResult.HasBenchmarkStats())
+                {
+                    const auto& stats = testResult.GetBenchmarkStats();
+                    testCasesStream << "        <property name=\"NumIterations\" value=\"" << stats.GetNumIterations() << "\"/>\n";
+                    testCasesStream << "        <property name=\"MinSeconds\" value=\"" << ToTimeString(stats.GetMinSeconds()) << "\"/>\n";
+                    testCasesStream << "        <property name=\"MedianSeconds\" value=\"" << ToTimeString(stats.GetMedianSeconds()) << "\"/>\n";
+                    testCasesStream << "        <property name=\"MeanSeconds\" value=\"" << ToTimeString(stats.GetMeanSeconds()) << "\"/>\n";
+                    testCasesStream << "        <property name=\"P95Seconds\" value=\"" << ToTimeString(stats.GetP95Seconds()) << "\"/>\n";
+                    testCasesStream << "        <property name=\"P99Seconds\" value=\"" << ToTimeString(stats.GetP99Seconds()) << "\"/>\n";
+                    testCasesStream << "        <property name=\"MaxSeconds\" value=\"" << ToTimeString(stats.GetMaxSeconds()) << "\"/>\n";
+                    testCasesStream << "        <property name=\"CoefficientOfVariation\" value=\"" << stats.GetCoefficientOfVariation() << "\"/>\n";
+                }
+                
+                for (const auto& latencyRecord : testResult.GetLatencyRecords())
+                {
+                    testCasesStream << "        <property name=\"Latency." << EscapeXml(latencyRecord.GetName()) << ".Seconds\" value=\"" << ToTimeString(latencyRecord.GetSeconds()) << "\"/>\n";
+                    testCasesStream << "        <property name=\"Latency." << EscapeXml(latencyRecord.GetName()) << ".NumFrames\" value=\"" << latencyRecord.GetNumFrames() << "\"/>\n";
+                }
+                
+                testCasesStream << "      </properties>\n";
+                
+                if (!testResult.HasPassed())
+                {
+                    testCasesStream << "      <failure message=\"" << EscapeXml(testResult.GetErrorMessage()) << "\"/>\n";
+                }
+                
+                testCasesStream << "    </testcase>\n";
+                totalSeconds += testResult.GetDurationSeconds();
+            }
+            
+            std::ostringstream stream;
+            stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+            stream << "<testsuites>\n";
+            stream << "  <testsuite name=\"" << k_integrationTestSuiteName << "\" tests=\"" << in_report.GetNumTests() << "\" failures=\"" << in_report.GetNumFailedTests()
+                << "\" errors=\"0\" time=\"" << ToTimeString(totalSeconds) << "\">\n";
+            
+            if (!in_report.GetTestStabilities().empty())
+            {
+                stream << "    <properties>\n";
+                for (const auto& testStability : in_report.GetTestStabilities())
+                {
+                    auto name = EscapeXml(testStability.GetDesc().GetTestCaseName() + "/" + testStability.GetDesc().GetTestName());
+                    stream << "      <property name=\"Stability." << name << ".PassRate\" value=\"" << testStability.GetNumPassed() << "/" << testStability.GetNumRuns() << "\"/>\n";
+                    stream << "      <property name=\"Stability." << name << ".CoefficientOfVariation\" value=\"" << testStability.GetCoefficientOfVariation() << "\"/>\n";
+                    if (testStability.IsFlaky())
+                    {
+                        stream << "      <property name=\"Stability." << name << ".Flaky\" value=\"true\"/>\n";
+                    }
+                    if (testStability.IsNoisy())
+                    {
+                        stream << "      <property name=\"Stability." << name << ".Noisy\" value=\"true\"/>\n";
+                    }
+                }
+                stream << "    </properties>\n";
+            }
+            
+            stream << testCasesStream.str();
+            stream << "  </testsuite>\n";
+            stream << "</testsuites>\n";
+            
+            return stream.str();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string JUnitReportWriter::ToJUnitXml(const UnitTest::Report& in_report) noexcept
+        {
+            std::unordered_map<std::string, const UnitTest::FailedTestCase*> failedTestCases;
+            for (const auto& failedTestCase : in_report.GetFailedTestCases())
+            {
+                failedTestCases.emplace(failedTestCase.GetName(), &failedTestCase);
+            }
+            
+            std::ostringstream testCasesStream;
+            f64 totalSeconds = 0.0;
+            
+            for (const auto& testCaseResult : in_report.GetTestCaseResults())
+            {
+                testCasesStream << "    <testcase classname=\"" << k_unitTestSuiteName << "\" name=\"" << EscapeXml(testCaseResult.GetName())
+                    << "\" time=\"" << ToTimeString(testCaseResult.GetDurationSeconds()) << "\"";
+                
+                auto failedIt = failedTestCases.find(testCaseResult.GetName());
+                auto hasProperties = AllocationTracker::IsEnabled() || !testCaseResult.GetBenchmarkResults().empty();
+                if (failedIt == failedTestCases.end() && !hasProperties)
+                {
+                    testCasesStream << "/>\n";
+                }
+                else
+                {
+                    testCasesStream << ">\n";
+                    
+                    if (hasProperties)
+                    {
+                        testCasesStream << "      <properties>\n";
+                        
+                        if (AllocationTracker::IsEnabled())
+                        {
+                            WriteAllocationProperties(testCaseResult.GetAllocationStats(), "        ", testCasesStream);
+                        }
+                        
+                        for (const auto& benchmarkResult : testCaseResult.GetBenchmarkResults())
+                        {
+                            auto prefix = "        <property name=\"Benchmark." + EscapeXml(benchmarkResult.GetName());
+                            testCasesStream << prefix << ".NumIterations\" value=\"" << benchmarkResult.GetNumIterations() << "\"/>\n";
+                            testCasesStream << prefix << ".MeanSeconds\" value=\"" << ToTimeString(benchmarkResult.GetMeanSeconds()) << "\"/>\n";
+                            testCasesStream << prefix << ".MedianSeconds\" value=\"" << ToTimeString(benchmarkResult.GetMedianSeconds()) << "\"/>\n";
+                            testCasesStream << prefix << ".StdDevSeconds\" value=\"" << ToTimeString(benchmarkResult.GetStdDevSeconds()) << "\"/>\n";
+                            testCasesStream << prefix << ".CoefficientOfVariation\" value=\"" << benchmarkResult.GetCoefficientOfVariation() << "\"/>\n";
+                        }
+                        
+                        testCasesStream << "      </properties>\n";
+                    }
+                    
+                    if (failedIt != failedTestCases.end())
+                    {
+                        const auto& failedTestCase = *failedIt->second;
+                        testCasesStream << "      <failure message=\"" << failedTestCase.GetNumFailedAssertions() << " of " << failedTestCase.GetNumAssertions() << " assertions failed.\">"
+                            << EscapeXml(GetFailureDescription(failedTestCase)) << "</failure>\n";
+                    }
+                    
+                    testCasesStream << "    </testcase>\n";
+                }
+                
+                totalSeconds += testCaseResult.GetDurationSeconds();
+            }
+            
+            std::ostringstream stream;
+            stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+            stream << "<testsuites>\n";
+            stream << "  <testsuite name=\"" << k_unitTestSuiteName << "\" tests=\"" << in_report.GetNumTestCases() << "\" failures=\"" << in_report.GetNumFailedTestCases()
+                << "\" errors=\"0\" time=\"" << ToTimeString(totalSeconds) << "\">\n";
+            stream << testCasesStream.str();
+            stream << "  </testsuite>\n";
+            stream << "</testsuites>\n";
+            
+            return stream.str();
+        }
+    }
+}
@@ -0,0 +1,70 @@
+//
+//  JUnitReportWriter.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_REPORT_JUNITREPORTWRITER_H_
+#define _COMMON_REPORT_JUNITREPORTWRITER_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Converts integration and unit test reports to JUnit XML, which is
+        /// understood by most build servers.
+        ///
+        /// This is stateless and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class JUnitReportWriter final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_string - The string to escape.
+            ///
+            /// @return The string with all characters which are reserved in XML attribute
+            /// and element values replaced with their entities, and any control
+            /// characters which XML 1.0 doesn't allow replaced with '?'.
+            //------------------------------------------------------------------------------
+            static std::string EscapeXml(const std::string& in_string) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_report - The integration test report.
+            ///
+            /// @return The report as a JUnit XML string.
+            //------------------------------------------------------------------------------
+            static std::string ToJUnitXml(const IntegrationTest::Report& in_report) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_report - The unit test report.
+            ///
+            /// @return The report as a JUnit XML string.
+            //------------------------------------------------------------------------------
+            static std::string ToJUnitXml(const UnitTest::Report& in_report) noexcept;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,143 @@
+//
+//  JsonReportReader.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Report/JsonReportReader.h>
+
+#include <UnitTest/TestSystem/Report.h>
+
+#include <ChilliSource/Core/Json.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// @param in_json - A json object describing a failed test case.
+            ///
+            /// @return The failed test case.
+            //------------------------------------------------------------------------------
+            UnitTest::FailedTestCase ToFailedTestCase(const Json::Value& in_json) noexcept
+            {
+                std::vector<UnitTest::FailedSection> failedSections;
+                
+                const auto& failedSectionsJson = in_json["FailedSections"];
+                for (u32 i = 0; failedSectionsJson.isArray() && i < failedSectionsJson.size(); ++i)
+                {
+                    const auto& failedSectionJson = failedSectionsJson[i];
+                    
+                    std::vector<UnitTest::FailedAssertion> failedAssertions;
+                    const auto& failedAssertionsJson = failedSectionJson["FailedAssertions"];
+                    for (u32 j = 0; failedAssertionsJson.isArray() && j < failedAssertionsJson.size(); ++j)
+                    {
+                        const auto& failedAssertionJson = failedAssertionsJson[j];
+                        failedAssertions.push_back(UnitTest::FailedAssertion(failedAssertionJson.get("FilePath", "").asString(), failedAssertionJson.get("Line", 0).asUInt(),
+                                                                             failedAssertionJson.get("ErrorMessage", "").asString()));
+                    }
+                    
+                    failedSections.push_back(UnitTest::FailedSection(failedSectionJson.get("Name", "").asString(), failedSectionJson.get("NumAssertions", 0).asUInt(), failedAssertions));
+                }
+                
+                return UnitTest::FailedTestCase(in_json.get("Name", "").asString(), in_json.get("NumSections", 0).asUInt(), in_json.get("NumAssertions", 0).asUInt(), failedSections);
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_json - A json object describing a test case.
+            ///
+            /// @return The test case result.
+            //------------------------------------------------------------------------------
+            UnitTest::TestCaseResult ToTestCaseResult(const Json::Value& in_json) noexcept
+            {
+                const auto& allocations = in_json["Allocations"];
+                AllocationStats allocationStats(u64(allocations.get("NumAllocations", 0.0).asDouble()), u64(allocations.get("NumBytes", 0.0).asDouble()),
+                                                u64(allocations.get("PeakLiveBytes", 0.0).asDouble()));
+                
+                std::vector<UnitTest::BenchmarkResult> benchmarkResults;
+                const auto& benchmarks = in_json["Benchmarks"];
+                for (u32 i = 0; benchmarks.isArray() && i < benchmarks.size(); ++i)
+                {
+                    const auto& benchmark = benchmarks[i];
+                    
+                    std::vector<f32> sampleSeconds;
+                    const auto& sampleSecondsJson = benchmark["SampleSeconds"];
+                    for (u32 j = 0; sampleSecondsJson.isArray() && j < sampleSecondsJson.size(); ++j)
+                    {
+                        sampleSeconds.push_back(f32(sampleSecondsJson[j].asDouble()));
+                    }
+                    
+                    if (!sampleSeconds.empty())
+                    {
+                        benchmarkResults.push_back(UnitTest::BenchmarkResult(benchmark.get("Name", "").asString(), u64(benchmark.get("NumIterations", 0.0).asDouble()), sampleSeconds));
+                    }
+                }
+                
+                auto name = in_json.get("Name", "").asString();
+                
+                std::vector<UnitTest::SectionResult> sectionResults;
+                const auto& sections = in_json["Sections"];
+                for (u32 i = 0; sections.isArray() && i < sections.size(); ++i)
+                {
+                    const auto& section = sections[i];
+                    sectionResults.push_back(UnitTest::SectionResult(name, section.get("Name", "").asString(), f32(section.get("DurationSeconds", 0.0).asDouble()), section.get("NumRuns", 0).asUInt()));
+                }
+                
+                return UnitTest::TestCaseResult(name, in_json.get("Passed", false).asBool(), f32(in_json.get("DurationSeconds", 0.0).asDouble()), allocationStats, benchmarkResults, sectionResults);
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool JsonReportReader::FromJson(const std::string& in_json, UnitTest::Report& out_report) noexcept
+        {
+            Json::Value root;
+            Json::Reader reader;
+            if (!reader.parse(in_json, root) || !root.isObject() || !root["TestCases"].isArray())
+            {
+                return false;
+            }
+            
+            std::vector<UnitTest::FailedTestCase> failedTestCases;
+            std::vector<UnitTest::TestCaseResult> testCaseResults;
+            
+            const auto& testCases = root["TestCases"];
+            for (u32 i = 0; i < testCases.size(); ++i)
+            {
+                const auto& testCase = testCases[i];
+                
+                if (testCase["FailedSections"].isArray())
+                {
+                    failedTestCases.push_back(ToFailedTestCase(testCase));
+                }
+                
+                testCaseResults.push_back(ToTestCaseResult(testCase));
+            }
+            
+            out_report = UnitTest::Report(root.get("NumTestCases", 0).asUInt(), root.get("NumSections", 0).asUInt(), root.get("NumAssertions", 0).asUInt(), failedTestCases, testCaseResults);
+            return true;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+//
+//  JsonReportReader.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_REPORT_JSONREPORTREADER_H_
+#define _COMMON_REPORT_JSONREPORTREADER_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Rebuilds reports from the json written by JsonReportWriter. This is used to
+        /// collect the reports of unit test processes forked by the TestSystem.
+        ///
+        /// This is stateless and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class JsonReportReader final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_json - A unit test report json string created by
+            /// JsonReportWriter::ToJson().
+            /// @param out_report - [Out] The unit test report. This is only set if parsing
+            /// succeeded.
+            ///
+            /// @return Whether or not the json could be parsed.
+            //------------------------------------------------------------------------------
+            static bool FromJson(const std::string& in_json, UnitTest::Report& out_report) noexcept;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,355 @@
+//
+//  JsonReportWriter.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Report/JsonReportWriter.h>
+
+#include <Common/Memory/AllocatorStats.h>
+#include <Common/Performance/AllocationTracker.h>
+#include <Common/Performance/SoakReport.h>
+#include <IntegrationTest/TestSystem/Report.h>
+#include <UnitTest/TestSystem/Report.h>
+
+#include <ChilliSource/Core/Json.h>
+
+#include <unordered_map>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            constexpr char k_integrationTestSuiteName[] = "IntegrationTest";
+            constexpr char k_unitTestSuiteName[] = "UnitTest";
+            
+            //------------------------------------------------------------------------------
+            /// @param in_allocationStats - The allocation stats.
+            ///
+            /// @return The allocation stats as a json object. Counts are written as
+            /// doubles as they may exceed the range of a json integer.
+            //------------------------------------------------------------------------------
+            Json::Value ToJsonValue(const AllocationStats& in_allocationStats) noexcept
+            {
+                Json::Value allocations(Json::objectValue);
+                allocations["NumAllocations"] = f64(in_allocationStats.GetNumAllocations());
+                allocations["NumBytes"] = f64(in_allocationStats.GetNumBytes());
+                allocations["PeakLiveBytes"] = f64(in_allocationStats.GetPeakLiveBytes());
+                return allocations;
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string JsonReportWriter::ToJson(const IntegrationTest::Report& in_report) noexcept
+        {
+            Json::Value tests(Json::arrayValue);
+            f64 totalSeconds = 0.0;
+            
+            for (const auto& testResult : in_report.GetTestResults())
+            {
+                Json::Value test(Json::objectValue);
+                test["TestCase"] = testResult.GetDesc().GetTestCaseName();
+                test["Test"] = testResult.GetDesc().GetTestName();
+                test["Passed"] = testResult.HasPassed();
+                test["DurationSeconds"] = f64(testResult.GetDurationSeconds());
+                test["MainThreadSeconds"] = f64(testResult.GetMainThreadSeconds());
+                test["NumFrames"] = testResult.GetNumFrames();
+                
+                if (AllocationTracker::IsEnabled())
+                {
+                    test["Allocations"] = ToJsonValue(testResult.GetAllocationStats());
+                }
+                
+                if (!testResult.HasPassed())
+                {
+                    test["ErrorMessage"] = testResult.GetErrorMessage();
+                }
+                
+                if (testResult.HasBenchmarkStats())
+                {
+                    const auto& stats = testResult.GetBenchmarkStats();
+                    
+                    Json::Value benchmark(Json::objectValue);
+                    benchmark["NumIterations"] = stats.GetNumIterations();
+                    benchmark["MinSeconds"] = f64(stats.GetMinSeconds());
+                    benchmark["MaxSeconds"] = f64(stats.GetMaxSeconds());
+                    benchmark["MeanSeconds"] = f64(stats.GetMeanSeconds());
+                    benchmark["MedianSeconds"] = f64(stats.GetMedianSeconds());
+                    benchmark["P95Seconds"] = f64(stats.GetP95Seconds());
+                    benchmark["P99Seconds"] = f64(stats.GetP99Seconds());
+                    benchmark["StdDevSeconds"] = f64(stats.GetStdDevSeconds());
+                    benchmark["CoefficientOfVariation"] = f64(stats.GetCoefficientOfVariation());
+                    benchmark["Throughput"] = f64(stats.GetThroughput());
+                    test["Benchmark"] = benchmark;
+                }
+                
+                if (!testResult.GetLatencyRecords().empty())
+                {
+                    Json::Value latencies(Json::arrayValue);
+                    for (const auto& latencyRecord : testResult.GetLatencyRecords())
+                    {
+                        Json::Value latency(Json::objectValue);
+                        latency["Name"] = latencyRecord.GetName();
+                        latency["Seconds"] = f64(latencyRecord.GetSeconds());
+                        latency["NumFrames"] = latencyRecord.GetNumFrames();
+                        if (latencyRecord.GetMaxSeconds() != IntegrationTest::LatencyRecord::k_noSecondsBudget)
+                        {
+                            latency["MaxSeconds"] = f64(latencyRecord.GetMaxSeconds());
+                        }
+                        if (latencyRecord.GetMaxFrames() != IntegrationTest::LatencyRecord::k_noFramesBudget)
+                        {
+                            latency["MaxFrames"] = latencyRecord.GetMaxFrames();
+                        }
+                        latency["WithinBudget"] = latencyRecord.IsWithinBudget();
+                        latencies.append(latency);
+                    }
+                    test["Latencies"] = latencies;
+                }
+                
+                totalSeconds += testResult.GetDurationSeconds();
+                tests.append(test);
+            }
+            
+            Json::Value stabilities(Json::arrayValue);
+            for (const auto& testStability : in_report.GetTestStabilities())
+            {
+                Json::Value stability(Json::objectValue);
+                stability["TestCase"] = testStability.GetDesc().GetTestCaseName();
+                stability["Test"] = testStability.GetDesc().GetTestName();
+                stability["NumRuns"] = testStability.GetNumRuns();
+                stability["NumPassed"] = testStability.GetNumPassed();
+                stability["MeanSeconds"] = f64(testStability.GetMeanSeconds());
+                stability["StdDevSeconds"] = f64(testStability.GetStdDevSeconds());
+                stability["CoefficientOfVariation"] = f64(testStability.GetCoefficientOfVariation());
+                stability["Flaky"] = testStability.IsFlaky();
+                stability["Noisy"] = testStability.IsNoisy();
+                stabilities.append(stability);
+            }
+            
+            Json::Value root(Json::objectValue);
+            root["Suite"] = k_integrationTestSuiteName;
+            root["NumTests"] = in_report.GetNumTests();
+            root["NumFailedTests"] = in_report.GetNumFailedTests();
+            root["NumFlakyTests"] = in_report.GetNumFlakyTests();
+            root["NumNoisyTests"] = in_report.GetNumNoisyTests();
+            root["DurationSeconds"] = totalSeconds;
+            root["Tests"] = tests;
+            root["Stability"] = stabilities;
+            
+            return root.toStyledString();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string JsonReportWriter::ToJson(const UnitTest::Report& in_report) noexcept
+        {
+            std::unordered_map<std::string, const UnitTest::FailedTestCase*> failedTestCases;
+            for (const auto& failedTestCase : in_report.GetFailedTestCases())
+            {
+                failedTestCases.emplace(failedTestCase.GetName(), &failedTestCase);
+            }
+            
+            Json::Value testCases(Json::arrayValue);
+            f64 totalSeconds = 0.0;
+            
+            for (const auto& testCaseResult : in_report.GetTestCaseResults())
+            {
+                Json::Value testCase(Json::objectValue);
+                testCase["Name"] = testCaseResult.GetName();
+                testCase["Passed"] = testCaseResult.HasPassed();
+                testCase["DurationSeconds"] = f64(testCaseResult.GetDurationSeconds());
+                
+                if (AllocationTracker::IsEnabled())
+                {
+                    testCase["Allocations"] = ToJsonValue(testCaseResult.GetAllocationStats());
+                }
+                
+                if (!testCaseResult.GetBenchmarkResults().empty())
+                {
+                    Json::Value benchmarks(Json::arrayValue);
+                    for (const auto& benchmarkResult : testCaseResult.GetBenchmarkResults())
+                    {
+                        Json::Value sampleSeconds(Json::arrayValue);
+                        for (auto seconds : benchmarkResult.GetSampleSeconds())
+                        {
+                            sampleSeconds.append(f64(seconds));
+                        }
+                        
+                        Json::Value benchmark(Json::objectValue);
+                        benchmark["Name"] = benchmarkResult.GetName();
+                        benchmark["NumSamples"] = benchmarkResult.GetNumSamples();
+                        benchmark["NumIterations"] = f64(benchmarkResult.GetNumIterations());
+                        benchmark["MinSeconds"] = f64(benchmarkResult.GetMinSeconds());
+                        benchmark["MaxSeconds"] = f64(benchmarkResult.GetMaxSeconds());
+                        benchmark["MeanSeconds"] = f64(benchmarkResult.GetMeanSeconds());
+                        benchmark["MedianSeconds"] = f64(benchmarkResult.GetMedianSeconds());
+                        benchmark["StdDevSeconds"] = f64(benchmarkResult.GetStdDevSeconds());
+                        benchmark["CoefficientOfVariation"] = f64(benchmarkResult.GetCoefficientOfVariation());
+                        benchmark["SampleSeconds"] = sampleSeconds;
+                        benchmarks.append(benchmark);
+                    }
+                    
+                    testCase["Benchmarks"] = benchmarks;
+                }
+                
+                if (!testCaseResult.GetSectionResults().empty())
+                {
+                    Json::Value sections(Json::arrayValue);
+                    for (const auto& sectionResult : testCaseResult.GetSectionResults())
+                    {
+                        Json::Value section(Json::objectValue);
+                        section["Name"] = sectionResult.GetName();
+                        section["DurationSeconds"] = f64(sectionResult.GetDurationSeconds());
+                        section["NumRuns"] = sectionResult.GetNumRuns();
+                        sections.append(section);
+                    }
+                    
+                    testCase["Sections"] = sections;
+                }
+                
+                auto failedIt = failedTestCases.find(testCaseResult.GetName());
+                if (failedIt != failedTestCases.end())
+                {
+                    Json::Value failedSections(Json::arrayValue);
+                    for (const auto& failedSection : failedIt->second->GetFailedSections())
+                    {
+                        Json::Value failedAssertions(Json::arrayValue);
+                        for (const auto& failedAssertion : failedSection.GetFailedAssertions())
+                        {
+                            Json::Value failedAssertionJson(Json::objectValue);
+                            failedAssertionJson["FilePath"] = failedAssertion.GetFilePath();
+                            failedAssertionJson["Line"] = failedAssertion.GetLine();
+                            failedAssertionJson["ErrorMessage"] = failedAssertion.GetErrorMessage();
+                            failedAssertions.append(failedAssertionJson);
+                        }
+                        
+                        Json::Value failedSectionJson(Json::objectValue);
+                        failedSectionJson["Name"] = failedSection.GetName();
+                        failedSectionJson["NumAssertions"] = failedSection.GetNumAssertions();
+                        failedSectionJson["FailedAssertions"] = failedAssertions;
+                        failedSections.append(failedSectionJson);
+                    }
+                    
+                    testCase["NumSections"] = failedIt->second->GetNumSections();
+                    testCase["NumAssertions"] = failedIt->second->GetNumAssertions();
+                    testCase["FailedSections"] = failedSections;
+                }
+                
+                totalSeconds += testCaseResult.GetDurationSeconds();
+                testCases.append(testCase);
+            }
+            
+            Json::Value root(Json::objectValue);
+            root["Suite"] = k_unitTestSuiteName;
+            root["NumTestCases"] = in_report.GetNumTestCases();
+            root["NumFailedTestCases"] = in_report.GetNumFailedTestCases();
+            root["NumSections"] = in_report.GetNumSections();
+            root["NumFailedSections"] = in_report.GetNumFailedSections();
+            root["NumAssertions"] = in_report.GetNumAssertions();
+            root["NumFailedAssertions"] = in_report.GetNumFailedAssertions();
+            root["DurationSeconds"] = totalSeconds;
+            root["TestCases"] = testCases;
+            
+            return root.toStyledString();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string JsonReportWriter::ToJson(const SoakReport& in_report) noexcept
+        {
+            Json::Value passes(Json::arrayValue);
+            for (const auto& pass : in_report.GetPasses())
+            {
+                Json::Value tests(Json::objectValue);
+                for (const auto& testDuration : pass.GetTestDurations())
+                {
+                    tests[testDuration.first] = f64(testDuration.second);
+                }
+                
+                Json::Value passJson(Json::objectValue);
+                passJson["ResidentBytes"] = f64(pass.GetResidentBytes());
+                passJson["DurationSeconds"] = f64(pass.GetDurationSeconds());
+                passJson["NumFailedTests"] = pass.GetNumFailedTests();
+                passJson["Tests"] = tests;
+                passes.append(passJson);
+            }
+            
+            Json::Value testDrifts(Json::arrayValue);
+            for (const auto& testDrift : in_report.GetTestDrifts())
+            {
+                Json::Value testDriftJson(Json::objectValue);
+                testDriftJson["Test"] = testDrift.GetTestName();
+                testDriftJson["FirstSeconds"] = f64(testDrift.GetFirstSeconds());
+                testDriftJson["LastSeconds"] = f64(testDrift.GetLastSeconds());
+                testDriftJson["SecondsPerPass"] = f64(testDrift.GetSecondsPerPass());
+                testDriftJson["RelativeDriftPerPass"] = f64(testDrift.GetRelativeDriftPerPass());
+                testDrifts.append(testDriftJson);
+            }
+            
+            Json::Value root(Json::objectValue);
+            root["NumPasses"] = u32(in_report.GetPasses().size());
+            root["ResidentBytesPerPass"] = in_report.GetResidentBytesPerPass();
+            root["DurationSecondsPerPass"] = f64(in_report.GetDurationSecondsPerPass());
+            root["Passes"] = passes;
+            root["TestDrifts"] = testDrifts;
+            
+            return root.toStyledString();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string JsonReportWriter::ToJson(const std::vector<AllocatorStats>& in_allocatorStats) noexcept
+        {
+            Json::Value allocators(Json::arrayValue);
+            for (const auto& stats : in_allocatorStats)
+            {
+                Json::Value pageHistory(Json::arrayValue);
+                for (auto numPages : stats.GetPageHistory())
+                {
+                    pageHistory.append(numPages);
+                }
+                
+                Json::Value allocator(Json::objectValue);
+                allocator["Name"] = stats.GetName();
+                allocator["NumAllocations"] = f64(stats.GetNumAllocations());
+                allocator["NumDeallocations"] = f64(stats.GetNumDeallocations());
+                allocator["BytesInUse"] = f64(stats.GetBytesInUse());
+                allocator["PeakBytesInUse"] = f64(stats.GetPeakBytesInUse());
+                allocator["ReservedBytes"] = f64(stats.GetReservedBytes());
+                allocator["PeakWastedBytes"] = f64(stats.GetPeakWastedBytes());
+                allocator["PeakWastedBytesPerPage"] = f64(stats.GetPeakWastedBytesPerPage());
+                allocator["PeakUsageNumPages"] = stats.GetPeakUsageNumPages();
+                allocator["NumPages"] = stats.GetNumPages();
+                allocator["PeakNumPages"] = stats.GetPeakNumPages();
+                allocator["PageHistory"] = pageHistory;
+                allocators.append(allocator);
+            }
+            
+            Json::Value root(Json::objectValue);
+            root["Allocators"] = allocators;
+            
+            return root.toStyledString();
+        }
+    }
+}
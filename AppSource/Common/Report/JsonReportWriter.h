@@ -0,0 +1,76 @@
+//
+//  JsonReportWriter.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_REPORT_JSONREPORTWRITER_H_
+#define _COMMON_REPORT_JSONREPORTWRITER_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Converts integration test, unit test and soak reports, and allocator stats,
+        /// to json. The json contains all information in each report, so unit test
+        /// reports can be rebuilt by JsonReportReader when passed between processes.
+        ///
+        /// This is stateless and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class JsonReportWriter final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_report - The integration test report.
+            ///
+            /// @return The report as a json string.
+            //------------------------------------------------------------------------------
+            static std::string ToJson(const IntegrationTest::Report& in_report) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_report - The unit test report.
+            ///
+            /// @return The report as a json string.
+            //------------------------------------------------------------------------------
+            static std::string ToJson(const UnitTest::Report& in_report) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_report - The soak report.
+            ///
+            /// @return The report as a json string, containing the samples for each pass
+            /// and the drift across them.
+            //------------------------------------------------------------------------------
+            static std::string ToJson(const SoakReport& in_report) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_allocatorStats - The usage of a series of allocators.
+            ///
+            /// @return The allocator stats as a json string.
+            //------------------------------------------------------------------------------
+            static std::string ToJson(const std::vector<AllocatorStats>& in_allocatorStats) noexcept;
+        };
+    }
+}
+
+#endif
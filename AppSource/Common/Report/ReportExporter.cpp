@@ -0,0 +1,209 @@
+//
+//  ReportExporter.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Common/Report/ReportExporter.h>
+
+#include <Common/Core/TestConfig.h>
+#include <Common/Memory/AllocatorStats.h>
+#include <Common/Performance/SamplingProfiler.h>
+#include <Common/Performance/TraceRecorder.h>
+#include <Common/Report/CsvReportWriter.h>
+#include <Common/Report/JsonReportWriter.h>
+#include <Common/Report/JUnitReportWriter.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/File.h>
+#include <ChilliSource/Core/String.h>
+
+#include <cctype>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        namespace
+        {
+            constexpr char k_integrationTestFileName[] = "IntegrationTest";
+            constexpr char k_unitTestFileName[] = "UnitTest";
+            constexpr char k_soakFileName[] = "Soak";
+            constexpr char k_traceFileName[] = "Trace";
+            constexpr char k_allocatorStatsFileName[] = "AllocatorStats";
+            constexpr char k_jsonExtension[] = ".json";
+            constexpr char k_xmlExtension[] = ".xml";
+            constexpr char k_csvExtension[] = ".csv";
+            constexpr char k_foldedExtension[] = ".folded";
+            
+            //------------------------------------------------------------------------------
+            /// @param in_name - A name which may contain any characters.
+            ///
+            /// @return The name with any characters other than letters, digits, dots,
+            /// dashes and underscores replaced with underscores.
+            //------------------------------------------------------------------------------
+            std::string ToFileName(const std::string& in_name) noexcept
+            {
+                std::string output = in_name;
+                
+                for (auto& character : output)
+                {
+                    if (!std::isalnum(static_cast<unsigned char>(character)) && character != '.' && character != '-' && character != '_')
+                    {
+                        character = '_';
+                    }
+                }
+                
+                return output;
+            }
+        }
+        
+        constexpr char ReportExporter::k_defaultDirectoryPath[];
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ReportExporter::ReportExporter(CS::StorageLocation in_storageLocation, const std::string& in_directoryPath) noexcept
+            : m_storageLocation(in_storageLocation), m_directoryPath(in_directoryPath)
+        {
+            CS_ASSERT(m_directoryPath.empty() || m_directoryPath.back() == '/', "The report directory path must end in a slash.");
+            
+            auto testConfig = CS::Application::Get()->GetSystem<TestConfig>();
+            if (testConfig && testConfig->GetFilter().GetShardCount() > 1)
+            {
+                m_fileNameSuffix = "-Shard" + CS::ToString(testConfig->GetFilter().GetShardIndex()) + "of" + CS::ToString(testConfig->GetFilter().GetShardCount());
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ReportExporter::Export(const IntegrationTest::Report& in_report) const noexcept
+        {
+            return WriteFiles(k_integrationTestFileName, JsonReportWriter::ToJson(in_report), k_xmlExtension, JUnitReportWriter::ToJUnitXml(in_report));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ReportExporter::Export(const UnitTest::Report& in_report) const noexcept
+        {
+            return WriteFiles(k_unitTestFileName, JsonReportWriter::ToJson(in_report), k_xmlExtension, JUnitReportWriter::ToJUnitXml(in_report));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ReportExporter::Export(const SoakReport& in_report) const noexcept
+        {
+            return WriteFiles(k_soakFileName, JsonReportWriter::ToJson(in_report), k_csvExtension, CsvReportWriter::ToCsv(in_report));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ReportExporter::Export(const SamplingProfiler& in_profiler) const noexcept
+        {
+            CS_ASSERT(!in_profiler.IsRunning(), "The profiler must be stopped before it is exported.");
+            
+            auto fileSystem = CS::Application::Get()->GetFileSystem();
+            
+            if (!m_directoryPath.empty())
+            {
+                fileSystem->CreateDirectoryPath(m_storageLocation, m_directoryPath);
+            }
+            
+            auto filePath = m_directoryPath + ToFileName(in_profiler.GetName()) + m_fileNameSuffix + k_foldedExtension;
+            if (!fileSystem->WriteFile(m_storageLocation, filePath, in_profiler.ToFoldedStacks()))
+            {
+                CS_LOG_ERROR("Failed to write profile '" + in_profiler.GetName() + "'.");
+                return false;
+            }
+            
+            CS_LOG_VERBOSE("Profile written to '" + filePath + "': " + CS::ToString(in_profiler.GetNumSamples()) + " samples, " + CS::ToString(in_profiler.GetNumDroppedSamples()) + " dropped.");
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ReportExporter::Export(const TraceRecorder& in_traceRecorder) const noexcept
+        {
+            auto fileSystem = CS::Application::Get()->GetFileSystem();
+            
+            if (!m_directoryPath.empty())
+            {
+                fileSystem->CreateDirectoryPath(m_storageLocation, m_directoryPath);
+            }
+            
+            auto filePath = m_directoryPath + k_traceFileName + m_fileNameSuffix + k_jsonExtension;
+            if (!fileSystem->WriteFile(m_storageLocation, filePath, in_traceRecorder.ToJson()))
+            {
+                CS_LOG_ERROR("Failed to write trace.");
+                return false;
+            }
+            
+            CS_LOG_VERBOSE("Trace written to '" + filePath + "': " + CS::ToString(in_traceRecorder.GetNumEvents()) + " events, " + CS::ToString(in_traceRecorder.GetNumDroppedEvents()) + " dropped.");
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ReportExporter::Export(const std::vector<AllocatorStats>& in_allocatorStats) const noexcept
+        {
+            auto fileSystem = CS::Application::Get()->GetFileSystem();
+            
+            if (!m_directoryPath.empty())
+            {
+                fileSystem->CreateDirectoryPath(m_storageLocation, m_directoryPath);
+            }
+            
+            auto filePath = m_directoryPath + k_allocatorStatsFileName + m_fileNameSuffix + k_jsonExtension;
+            if (!fileSystem->WriteFile(m_storageLocation, filePath, JsonReportWriter::ToJson(in_allocatorStats)))
+            {
+                CS_LOG_ERROR("Failed to write allocator stats.");
+                return false;
+            }
+            
+            CS_LOG_VERBOSE("Allocator stats written to '" + filePath + "': " + CS::ToString(u32(in_allocatorStats.size())) + " allocators.");
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ReportExporter::WriteFiles(const std::string& in_fileName, const std::string& in_json, const std::string& in_secondaryExtension, const std::string& in_secondaryContents) const noexcept
+        {
+            auto fileSystem = CS::Application::Get()->GetFileSystem();
+            
+            if (!m_directoryPath.empty())
+            {
+                fileSystem->CreateDirectoryPath(m_storageLocation, m_directoryPath);
+            }
+            
+            auto jsonFilePath = m_directoryPath + in_fileName + m_fileNameSuffix + k_jsonExtension;
+            auto secondaryFilePath = m_directoryPath + in_fileName + m_fileNameSuffix + in_secondaryExtension;
+            
+            auto success = fileSystem->WriteFile(m_storageLocation, jsonFilePath, in_json);
+            success = fileSystem->WriteFile(m_storageLocation, secondaryFilePath, in_secondaryContents) && success;
+            
+            if (success)
+            {
+                CS_LOG_VERBOSE("Test report written to '" + jsonFilePath + "' and '" + secondaryFilePath + "'.");
+            }
+            else
+            {
+                CS_LOG_ERROR("Failed to write test report '" + in_fileName + "'.");
+            }
+            
+            return success;
+        }
+    }
+}
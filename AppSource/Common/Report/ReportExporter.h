@@ -0,0 +1,142 @@
+//
+//  ReportExporter.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _COMMON_REPORT_REPORTEXPORTER_H_
+#define _COMMON_REPORT_REPORTEXPORTER_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace Common
+    {
+        //------------------------------------------------------------------------------
+        /// Writes integration and unit test reports to file in machine readable
+        /// formats, so that results and timings can be tracked across builds without
+        /// scraping the log. Each report is written both as json, using the
+        /// JsonReportWriter, and as JUnit XML, using the JUnitReportWriter. Soak
+        /// reports are written as json and as CSV, using the CsvReportWriter.
+        /// Sampling profiles are written in the folded stack format understood by
+        /// flame graph tools, traces in the trace event format understood by
+        /// chrome://tracing, and allocator stats as json.
+        ///
+        /// When the tests are sharded, the shard is appended to each file name, for
+        /// example IntegrationTest-Shard1of4.json, so that shards which run at the same
+        /// time on one machine don't overwrite each other's reports.
+        ///
+        /// This is immutable and therefore thread-safe, though exporting accesses the
+        /// file system.
+        //------------------------------------------------------------------------------
+        class ReportExporter final
+        {
+        public:
+            static constexpr char k_defaultDirectoryPath[] = "Reports/";
+            //------------------------------------------------------------------------------
+            /// @param in_storageLocation - [Optional] The storage location reports will be
+            /// written to. Must be writable. Defaults to save data.
+            /// @param in_directoryPath - [Optional] The directory reports will be written
+            /// to.
+            //------------------------------------------------------------------------------
+            ReportExporter(CS::StorageLocation in_storageLocation = CS::StorageLocation::k_saveData, const std::string& in_directoryPath = k_defaultDirectoryPath) noexcept;
+            //------------------------------------------------------------------------------
+            /// Writes the given report to IntegrationTest.json and IntegrationTest.xml
+            /// in the output directory.
+            ///
+            /// @param in_report - The integration test report.
+            ///
+            /// @return Whether or not both files were written successfully.
+            //------------------------------------------------------------------------------
+            bool Export(const IntegrationTest::Report& in_report) const noexcept;
+            //------------------------------------------------------------------------------
+            /// Writes the given report to UnitTest.json and UnitTest.xml in the output
+            /// directory.
+            ///
+            /// @param in_report - The unit test report.
+            ///
+            /// @return Whether or not both files were written successfully.
+            //------------------------------------------------------------------------------
+            bool Export(const UnitTest::Report& in_report) const noexcept;
+            //------------------------------------------------------------------------------
+            /// Writes the given report to Soak.json and Soak.csv in the output directory.
+            ///
+            /// @param in_report - The soak report.
+            ///
+            /// @return Whether or not both files were written successfully.
+            //------------------------------------------------------------------------------
+            bool Export(const SoakReport& in_report) const noexcept;
+            //------------------------------------------------------------------------------
+            /// Writes the folded stacks of the given profile to <name>.folded in the
+            /// output directory. Any characters in the name which aren't suitable for a
+            /// file name are replaced with underscores.
+            ///
+            /// @param in_profiler - The profiler. Must be stopped.
+            ///
+            /// @return Whether or not the file was written successfully.
+            //------------------------------------------------------------------------------
+            bool Export(const SamplingProfiler& in_profiler) const noexcept;
+            //------------------------------------------------------------------------------
+            /// Writes the events recorded by the given trace recorder to Trace.json in
+            /// the output directory.
+            ///
+            /// @param in_traceRecorder - The trace recorder.
+            ///
+            /// @return Whether or not the file was written successfully.
+            //------------------------------------------------------------------------------
+            bool Export(const TraceRecorder& in_traceRecorder) const noexcept;
+            //------------------------------------------------------------------------------
+            /// Writes the given allocator stats to AllocatorStats.json in the output
+            /// directory.
+            ///
+            /// @param in_allocatorStats - The usage of a series of allocators.
+            ///
+            /// @return Whether or not the file was written successfully.
+            //------------------------------------------------------------------------------
+            bool Export(const std::vector<AllocatorStats>& in_allocatorStats) const noexcept;
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// Writes the given json and the given secondary format to files with the
+            /// given name in the output directory.
+            ///
+            /// @param in_fileName - The file name, without extension.
+            /// @param in_json - The json contents.
+            /// @param in_secondaryExtension - The extension of the secondary file,
+            /// including the dot.
+            /// @param in_secondaryContents - The contents of the secondary file.
+            ///
+            /// @return Whether or not both files were written successfully.
+            //------------------------------------------------------------------------------
+            bool WriteFiles(const std::string& in_fileName, const std::string& in_json, const std::string& in_secondaryExtension, const std::string& in_secondaryContents) const noexcept;
+            
+            CS::StorageLocation m_storageLocation;
+            std::string m_directoryPath;
+            std::string m_fileNameSuffix;
+        };
+    }
+}
+
+#endif
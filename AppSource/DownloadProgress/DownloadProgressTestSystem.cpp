@@ -11,7 +11,6 @@
 #include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Resource.h>
 #include <ChilliSource/Core/State.h>
-#include <ChilliSource/Core/Time.h>
 #include <ChilliSource/Networking/Http.h>
 #include <ChilliSource/UI/Base.h>
 #include <ChilliSource/UI/ProgressBar.h>
@@ -64,8 +63,6 @@ namespace CSTest
         //------------------------------------------------------------------------------
         void DownloadProgressTestSystem::OnInit()
         {
-            m_downloadProgressUpdateTimer = CS::TimerUPtr(new CS::Timer());
-            
             m_downloadProgressWidget = CreateProgressWidget();
             CS_ASSERT(m_downloadProgressWidget, "DownloadProgress widget cannot be NULL");
         }
@@ -86,7 +83,7 @@ namespace CSTest
             {
                 if(in_response.GetResult() != CS::HttpResponse::Result::k_flushed)
                 {
-                    m_downloadProgressUpdateTimer->Stop();
+                    m_downloadProgressUpdateTimer.Cancel();
                     
                     if(m_downloadProgressWidget->GetParent())
                     {
@@ -100,9 +97,8 @@ namespace CSTest
                 }
             });
             
-            //Reset the timer
-            m_downloadProgressUpdateTimer->Reset();
-            m_downloadProgressEventConnection = m_downloadProgressUpdateTimer->OpenConnection(k_downloadProgressUpdateIntervalDefault, [=]()
+            auto timerService = CS::Application::Get()->GetSystem<Common::TimerService>();
+            m_downloadProgressUpdateTimer = timerService->ScheduleRepeating(k_downloadProgressUpdateIntervalDefault, [=]() noexcept
             {
                 if(request->GetExpectedSize() > 0)
                 {
@@ -113,14 +109,12 @@ namespace CSTest
                     progressTextComponent->SetText("Total Size - " + CS::ToString(request->GetExpectedSize()) + "\nDownloaded - " + CS::ToString(request->GetDownloadedBytes()) + "\nProgress - " + percentageProgress);
                 }
             });
-            
-            m_downloadProgressUpdateTimer->Start();
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         void DownloadProgressTestSystem::OnDestroy()
         {
-            m_downloadProgressUpdateTimer->Stop();
+            m_downloadProgressUpdateTimer.Cancel();
             
             if(m_downloadProgressWidget->GetParent())
             {
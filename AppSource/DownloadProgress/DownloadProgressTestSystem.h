@@ -32,8 +32,9 @@
 
 #include <CSTest.h>
 
+#include <Common/Core/TimerService.h>
+
 #include <ChilliSource/Core/System.h>
-#include <ChilliSource/Core/Time.h>
 
 #include <functional>
 
@@ -116,8 +117,7 @@ namespace CSTest
             
             CS::WidgetSPtr m_downloadProgressWidget;
             
-            CS::TimerUPtr m_downloadProgressUpdateTimer;
-            CS::EventConnectionUPtr m_downloadProgressEventConnection;
+            Common::TimerService::Handle m_downloadProgressUpdateTimer;
         };
     }
 }
@@ -0,0 +1,251 @@
+//
+//  State.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <Headless/State.h>
+
+#include <Common/Core/TestConfig.h>
+#include <Common/Memory/AllocatorRegistry.h>
+#include <Common/Performance/PerformanceBaseline.h>
+#include <Common/Performance/PerformanceGate.h>
+#include <Common/Performance/ProcessMemory.h>
+#include <Common/Performance/TraceRecorder.h>
+#include <Common/Report/ReportExporter.h>
+#include <IntegrationTest/TestSystem/Tester.h>
+#include <UnitTest/TestSystem/TestSystem.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace CSTest
+{
+    namespace Headless
+    {
+        namespace
+        {
+            constexpr u32 k_numSoakTestDriftsLogged = 5;
+            constexpr f64 k_bytesPerKilobyte = 1024.0;
+        }
+        
+        constexpr s32 State::k_exitSuccess;
+        constexpr s32 State::k_exitTestFailure;
+        constexpr s32 State::k_exitPerformanceFailure;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::CreateSystems() noexcept
+        {
+            m_unitTestSystem = CreateSystem<UnitTest::TestSystem>();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::OnUpdate(f32 in_deltaTime) noexcept
+        {
+            if (!m_testsStarted)
+            {
+                m_testsStarted = true;
+                PerformUnitTests();
+            }
+            else if (m_soakPassPending)
+            {
+                m_soakPassPending = false;
+                StartIntegrationTests();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::PerformUnitTests() noexcept
+        {
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            
+            m_unitTestSystem->PerformTests(nullptr, [=](const UnitTest::Report& in_report) noexcept
+            {
+                OnUnitTestsComplete(in_report);
+            }, testConfig->GetFilter(), testConfig->GetNumUnitTestProcesses());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::OnUnitTestsComplete(const UnitTest::Report& in_report) noexcept
+        {
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            auto performanceResult = testConfig->GetPerformanceGate().Evaluate(Common::PerformanceBaseline::FromReport(in_report));
+            Common::ReportExporter().Export(in_report);
+            
+            CS_LOG_VERBOSE("Unit tests: " + CS::ToString(in_report.GetNumTestCases() - in_report.GetNumFailedTestCases()) + " of " + CS::ToString(in_report.GetNumTestCases()) + " test cases passed.");
+            
+            for (const auto& sectionResult : in_report.GetSlowSectionResults(testConfig->GetSlowSectionSeconds()))
+            {
+                CS_LOG_WARNING("Slow unit test section: [" + sectionResult.GetTestCaseName() + "] " + sectionResult.GetName() + " took " + CS::ToString(sectionResult.GetDurationSeconds()) + " seconds.");
+            }
+            
+            m_testsPassed = m_testsPassed && in_report.GetNumFailedTestCases() == 0;
+            m_performancePassed = m_performancePassed && performanceResult.HasPassed();
+            
+            m_soakStartTime = std::chrono::steady_clock::now();
+            StartIntegrationTests();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::StartIntegrationTests() noexcept
+        {
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            
+            auto progressUpdateDelegate = [](const IntegrationTest::TestDesc& in_testDesc, u32 in_testIndex, u32 in_numTests)
+            {
+            };
+            
+            auto completionDelegate = [=](const IntegrationTest::Report& in_report)
+            {
+                OnIntegrationTestsComplete(in_report);
+            };
+            
+            m_passStartTime = std::chrono::steady_clock::now();
+            m_tester = IntegrationTest::TesterUPtr(new IntegrationTest::Tester(progressUpdateDelegate, completionDelegate, testConfig->GetMaxConcurrentTests(), testConfig->GetFilter(), testConfig->GetNumRepeats()));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::OnIntegrationTestsComplete(const IntegrationTest::Report& in_report) noexcept
+        {
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            
+            // Later soak passes are not evaluated against the baseline, as they are expected to drift; that is what the soak report is for.
+            if (m_soakPasses.empty())
+            {
+                auto performanceResult = testConfig->GetPerformanceGate().Evaluate(Common::PerformanceBaseline::FromReport(in_report));
+                Common::ReportExporter().Export(in_report);
+                
+                m_performancePassed = m_performancePassed && performanceResult.HasPassed();
+            }
+            
+            CS_LOG_VERBOSE("Integration tests: " + CS::ToString(in_report.GetNumTests() - in_report.GetNumFailedTests()) + " of " + CS::ToString(in_report.GetNumTests()) + " test runs passed, across " +
+                           CS::ToString(in_report.GetNumDistinctTests()) + " distinct tests.");
+            
+            if (!in_report.GetTestStabilities().empty())
+            {
+                CS_LOG_VERBOSE("Integration test stability: " + CS::ToString(in_report.GetNumFlakyTests()) + " flaky, " + CS::ToString(in_report.GetNumNoisyTests()) + " noisy.");
+            }
+            
+            m_testsPassed = m_testsPassed && in_report.GetNumFailedTests() == 0;
+            
+            if (!testConfig->IsSoakEnabled())
+            {
+                Exit();
+                return;
+            }
+            
+            auto passSeconds = std::chrono::duration<f32>(std::chrono::steady_clock::now() - m_passStartTime).count();
+            m_soakPasses.push_back(Common::SoakReport::Pass(Common::ProcessMemory::GetResidentBytes(), passSeconds, in_report));
+            
+            const auto& pass = m_soakPasses.back();
+            CS_LOG_VERBOSE("Soak pass " + CS::ToString(u32(m_soakPasses.size())) + ": " + CS::ToString(f64(pass.GetResidentBytes()) / k_bytesPerKilobyte) + " KB resident, " +
+                           CS::ToString(pass.GetDurationSeconds()) + " seconds.");
+            
+            if (IsSoakPassRequired())
+            {
+                // The tester can't be replaced from within its own completion delegate, so the next pass is started on the next update.
+                m_soakPassPending = true;
+                return;
+            }
+            
+            CompleteSoak();
+            Exit();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool State::IsSoakPassRequired() const noexcept
+        {
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            auto soakSeconds = std::chrono::duration<f32>(std::chrono::steady_clock::now() - m_soakStartTime).count();
+            
+            return u32(m_soakPasses.size()) < testConfig->GetSoakPasses() || soakSeconds < testConfig->GetSoakDurationSeconds();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::CompleteSoak() noexcept
+        {
+            Common::SoakReport soakReport(m_soakPasses);
+            Common::ReportExporter().Export(soakReport);
+            
+            CS_LOG_VERBOSE("Soak complete after " + CS::ToString(u32(soakReport.GetPasses().size())) + " passes: " + CS::ToString(soakReport.GetResidentBytesPerPass() / k_bytesPerKilobyte) +
+                           " KB resident drift per pass, " + CS::ToString(soakReport.GetDurationSecondsPerPass()) + " seconds duration drift per pass.");
+            
+            const auto& testDrifts = soakReport.GetTestDrifts();
+            for (u32 i = 0; i < k_numSoakTestDriftsLogged && i < u32(testDrifts.size()) && testDrifts[i].GetSecondsPerPass() > 0.0f; ++i)
+            {
+                CS_LOG_VERBOSE("  " + testDrifts[i].GetTestName() + ": " + CS::ToString(testDrifts[i].GetFirstSeconds()) + " -> " + CS::ToString(testDrifts[i].GetLastSeconds()) + " seconds, " +
+                               CS::ToString(testDrifts[i].GetRelativeDriftPerPass() * 100.0f) + "% per pass.");
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::Exit() noexcept
+        {
+            // The trace covers every pass of a soak run, so it is only written once all passes have finished.
+            auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+            if (traceRecorder && traceRecorder->IsEnabled())
+            {
+                Common::ReportExporter().Export(*traceRecorder);
+            }
+            
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            auto allocatorRegistry = CS::Application::Get()->GetSystem<Common::AllocatorRegistry>();
+            if (testConfig->IsAllocatorStatsEnabled() && allocatorRegistry)
+            {
+                Common::ReportExporter().Export(allocatorRegistry->GetStats());
+            }
+            
+            auto exitStatus = k_exitSuccess;
+            if (!m_testsPassed)
+            {
+                CS_LOG_ERROR("Headless test run failed: one or more tests failed.");
+                exitStatus = k_exitTestFailure;
+            }
+            else if (!m_performancePassed)
+            {
+                CS_LOG_ERROR("Headless test run failed: one or more performance regressions were found.");
+                exitStatus = k_exitPerformanceFailure;
+            }
+            else
+            {
+                CS_LOG_VERBOSE("Headless test run passed.");
+            }
+            
+            // The engine has no way of returning a status code on quit, so the process is ended directly. Static
+            // destructors are skipped as engine threads are still running; all reports have been written by now.
+            std::fflush(nullptr);
+            std::_Exit(exitStatus);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void State::OnDestroy() noexcept
+        {
+            m_tester.reset();
+        }
+    }
+}
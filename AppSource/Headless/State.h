@@ -0,0 +1,129 @@
+//
+//  State.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _HEADLESS_STATE_H_
+#define _HEADLESS_STATE_H_
+
+#include <CSTest.h>
+
+#include <Common/Performance/SoakReport.h>
+
+#include <ChilliSource/Core/State.h>
+
+#include <chrono>
+#include <vector>
+
+namespace CSTest
+{
+    namespace Headless
+    {
+        //------------------------------------------------------------------------------
+        /// A state which runs the unit tests and then the integration tests back to
+        /// back, without presenting any UI. The results of each suite are evaluated
+        /// against the performance baseline and exported, after which the app exits
+        /// with a status code describing the outcome. This allows automated runs to
+        /// be scripted, and keeps presenter overhead out of performance measurements.
+        ///
+        /// If soaking is enabled in the test config the integration tests are run
+        /// repeatedly. Only the first pass is evaluated against the performance
+        /// baseline; after every pass the memory usage and test durations are sampled,
+        /// and once all passes are complete the drift across them is logged and
+        /// exported as a soak report.
+        //------------------------------------------------------------------------------
+        class State final : public CS::State
+        {
+        public:
+            static constexpr s32 k_exitSuccess = 0;
+            static constexpr s32 k_exitTestFailure = 1;
+            static constexpr s32 k_exitPerformanceFailure = 2;
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// The life-cycle event for creating all state systems.
+            //------------------------------------------------------------------------------
+            void CreateSystems() noexcept override;
+            //------------------------------------------------------------------------------
+            /// Starts the unit tests on the first update so that all systems have been
+            /// initialised, and starts any pending soak pass.
+            ///
+            /// @param in_deltaTime - The time since the last update.
+            //------------------------------------------------------------------------------
+            void OnUpdate(f32 in_deltaTime) noexcept override;
+            //------------------------------------------------------------------------------
+            /// Starts the unit tests, which are run in the background.
+            //------------------------------------------------------------------------------
+            void PerformUnitTests() noexcept;
+            //------------------------------------------------------------------------------
+            /// Called when the unit tests have completed. Processes the report and then
+            /// starts the integration tests.
+            ///
+            /// @param in_report - The unit test report.
+            //------------------------------------------------------------------------------
+            void OnUnitTestsComplete(const UnitTest::Report& in_report) noexcept;
+            //------------------------------------------------------------------------------
+            /// Starts a pass of the integration tests, replacing the previous tester.
+            //------------------------------------------------------------------------------
+            void StartIntegrationTests() noexcept;
+            //------------------------------------------------------------------------------
+            /// Called when the integration tests have completed. Processes the report and
+            /// then either flags that another soak pass is required, or exits the app.
+            ///
+            /// @param in_report - The integration test report.
+            //------------------------------------------------------------------------------
+            void OnIntegrationTestsComplete(const IntegrationTest::Report& in_report) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not another soak pass should be run.
+            //------------------------------------------------------------------------------
+            bool IsSoakPassRequired() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Logs and exports the soak report for all passes which have been run.
+            //------------------------------------------------------------------------------
+            void CompleteSoak() noexcept;
+            //------------------------------------------------------------------------------
+            /// Exits the application with the status code for the results of both suites.
+            //------------------------------------------------------------------------------
+            void Exit() noexcept;
+            //------------------------------------------------------------------------------
+            /// Destroys the tester.
+            //------------------------------------------------------------------------------
+            void OnDestroy() noexcept override;
+            
+            UnitTest::TestSystem* m_unitTestSystem = nullptr;
+            IntegrationTest::TesterUPtr m_tester;
+            bool m_testsStarted = false;
+            bool m_testsPassed = true;
+            bool m_performancePassed = true;
+            
+            bool m_soakPassPending = false;
+            std::chrono::steady_clock::time_point m_soakStartTime;
+            std::chrono::steady_clock::time_point m_passStartTime;
+            std::vector<Common::SoakReport::Pass> m_soakPasses;
+        };
+    }
+}
+
+#endif
@@ -28,12 +28,18 @@
 
 #include <IntegrationTest/State.h>
 
+#include <Common/Core/TestConfig.h>
 #include <Common/Core/TestNavigator.h>
 #include <Common/Input/BackButtonSystem.h>
+#include <Common/Performance/PerformanceBaseline.h>
+#include <Common/Performance/PerformanceGate.h>
+#include <Common/Performance/TraceRecorder.h>
+#include <Common/Report/ReportExporter.h>
 #include <IntegrationTest/TestSystem/ReportPresenter.h>
 #include <IntegrationTest/TestSystem/Tester.h>
 #include <Lighting/State.h>
 
+#include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Scene.h>
 
 namespace CSTest
@@ -61,6 +67,8 @@ namespace CSTest
             
 			m_testNavigator->SetBackButtonVisible(false);
             
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            
             auto progressUpdateDelegate = [=](const TestDesc& in_testDesc, u32 in_testIndex, u32 in_numTests)
             {
                 m_reportPresenter->PresentProgress(in_testDesc, in_testIndex, in_numTests);
@@ -68,11 +76,20 @@ namespace CSTest
             
             auto completionDelegate = [=](const Report& in_report)
             {
-                m_reportPresenter->PresentReport(in_report);
+                auto performanceResult = testConfig->GetPerformanceGate().Evaluate(Common::PerformanceBaseline::FromReport(in_report));
+                Common::ReportExporter().Export(in_report);
+                
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                if (traceRecorder && traceRecorder->IsEnabled())
+                {
+                    Common::ReportExporter().Export(*traceRecorder);
+                }
+                
+                m_reportPresenter->PresentReport(in_report, performanceResult);
 				m_testNavigator->SetBackButtonVisible(true);
             };
             
-            m_tester = TesterUPtr(new Tester(progressUpdateDelegate, completionDelegate));
+            m_tester = TesterUPtr(new Tester(progressUpdateDelegate, completionDelegate, testConfig->GetMaxConcurrentTests(), testConfig->GetFilter(), testConfig->GetNumRepeats()));
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -67,6 +67,17 @@ namespace CSTest
             {
                 TestRegistry::Get().RegisterTest(in_testDesc);
             }
+            //------------------------------------------------------------------------------
+            /// Creates a new instances of this, adding the given fixture factory to the
+            /// test registry.
+            ///
+            /// @param in_testCaseName - The name of the test case the fixture is for.
+            /// @param in_fixtureFactory - The delegate which creates the fixture.
+            //------------------------------------------------------------------------------
+            AutoRegister(const std::string& in_testCaseName, const TestRegistry::FixtureFactory& in_fixtureFactory) noexcept
+            {
+                TestRegistry::Get().RegisterFixture(in_testCaseName, in_fixtureFactory);
+            }
         };
     }
 }
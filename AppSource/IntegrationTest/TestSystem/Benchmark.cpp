@@ -0,0 +1,103 @@
+//
+//  Benchmark.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <IntegrationTest/TestSystem/Benchmark.h>
+
+#include <IntegrationTest/TestSystem/BenchmarkStats.h>
+#include <IntegrationTest/TestSystem/Test.h>
+
+#include <Common/Performance/TraceRecorder.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <chrono>
+#include <vector>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        Benchmark::Benchmark(u32 in_numWarmupIterations, u32 in_numIterations) noexcept
+            : m_numWarmupIterations(in_numWarmupIterations), m_numIterations(in_numIterations)
+        {
+            CS_ASSERT(m_numIterations > 0, "A benchmark must have at least one measured iteration.");
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Benchmark::GetNumWarmupIterations() const noexcept
+        {
+            return m_numWarmupIterations;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Benchmark::GetNumIterations() const noexcept
+        {
+            return m_numIterations;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Benchmark::Run(const TestSPtr& in_test, const IterationDelegate& in_iterationDelegate, const TeardownDelegate& in_teardownDelegate) const noexcept
+        {
+            CS_ASSERT(in_iterationDelegate, "A valid iteration delegate must be supplied.");
+            
+            auto numWarmupIterations = m_numWarmupIterations;
+            auto numIterations = m_numIterations;
+            
+            auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+            traceRecorder->ScheduleTask(CS::TaskType::k_large, [=](const CS::TaskContext& in_taskContext) noexcept
+            {
+                for (u32 i = 0; i < numWarmupIterations && in_test->IsActive(); ++i)
+                {
+                    in_iterationDelegate(in_taskContext);
+                }
+                
+                std::vector<f32> iterationSeconds;
+                iterationSeconds.reserve(numIterations);
+                
+                for (u32 i = 0; i < numIterations && in_test->IsActive(); ++i)
+                {
+                    auto startTime = std::chrono::steady_clock::now();
+                    in_iterationDelegate(in_taskContext);
+                    iterationSeconds.push_back(std::chrono::duration<f32>(std::chrono::steady_clock::now() - startTime).count());
+                }
+                
+                if (in_teardownDelegate)
+                {
+                    in_teardownDelegate();
+                }
+                
+                if (iterationSeconds.size() == numIterations)
+                {
+                    in_test->Pass(BenchmarkStats(iterationSeconds));
+                }
+            });
+        }
+    }
+}
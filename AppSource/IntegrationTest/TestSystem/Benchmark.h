@@ -0,0 +1,107 @@
+//
+//  Benchmark.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _INTEGRATIONTEST_TESTSYSTEM_BENCHMARK_H_
+#define _INTEGRATIONTEST_TESTSYSTEM_BENCHMARK_H_
+
+#include <CSTest.h>
+
+#include <functional>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        //------------------------------------------------------------------------------
+        /// Describes how a benchmark should be run, and provides the means to run it.
+        /// A benchmark is a serial integration test which runs an iteration delegate
+        /// for a number of unmeasured warm-up iterations followed by a number of
+        /// measured iterations. The measured durations are summarised in a
+        /// BenchmarkStats instance which is attached to the test, before the test
+        /// passes.
+        ///
+        /// Benchmarks are declared using the macros declared in TestCase.h.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class Benchmark final
+        {
+        public:
+            static constexpr u32 k_defaultNumWarmupIterations = 10;
+            static constexpr u32 k_defaultNumIterations = 100;
+            static constexpr f32 k_timeoutSeconds = 60.0f;
+            //------------------------------------------------------------------------------
+            /// A delegate which performs a single iteration of the benchmark. This is
+            /// called on a background task.
+            ///
+            /// @param in_taskContext - The context of the task the iteration is run in.
+            /// This can be used to process child tasks.
+            //------------------------------------------------------------------------------
+            using IterationDelegate = std::function<void(const CS::TaskContext& in_taskContext) noexcept>;
+            //------------------------------------------------------------------------------
+            /// A delegate which is called once all iterations have completed, prior to the
+            /// test passing. This is called on the same background task as the iterations
+            /// and can be used to clean up anything created for the benchmark.
+            //------------------------------------------------------------------------------
+            using TeardownDelegate = std::function<void() noexcept>;
+            //------------------------------------------------------------------------------
+            /// Constructs a new instance with the given number of iterations.
+            ///
+            /// @param in_numWarmupIterations - The number of unmeasured iterations which
+            /// are run before measuring begins.
+            /// @param in_numIterations - The number of measured iterations. Must be more
+            /// than zero.
+            //------------------------------------------------------------------------------
+            Benchmark(u32 in_numWarmupIterations, u32 in_numIterations) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of unmeasured iterations run before measuring begins.
+            //------------------------------------------------------------------------------
+            u32 GetNumWarmupIterations() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of measured iterations.
+            //------------------------------------------------------------------------------
+            u32 GetNumIterations() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Runs the benchmark on a background task. Once all iterations have been run
+            /// the stats are attached to the given test and it is passed. If the test
+            /// fails or times out part way through, no further iterations are run.
+            ///
+            /// @param in_test - The test the benchmark is being run for.
+            /// @param in_iterationDelegate - The delegate which performs one iteration.
+            /// @param in_teardownDelegate - [Optional] A delegate which will be called
+            /// once the iterations have completed.
+            //------------------------------------------------------------------------------
+            void Run(const TestSPtr& in_test, const IterationDelegate& in_iterationDelegate, const TeardownDelegate& in_teardownDelegate = nullptr) const noexcept;
+            
+        private:
+            u32 m_numWarmupIterations;
+            u32 m_numIterations;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,157 @@
+//
+//  BenchmarkStats.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <IntegrationTest/TestSystem/BenchmarkStats.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// Calculates the given percentile of a sorted list of values using the
+            /// nearest-rank method.
+            ///
+            /// @param in_sortedValues - The values, sorted in ascending order. Must not be
+            /// empty.
+            /// @param in_percentile - The percentile, in the range 0 to 100.
+            ///
+            /// @return The value at the given percentile.
+            //------------------------------------------------------------------------------
+            f32 CalcPercentile(const std::vector<f32>& in_sortedValues, f32 in_percentile) noexcept
+            {
+                CS_ASSERT(!in_sortedValues.empty(), "Cannot calculate the percentile of an empty list.");
+                
+                auto rank = std::size_t(std::ceil((in_percentile / 100.0f) * f32(in_sortedValues.size())));
+                rank = std::max(rank, std::size_t(1));
+                rank = std::min(rank, in_sortedValues.size());
+                
+                return in_sortedValues[rank - 1];
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        BenchmarkStats::BenchmarkStats(const std::vector<f32>& in_iterationSeconds) noexcept
+            : m_numIterations(u32(in_iterationSeconds.size()))
+        {
+            CS_ASSERT(!in_iterationSeconds.empty(), "A benchmark must have at least one iteration.");
+            
+            auto sortedSeconds = in_iterationSeconds;
+            std::sort(sortedSeconds.begin(), sortedSeconds.end());
+            
+            f64 totalSeconds = 0.0;
+            for (auto seconds : sortedSeconds)
+            {
+                totalSeconds += seconds;
+            }
+            
+            m_minSeconds = sortedSeconds.front();
+            m_maxSeconds = sortedSeconds.back();
+            m_meanSeconds = f32(totalSeconds / f64(sortedSeconds.size()));
+            m_medianSeconds = CalcPercentile(sortedSeconds, 50.0f);
+            m_p95Seconds = CalcPercentile(sortedSeconds, 95.0f);
+            m_p99Seconds = CalcPercentile(sortedSeconds, 99.0f);
+            
+            if (sortedSeconds.size() > 1)
+            {
+                f64 sumOfSquares = 0.0;
+                for (auto seconds : sortedSeconds)
+                {
+                    auto offset = f64(seconds) - f64(m_meanSeconds);
+                    sumOfSquares += offset * offset;
+                }
+                
+                m_stdDevSeconds = f32(std::sqrt(sumOfSquares / f64(sortedSeconds.size() - 1)));
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 BenchmarkStats::GetNumIterations() const noexcept
+        {
+            return m_numIterations;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetMinSeconds() const noexcept
+        {
+            return m_minSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetMaxSeconds() const noexcept
+        {
+            return m_maxSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetMeanSeconds() const noexcept
+        {
+            return m_meanSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetMedianSeconds() const noexcept
+        {
+            return m_medianSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetP95Seconds() const noexcept
+        {
+            return m_p95Seconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetP99Seconds() const noexcept
+        {
+            return m_p99Seconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetStdDevSeconds() const noexcept
+        {
+            return m_stdDevSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetCoefficientOfVariation() const noexcept
+        {
+            return (m_meanSeconds > 0.0f) ? m_stdDevSeconds / m_meanSeconds : 0.0f;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkStats::GetThroughput() const noexcept
+        {
+            return (m_meanSeconds > 0.0f) ? 1.0f / m_meanSeconds : 0.0f;
+        }
+    }
+}
@@ -0,0 +1,119 @@
+//
+//  BenchmarkStats.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _INTEGRATIONTEST_TESTSYSTEM_BENCHMARKSTATS_H_
+#define _INTEGRATIONTEST_TESTSYSTEM_BENCHMARKSTATS_H_
+
+#include <CSTest.h>
+
+#include <vector>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        //------------------------------------------------------------------------------
+        /// An immutable statistical summary of the measured iterations of a
+        /// benchmark. A default constructed instance contains no iterations and is
+        /// used for tests which are not benchmarks.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class BenchmarkStats final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// Constructs an empty instance which contains no iterations.
+            //------------------------------------------------------------------------------
+            BenchmarkStats() = default;
+            //------------------------------------------------------------------------------
+            /// Constructs a new instance from the durations of each measured iteration.
+            ///
+            /// @param in_iterationSeconds - The duration of each measured iteration, in
+            /// the order they were run. Must not be empty.
+            //------------------------------------------------------------------------------
+            BenchmarkStats(const std::vector<f32>& in_iterationSeconds) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of measured iterations. This will be zero if the
+            /// instance is empty.
+            //------------------------------------------------------------------------------
+            u32 GetNumIterations() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The duration of the fastest iteration.
+            //------------------------------------------------------------------------------
+            f32 GetMinSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The duration of the slowest iteration.
+            //------------------------------------------------------------------------------
+            f32 GetMaxSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The mean iteration duration.
+            //------------------------------------------------------------------------------
+            f32 GetMeanSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The median iteration duration.
+            //------------------------------------------------------------------------------
+            f32 GetMedianSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The 95th percentile iteration duration.
+            //------------------------------------------------------------------------------
+            f32 GetP95Seconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The 99th percentile iteration duration.
+            //------------------------------------------------------------------------------
+            f32 GetP99Seconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The sample standard deviation of the iteration durations. This
+            /// will be zero if there are fewer than two iterations.
+            //------------------------------------------------------------------------------
+            f32 GetStdDevSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The coefficient of variation of the iteration durations; the
+            /// standard deviation as a fraction of the mean. A benchmark with a high
+            /// coefficient of variation is too noisy to be a reliable performance signal.
+            //------------------------------------------------------------------------------
+            f32 GetCoefficientOfVariation() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of iterations which can be run per second, based on the
+            /// mean iteration duration.
+            //------------------------------------------------------------------------------
+            f32 GetThroughput() const noexcept;
+            
+        private:
+            u32 m_numIterations = 0;
+            f32 m_minSeconds = 0.0f;
+            f32 m_maxSeconds = 0.0f;
+            f32 m_meanSeconds = 0.0f;
+            f32 m_medianSeconds = 0.0f;
+            f32 m_p95Seconds = 0.0f;
+            f32 m_p99Seconds = 0.0f;
+            f32 m_stdDevSeconds = 0.0f;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,69 @@
+//
+//  Fixture.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _INTEGRATIONTEST_TESTSYSTEM_FIXTURE_H_
+#define _INTEGRATIONTEST_TESTSYSTEM_FIXTURE_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        //------------------------------------------------------------------------------
+        /// The base class for test case fixtures. A fixture holds resources which are
+        /// expensive to create and can be shared by all tests in a test case. Setup
+        /// should be performed in the constructor and teardown in the destructor.
+        ///
+        /// The fixture is created on the main thread immediately before the first test
+        /// in the test case starts. Each test shares ownership of the fixture, so it is
+        /// destroyed once the last test in the test case has completed and is no
+        /// longer referenced. A test which timed out may still be held by a background
+        /// task, in which case destruction is deferred to a main thread task, so the
+        /// destructor is always called on the main thread. Tests in the same test case
+        /// can run concurrently, so any state in the fixture which tests modify must
+        /// be synchronised by the tests.
+        ///
+        /// Fixtures are declared using the CSIT_FIXTURE() macro in TestCase.h.
+        //------------------------------------------------------------------------------
+        class Fixture
+        {
+        public:
+            CS_DECLARE_NOCOPY(Fixture);
+            //------------------------------------------------------------------------------
+            /// The default constructor.
+            //------------------------------------------------------------------------------
+            Fixture() = default;
+            //------------------------------------------------------------------------------
+            /// Virtual destructor.
+            //------------------------------------------------------------------------------
+            virtual ~Fixture() noexcept {}
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,104 @@
+//
+//  LatencyRecord.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <IntegrationTest/TestSystem/LatencyRecord.h>
+
+#include <ChilliSource/Core/String.h>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        constexpr f32 LatencyRecord::k_noSecondsBudget;
+        constexpr u32 LatencyRecord::k_noFramesBudget;
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        LatencyRecord::LatencyRecord(const std::string& in_name, f32 in_seconds, u32 in_numFrames, f32 in_maxSeconds, u32 in_maxFrames) noexcept
+            : m_name(in_name), m_seconds(in_seconds), m_numFrames(in_numFrames), m_maxSeconds(in_maxSeconds), m_maxFrames(in_maxFrames)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& LatencyRecord::GetName() const noexcept
+        {
+            return m_name;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 LatencyRecord::GetSeconds() const noexcept
+        {
+            return m_seconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 LatencyRecord::GetNumFrames() const noexcept
+        {
+            return m_numFrames;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 LatencyRecord::GetMaxSeconds() const noexcept
+        {
+            return m_maxSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 LatencyRecord::GetMaxFrames() const noexcept
+        {
+            return m_maxFrames;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool LatencyRecord::IsWithinBudget() const noexcept
+        {
+            return m_seconds <= m_maxSeconds && m_numFrames <= m_maxFrames;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string LatencyRecord::ToString() const noexcept
+        {
+            std::string budget;
+            if (m_maxSeconds != k_noSecondsBudget)
+            {
+                budget += CS::ToString(m_maxSeconds) + "s";
+            }
+            if (m_maxFrames != k_noFramesBudget)
+            {
+                budget += (budget.empty() ? "" : ", ") + CS::ToString(m_maxFrames) + " frames";
+            }
+            
+            auto output = m_name + " took " + CS::ToString(m_seconds) + "s over " + CS::ToString(m_numFrames) + " frames";
+            if (!budget.empty())
+            {
+                output += " (budget " + budget + ")";
+            }
+            
+            return output;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  LatencyRecord.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _INTEGRATIONTEST_TESTSYSTEM_LATENCYRECORD_H_
+#define _INTEGRATIONTEST_TESTSYSTEM_LATENCYRECORD_H_
+
+#include <CSTest.h>
+
+#include <limits>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        //------------------------------------------------------------------------------
+        /// An immutable record of how long an asynchronous operation in a test took,
+        /// and the budget it was checked against.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class LatencyRecord final
+        {
+        public:
+            static constexpr f32 k_noSecondsBudget = std::numeric_limits<f32>::infinity();
+            static constexpr u32 k_noFramesBudget = std::numeric_limits<u32>::max();
+            
+            //------------------------------------------------------------------------------
+            /// Constructs a new instance with the given measured latency and budget.
+            ///
+            /// @param in_name - The name of the operation.
+            /// @param in_seconds - The time the operation took.
+            /// @param in_numFrames - The number of frames which started while the
+            /// operation was in progress.
+            /// @param in_maxSeconds - The maximum time the operation was allowed to take,
+            /// or k_noSecondsBudget.
+            /// @param in_maxFrames - The maximum number of frames the operation was
+            /// allowed to span, or k_noFramesBudget.
+            //------------------------------------------------------------------------------
+            LatencyRecord(const std::string& in_name, f32 in_seconds, u32 in_numFrames, f32 in_maxSeconds, u32 in_maxFrames) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the operation.
+            //------------------------------------------------------------------------------
+            const std::string& GetName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The time the operation took.
+            //------------------------------------------------------------------------------
+            f32 GetSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of frames which started while the operation was in
+            /// progress.
+            //------------------------------------------------------------------------------
+            u32 GetNumFrames() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The maximum time the operation was allowed to take, or
+            /// k_noSecondsBudget.
+            //------------------------------------------------------------------------------
+            f32 GetMaxSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The maximum number of frames the operation was allowed to span,
+            /// or k_noFramesBudget.
+            //------------------------------------------------------------------------------
+            u32 GetMaxFrames() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not the operation completed within both its time and
+            /// frame budget.
+            //------------------------------------------------------------------------------
+            bool IsWithinBudget() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return A human readable description of the latency and its budget, for
+            /// example "Upload took 0.12s over 7 frames (budget 0.1s)".
+            //------------------------------------------------------------------------------
+            std::string ToString() const noexcept;
+            
+        private:
+            std::string m_name;
+            f32 m_seconds;
+            u32 m_numFrames;
+            f32 m_maxSeconds;
+            u32 m_maxFrames;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,61 @@
+//
+//  LatencyTimer.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <IntegrationTest/TestSystem/LatencyTimer.h>
+
+#include <ChilliSource/Core/Base.h>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        LatencyTimer::LatencyTimer(const std::string& in_name) noexcept
+            : m_name(in_name), m_startTime(std::chrono::steady_clock::now()), m_startFrameIndex(CS::Application::Get()->GetFrameIndex())
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& LatencyTimer::GetName() const noexcept
+        {
+            return m_name;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 LatencyTimer::GetElapsedSeconds() const noexcept
+        {
+            return std::chrono::duration<f32>(std::chrono::steady_clock::now() - m_startTime).count();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 LatencyTimer::GetElapsedFrames() const noexcept
+        {
+            return CS::Application::Get()->GetFrameIndex() - m_startFrameIndex;
+        }
+    }
+}
@@ -0,0 +1,83 @@
+//
+//  LatencyTimer.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _INTEGRATIONTEST_TESTSYSTEM_LATENCYTIMER_H_
+#define _INTEGRATIONTEST_TESTSYSTEM_LATENCYTIMER_H_
+
+#include <CSTest.h>
+
+#include <chrono>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        //------------------------------------------------------------------------------
+        /// Records the time and frame at which an asynchronous operation started, so
+        /// that its latency can later be checked against a budget using
+        /// Test::AssertLatency().
+        ///
+        /// This is immutable and therefore thread-safe. It should be created on the
+        /// main thread so that the start frame is accurate.
+        //------------------------------------------------------------------------------
+        class LatencyTimer final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// Constructs a new timer which starts at the current time and frame.
+            ///
+            /// @param in_name - The name of the operation being timed. This is used to
+            /// identify the latency in reports.
+            //------------------------------------------------------------------------------
+            LatencyTimer(const std::string& in_name) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the operation being timed.
+            //------------------------------------------------------------------------------
+            const std::string& GetName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// This can be called on any thread.
+            ///
+            /// @return The time elapsed since the timer was created.
+            //------------------------------------------------------------------------------
+            f32 GetElapsedSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// This should be called on the main thread, as the frame index may be
+            /// changing if read from another thread.
+            ///
+            /// @return The number of frames which have started since the timer was created.
+            //------------------------------------------------------------------------------
+            u32 GetElapsedFrames() const noexcept;
+            
+        private:
+            std::string m_name;
+            std::chrono::steady_clock::time_point m_startTime;
+            u32 m_startFrameIndex;
+        };
+    }
+}
+
+#endif
@@ -28,6 +28,10 @@
 
 #include <IntegrationTest/TestSystem/Report.h>
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
 namespace CSTest
 {
     namespace IntegrationTest
@@ -52,15 +56,212 @@ namespace CSTest
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        Report::Report(u32 in_numTests, const std::vector<FailedTest>& in_failedTests) noexcept
-            : m_numTests(in_numTests), m_failedTests(in_failedTests)
+        Report::TestResult::TestResult(const TestDesc& in_desc, bool in_passed, const std::string& in_errorMessage, f32 in_durationSeconds, u32 in_numFrames, f32 in_mainThreadSeconds,
+                                       const BenchmarkStats& in_benchmarkStats, const std::vector<LatencyRecord>& in_latencyRecords, const Common::AllocationStats& in_allocationStats) noexcept
+            : m_desc(in_desc), m_passed(in_passed), m_errorMessage(in_errorMessage), m_durationSeconds(in_durationSeconds), m_numFrames(in_numFrames), m_mainThreadSeconds(in_mainThreadSeconds),
+              m_benchmarkStats(in_benchmarkStats), m_latencyRecords(in_latencyRecords), m_allocationStats(in_allocationStats)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const TestDesc& Report::TestResult::GetDesc() const noexcept
+        {
+            return m_desc;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Report::TestResult::HasPassed() const noexcept
+        {
+            return m_passed;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& Report::TestResult::GetErrorMessage() const noexcept
+        {
+            return m_errorMessage;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 Report::TestResult::GetDurationSeconds() const noexcept
+        {
+            return m_durationSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Report::TestResult::GetNumFrames() const noexcept
+        {
+            return m_numFrames;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 Report::TestResult::GetMainThreadSeconds() const noexcept
+        {
+            return m_mainThreadSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Report::TestResult::HasBenchmarkStats() const noexcept
+        {
+            return (m_benchmarkStats.GetNumIterations() > 0);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const BenchmarkStats& Report::TestResult::GetBenchmarkStats() const noexcept
+        {
+            return m_benchmarkStats;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<LatencyRecord>& Report::TestResult::GetLatencyRecords() const noexcept
+        {
+            return m_latencyRecords;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const Common::AllocationStats& Report::TestResult::GetAllocationStats() const noexcept
+        {
+            return m_allocationStats;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        constexpr f32 Report::TestStability::k_maxReliableCoefficientOfVariation;
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        Report::TestStability::TestStability(const std::vector<TestResult>& in_testResults) noexcept
+            : m_desc(in_testResults.front().GetDesc()), m_numRuns(u32(in_testResults.size()))
+        {
+            std::vector<f32> timings;
+            for (const auto& testResult : in_testResults)
+            {
+                if (testResult.HasPassed())
+                {
+                    timings.push_back(testResult.HasBenchmarkStats() ? testResult.GetBenchmarkStats().GetMedianSeconds() : testResult.GetDurationSeconds());
+                }
+            }
+            
+            m_numPassed = u32(timings.size());
+            if (timings.empty())
+            {
+                return;
+            }
+            
+            f64 totalSeconds = 0.0;
+            for (auto seconds : timings)
+            {
+                totalSeconds += seconds;
+            }
+            m_meanSeconds = f32(totalSeconds / f64(timings.size()));
+            
+            if (timings.size() > 1)
+            {
+                f64 sumOfSquares = 0.0;
+                for (auto seconds : timings)
+                {
+                    auto offset = f64(seconds) - f64(m_meanSeconds);
+                    sumOfSquares += offset * offset;
+                }
+                
+                m_stdDevSeconds = f32(std::sqrt(sumOfSquares / f64(timings.size() - 1)));
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const TestDesc& Report::TestStability::GetDesc() const noexcept
+        {
+            return m_desc;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Report::TestStability::GetNumRuns() const noexcept
+        {
+            return m_numRuns;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Report::TestStability::GetNumPassed() const noexcept
+        {
+            return m_numPassed;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 Report::TestStability::GetMeanSeconds() const noexcept
+        {
+            return m_meanSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 Report::TestStability::GetStdDevSeconds() const noexcept
+        {
+            return m_stdDevSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 Report::TestStability::GetCoefficientOfVariation() const noexcept
+        {
+            return (m_meanSeconds > 0.0f) ? m_stdDevSeconds / m_meanSeconds : 0.0f;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Report::TestStability::IsFlaky() const noexcept
         {
+            return m_numPassed > 0 && m_numPassed < m_numRuns;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Report::TestStability::IsNoisy() const noexcept
+        {
+            return m_numPassed > 1 && GetCoefficientOfVariation() > k_maxReliableCoefficientOfVariation;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        Report::Report(const std::vector<TestResult>& in_testResults) noexcept
+            : m_testResults(in_testResults)
+        {
+            std::vector<std::string> testOrder;
+            std::unordered_map<std::string, std::vector<TestResult>> testRuns;
+            
+            for (const auto& testResult : m_testResults)
+            {
+                if (!testResult.HasPassed())
+                {
+                    m_failedTests.push_back(FailedTest(testResult.GetDesc(), testResult.GetErrorMessage()));
+                }
+                
+                auto key = testResult.GetDesc().GetTestCaseName() + "/" + testResult.GetDesc().GetTestName();
+                auto& runs = testRuns[key];
+                if (runs.empty())
+                {
+                    testOrder.push_back(key);
+                }
+                runs.push_back(testResult);
+            }
+            
+            for (const auto& key : testOrder)
+            {
+                const auto& runs = testRuns[key];
+                if (runs.size() > 1)
+                {
+                    m_testStabilities.push_back(TestStability(runs));
+                }
+            }
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         u32 Report::GetNumTests() const noexcept
         {
-            return m_numTests;
+            return u32(m_testResults.size());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Report::GetNumDistinctTests() const noexcept
+        {
+            auto numDistinctTests = u32(m_testResults.size());
+            for (const auto& testStability : m_testStabilities)
+            {
+                numDistinctTests -= testStability.GetNumRuns() - 1;
+            }
+            
+            return numDistinctTests;
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -74,5 +275,52 @@ namespace CSTest
         {
             return m_failedTests;
         }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<Report::TestResult>& Report::GetTestResults() const noexcept
+        {
+            return m_testResults;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<Report::TestResult> Report::GetSlowestTests(u32 in_maxTests) const noexcept
+        {
+            std::vector<TestResult> slowestTests = m_testResults;
+            std::stable_sort(slowestTests.begin(), slowestTests.end(), [](const TestResult& in_a, const TestResult& in_b)
+            {
+                return in_a.GetDurationSeconds() > in_b.GetDurationSeconds();
+            });
+            
+            if (slowestTests.size() > in_maxTests)
+            {
+                slowestTests.erase(slowestTests.begin() + in_maxTests, slowestTests.end());
+            }
+            
+            return slowestTests;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<Report::TestStability>& Report::GetTestStabilities() const noexcept
+        {
+            return m_testStabilities;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Report::GetNumFlakyTests() const noexcept
+        {
+            return u32(std::count_if(m_testStabilities.begin(), m_testStabilities.end(), [](const TestStability& in_testStability)
+            {
+                return in_testStability.IsFlaky();
+            }));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Report::GetNumNoisyTests() const noexcept
+        {
+            return u32(std::count_if(m_testStabilities.begin(), m_testStabilities.end(), [](const TestStability& in_testStability)
+            {
+                return in_testStability.IsNoisy();
+            }));
+        }
     }
 }
@@ -31,6 +31,9 @@
 
 #include <CSTest.h>
 
+#include <Common/Performance/AllocationStats.h>
+#include <IntegrationTest/TestSystem/BenchmarkStats.h>
+#include <IntegrationTest/TestSystem/LatencyRecord.h>
 #include <IntegrationTest/TestSystem/TestDesc.h>
 
 #include <vector>
@@ -86,24 +89,187 @@ namespace CSTest
                 std::string m_errorMessage;
             };
             //------------------------------------------------------------------------------
-            /// Constructs a new instance with the given list of failed tests.
+            /// An immutable container for the outcome and timing of a single integration
+            /// test, regardless of whether it passed or failed.
+            ///
+            /// This is immutable and therefore thread-safe.
+            //------------------------------------------------------------------------------
+            class TestResult final
+            {
+            public:
+                //------------------------------------------------------------------------------
+                /// Constructs a new instance with the given test description, outcome and
+                /// timing information.
+                ///
+                /// @param in_desc - The test description.
+                /// @param in_passed - Whether or not the test passed.
+                /// @param in_errorMessage - A message describing why the test failed. This
+                /// should be empty if the test passed.
+                /// @param in_durationSeconds - The wall-clock time from the test starting to
+                /// it passing or failing.
+                /// @param in_numFrames - The number of frames which elapsed while the test was
+                /// running.
+                /// @param in_mainThreadSeconds - The time spent running test code on the main
+                /// thread.
+                /// @param in_benchmarkStats - [Optional] The stats if the test is a benchmark.
+                /// @param in_latencyRecords - [Optional] The latencies recorded by the test.
+                /// @param in_allocationStats - [Optional] The heap allocations made while the
+                /// test was running.
+                //------------------------------------------------------------------------------
+                TestResult(const TestDesc& in_desc, bool in_passed, const std::string& in_errorMessage, f32 in_durationSeconds, u32 in_numFrames, f32 in_mainThreadSeconds,
+                           const BenchmarkStats& in_benchmarkStats = BenchmarkStats(), const std::vector<LatencyRecord>& in_latencyRecords = std::vector<LatencyRecord>(),
+                           const Common::AllocationStats& in_allocationStats = Common::AllocationStats()) noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The test description.
+                //------------------------------------------------------------------------------
+                const TestDesc& GetDesc() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return Whether or not the test passed.
+                //------------------------------------------------------------------------------
+                bool HasPassed() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return A message describing why the test failed, or an empty string if
+                /// it passed.
+                //------------------------------------------------------------------------------
+                const std::string& GetErrorMessage() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The wall-clock time from the test starting to it passing or
+                /// failing.
+                //------------------------------------------------------------------------------
+                f32 GetDurationSeconds() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The number of frames which elapsed while the test was running.
+                //------------------------------------------------------------------------------
+                u32 GetNumFrames() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The time spent running test code on the main thread.
+                //------------------------------------------------------------------------------
+                f32 GetMainThreadSeconds() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return Whether or not the test is a benchmark which completed all of its
+                /// measured iterations.
+                //------------------------------------------------------------------------------
+                bool HasBenchmarkStats() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The benchmark stats. This will contain no iterations if the test is
+                /// not a benchmark.
+                //------------------------------------------------------------------------------
+                const BenchmarkStats& GetBenchmarkStats() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The latencies recorded by the test, in the order they were
+                /// recorded.
+                //------------------------------------------------------------------------------
+                const std::vector<LatencyRecord>& GetLatencyRecords() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The heap allocations made while the test was running. This will
+                /// be empty unless allocation tracking is enabled.
+                //------------------------------------------------------------------------------
+                const Common::AllocationStats& GetAllocationStats() const noexcept;
+                
+            private:
+                TestDesc m_desc;
+                bool m_passed;
+                std::string m_errorMessage;
+                f32 m_durationSeconds;
+                u32 m_numFrames;
+                f32 m_mainThreadSeconds;
+                BenchmarkStats m_benchmarkStats;
+                std::vector<LatencyRecord> m_latencyRecords;
+                Common::AllocationStats m_allocationStats;
+            };
+            //------------------------------------------------------------------------------
+            /// An immutable summary of the variance of a test which was run more than
+            /// once. The timing of each run is its duration, or the median iteration time
+            /// for benchmarks, and only runs which passed are included in the timing
+            /// statistics.
+            ///
+            /// A test is flaky if it both passed and failed across the runs, and noisy if
+            /// the coefficient of variation of its timing exceeds
+            /// k_maxReliableCoefficientOfVariation, in which case it should not be relied
+            /// upon as a performance regression gate.
+            ///
+            /// This is immutable and therefore thread-safe.
+            //------------------------------------------------------------------------------
+            class TestStability final
+            {
+            public:
+                static constexpr f32 k_maxReliableCoefficientOfVariation = 0.1f;
+                //------------------------------------------------------------------------------
+                /// Constructs a new instance from the results of each run of a test.
+                ///
+                /// @param in_testResults - The results of each run of the same test. Must
+                /// not be empty.
+                //------------------------------------------------------------------------------
+                TestStability(const std::vector<TestResult>& in_testResults) noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The test description.
+                //------------------------------------------------------------------------------
+                const TestDesc& GetDesc() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The number of times the test was run.
+                //------------------------------------------------------------------------------
+                u32 GetNumRuns() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The number of runs which passed.
+                //------------------------------------------------------------------------------
+                u32 GetNumPassed() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The mean timing of the runs which passed.
+                //------------------------------------------------------------------------------
+                f32 GetMeanSeconds() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The sample standard deviation of the timing of the runs which
+                /// passed. This will be zero if fewer than two runs passed.
+                //------------------------------------------------------------------------------
+                f32 GetStdDevSeconds() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return The standard deviation of the timing as a fraction of the mean.
+                //------------------------------------------------------------------------------
+                f32 GetCoefficientOfVariation() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return Whether or not the test both passed and failed across the runs.
+                //------------------------------------------------------------------------------
+                bool IsFlaky() const noexcept;
+                //------------------------------------------------------------------------------
+                /// @return Whether or not the timing of the test is too noisy to be a
+                /// reliable performance signal.
+                //------------------------------------------------------------------------------
+                bool IsNoisy() const noexcept;
+                
+            private:
+                TestDesc m_desc;
+                u32 m_numRuns;
+                u32 m_numPassed = 0;
+                f32 m_meanSeconds = 0.0f;
+                f32 m_stdDevSeconds = 0.0f;
+            };
+            //------------------------------------------------------------------------------
+            /// Constructs a new instance with the given list of test results. If any test
+            /// was run more than once its results are summarised in a TestStability.
             ///
             /// @author Ian Copland
             ///
-            /// @param in_numTests - The total number of tests.
-            /// @param in_failedTests - A list of information on the failed tests.
+            /// @param in_testResults - The results of every test which was run, in the
+            /// order they were registered.
             //------------------------------------------------------------------------------
-            Report(u32 in_numTests, const std::vector<FailedTest>& in_failedTests) noexcept;
+            Report(const std::vector<TestResult>& in_testResults) noexcept;
             //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
-            /// @return The total number of tests.
+            /// @return The total number of tests, counting each repeat of a test
+            /// separately.
             //------------------------------------------------------------------------------
             u32 GetNumTests() const noexcept;
             //------------------------------------------------------------------------------
+            /// @return The number of distinct tests which were run, regardless of how many
+            /// times each was repeated.
+            //------------------------------------------------------------------------------
+            u32 GetNumDistinctTests() const noexcept;
+            //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
-            /// @return The number of tests which failed.
+            /// @return The number of tests which failed, counting each repeat of a test
+            /// separately.
             //------------------------------------------------------------------------------
             u32 GetNumFailedTests() const noexcept;
             //------------------------------------------------------------------------------
@@ -112,10 +278,36 @@ namespace CSTest
             /// @return The list of failed tests.
             //------------------------------------------------------------------------------
             const std::vector<FailedTest>& GetFailedTests() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The results of every test, in the order they were registered.
+            //------------------------------------------------------------------------------
+            const std::vector<TestResult>& GetTestResults() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_maxTests - The maximum number of test results to return.
+            ///
+            /// @return The results of the slowest tests by wall-clock duration, slowest
+            /// first.
+            //------------------------------------------------------------------------------
+            std::vector<TestResult> GetSlowestTests(u32 in_maxTests) const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The stability of each test which was run more than once, in the
+            /// order they were first run.
+            //------------------------------------------------------------------------------
+            const std::vector<TestStability>& GetTestStabilities() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of tests which both passed and failed across runs.
+            //------------------------------------------------------------------------------
+            u32 GetNumFlakyTests() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of tests whose timing was too noisy to be a reliable
+            /// performance signal.
+            //------------------------------------------------------------------------------
+            u32 GetNumNoisyTests() const noexcept;
             
         private:
-            u32 m_numTests;
+            std::vector<TestResult> m_testResults;
             std::vector<FailedTest> m_failedTests;
+            std::vector<TestStability> m_testStabilities;
         };
     }
 }
@@ -28,6 +28,7 @@
 
 #include <IntegrationTest/TestSystem/ReportPresenter.h>
 
+#include <Common/Performance/AllocationTracker.h>
 #include <Common/UI/BasicWidgetFactory.h>
 #include <IntegrationTest/TestSystem/Report.h>
 
@@ -46,7 +47,179 @@ namespace CSTest
         {
             constexpr char k_noTestsText[] = "No tests to run.";
             constexpr u32 k_maxTestsToDisplay = 3;
+            constexpr u32 k_numSlowestTestsToDisplay = 3;
+            constexpr u32 k_numSlowestTestsToPrint = 10;
+            constexpr f64 k_bytesPerKilobyte = 1024.0;
             
+            //------------------------------------------------------------------------------
+            /// @param in_report - The report.
+            ///
+            /// @return The number of tests in the report, followed by the total number of
+            /// runs if any test was repeated.
+            //------------------------------------------------------------------------------
+            std::string GetNumTestsDescription(const Report& in_report)
+            {
+                auto description = CS::ToString(in_report.GetNumDistinctTests()) + " tests";
+                if (in_report.GetNumDistinctTests() != in_report.GetNumTests())
+                {
+                    description += " (" + CS::ToString(in_report.GetNumTests()) + " runs)";
+                }
+                
+                return description;
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_testResult - The test result.
+            ///
+            /// @return A short description of the time taken by the given test, including
+            /// how close it came to timing out.
+            //------------------------------------------------------------------------------
+            std::string GetTimingDescription(const Report::TestResult& in_testResult)
+            {
+                auto percentOfTimeout = u32(100.0f * in_testResult.GetDurationSeconds() / in_testResult.GetDesc().GetTimeoutSeconds());
+                
+                return CS::ToString(in_testResult.GetDurationSeconds()) + "s, " + CS::ToString(in_testResult.GetNumFrames()) + " frames, " + CS::ToString(percentOfTimeout) + "% of timeout";
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_allocationStats - The allocation stats for a test.
+            ///
+            /// @return A short description of the heap allocations made by a test.
+            //------------------------------------------------------------------------------
+            std::string GetAllocationDescription(const Common::AllocationStats& in_allocationStats)
+            {
+                return CS::ToString(in_allocationStats.GetNumAllocations()) + " allocations totalling " + CS::ToString(f64(in_allocationStats.GetNumBytes()) / k_bytesPerKilobyte) +
+                    " KB, peak " + CS::ToString(f64(in_allocationStats.GetPeakLiveBytes()) / k_bytesPerKilobyte) + " KB live";
+            }
+            //------------------------------------------------------------------------------
+            /// Prints the timings of the slowest tests to console. If allocation tracking
+            /// is enabled, the allocations made by each test are also printed.
+            ///
+            /// @param in_report - The report.
+            //------------------------------------------------------------------------------
+            void PrintTimingReport(const Report& in_report)
+            {
+                CS_LOG_VERBOSE("==========================================");
+                
+                CS_LOG_VERBOSE("Slowest integration tests:");
+                CS_LOG_VERBOSE(" ");
+                
+                for (const auto& testResult : in_report.GetSlowestTests(k_numSlowestTestsToPrint))
+                {
+                    auto description = GetTimingDescription(testResult) + ", " + CS::ToString(testResult.GetMainThreadSeconds()) + "s on main thread";
+                    if (Common::AllocationTracker::IsEnabled())
+                    {
+                        description += ", " + GetAllocationDescription(testResult.GetAllocationStats());
+                    }
+                    
+                    CS_LOG_VERBOSE("[" + testResult.GetDesc().GetTestCaseName() + "] " + testResult.GetDesc().GetTestName() + ": " + description);
+                }
+                
+                CS_LOG_VERBOSE("==========================================");
+            }
+            //------------------------------------------------------------------------------
+            /// Prints the stats for each benchmark in the report to console. If there are
+            /// no benchmarks nothing is printed.
+            ///
+            /// @param in_report - The report.
+            //------------------------------------------------------------------------------
+            void PrintBenchmarkReport(const Report& in_report)
+            {
+                bool printedHeader = false;
+                
+                for (const auto& testResult : in_report.GetTestResults())
+                {
+                    if (!testResult.HasBenchmarkStats())
+                    {
+                        continue;
+                    }
+                    
+                    if (!printedHeader)
+                    {
+                        CS_LOG_VERBOSE("==========================================");
+                        CS_LOG_VERBOSE("Integration benchmarks (milliseconds per iteration):");
+                        CS_LOG_VERBOSE(" ");
+                        printedHeader = true;
+                    }
+                    
+                    const auto& stats = testResult.GetBenchmarkStats();
+                    CS_LOG_VERBOSE("[" + testResult.GetDesc().GetTestCaseName() + "] " + testResult.GetDesc().GetTestName() + ": " + CS::ToString(stats.GetNumIterations()) + " iterations" +
+                        ", min " + CS::ToString(stats.GetMinSeconds() * 1000.0f) + ", median " + CS::ToString(stats.GetMedianSeconds() * 1000.0f) +
+                        ", p95 " + CS::ToString(stats.GetP95Seconds() * 1000.0f) + ", p99 " + CS::ToString(stats.GetP99Seconds() * 1000.0f) +
+                        ", throughput " + CS::ToString(stats.GetThroughput()) + "/s, cv " + CS::ToString(stats.GetCoefficientOfVariation()));
+                }
+                
+                if (printedHeader)
+                {
+                    CS_LOG_VERBOSE("==========================================");
+                }
+            }
+            //------------------------------------------------------------------------------
+            /// Prints the flaky and noisy tests to console. If no tests were repeated,
+            /// or all repeated tests were stable, nothing is printed.
+            ///
+            /// @param in_report - The report.
+            //------------------------------------------------------------------------------
+            void PrintStabilityReport(const Report& in_report)
+            {
+                if (in_report.GetNumFlakyTests() == 0 && in_report.GetNumNoisyTests() == 0)
+                {
+                    return;
+                }
+                
+                CS_LOG_VERBOSE("==========================================");
+                CS_LOG_VERBOSE("Unstable integration tests:");
+                CS_LOG_VERBOSE(" ");
+                
+                for (const auto& testStability : in_report.GetTestStabilities())
+                {
+                    if (testStability.IsFlaky())
+                    {
+                        CS_LOG_WARNING("[" + testStability.GetDesc().GetTestCaseName() + "] " + testStability.GetDesc().GetTestName() + ": flaky, passed " +
+                            CS::ToString(testStability.GetNumPassed()) + " of " + CS::ToString(testStability.GetNumRuns()) + " runs");
+                    }
+                    
+                    if (testStability.IsNoisy())
+                    {
+                        CS_LOG_WARNING("[" + testStability.GetDesc().GetTestCaseName() + "] " + testStability.GetDesc().GetTestName() + ": noisy, mean " +
+                            CS::ToString(testStability.GetMeanSeconds() * 1000.0f) + "ms, cv " + CS::ToString(testStability.GetCoefficientOfVariation()) +
+                            " over " + CS::ToString(testStability.GetNumPassed()) + " runs");
+                    }
+                }
+                
+                CS_LOG_VERBOSE("==========================================");
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_report - The report.
+            ///
+            /// @return A summary of the slowest tests which is suitable for display
+            /// onscreen.
+            //------------------------------------------------------------------------------
+            std::string GetSlowestTestsText(const Report& in_report)
+            {
+                std::string text = "Slowest tests:";
+                
+                for (const auto& testResult : in_report.GetSlowestTests(k_numSlowestTestsToDisplay))
+                {
+                    text += "\n - " + testResult.GetDesc().GetTestCaseName() + ": " + testResult.GetDesc().GetTestName() + " (" + GetTimingDescription(testResult) + ")";
+                }
+                
+                return text;
+            }
+            //------------------------------------------------------------------------------
+            /// @param in_performanceResult - The result of comparing the run against the
+            /// performance baseline.
+            ///
+            /// @return A summary of any performance regressions suitable for appending to
+            /// the onscreen text, or an empty string if there were none.
+            //------------------------------------------------------------------------------
+            std::string GetPerformanceText(const Common::PerformanceGate::Result& in_performanceResult)
+            {
+                if (in_performanceResult.GetRegressions().empty())
+                {
+                    return "";
+                }
+                
+                return "\n \n" + CS::ToString(u32(in_performanceResult.GetRegressions().size())) + " performance regressions" + (in_performanceResult.HasPassed() ? "" : " failed the run") + ".";
+            }
             //------------------------------------------------------------------------------
             /// Prints details on a failed test report to console.
             ///
@@ -93,7 +266,7 @@ namespace CSTest
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        void ReportPresenter::PresentReport(const Report& in_report)
+        void ReportPresenter::PresentReport(const Report& in_report, const Common::PerformanceGate::Result& in_performanceResult)
         {
             if (in_report.GetNumTests() == 0)
             {
@@ -102,12 +275,17 @@ namespace CSTest
             }
             else if (in_report.GetNumFailedTests() == 0)
             {
-                SetCentreText("All " + CS::ToString(in_report.GetNumTests()) + " tests passed!");
-                CS_LOG_VERBOSE("All " + CS::ToString(in_report.GetNumTests()) + " tests passed!");
+                SetBodyText("All " + GetNumTestsDescription(in_report) + " passed!\n \n" + GetSlowestTestsText(in_report) + GetPerformanceText(in_performanceResult));
+                CS_LOG_VERBOSE("All " + GetNumTestsDescription(in_report) + " passed!");
+                
+                PrintTimingReport(in_report);
+                PrintBenchmarkReport(in_report);
+                PrintStabilityReport(in_report);
             }
             else
             {
-                std::string textBody = CS::ToString(in_report.GetNumFailedTests()) + " tests failed out of " + CS::ToString(in_report.GetNumTests()) + ":";
+                auto failureUnit = (in_report.GetNumDistinctTests() != in_report.GetNumTests()) ? " runs" : " tests";
+                std::string textBody = CS::ToString(in_report.GetNumFailedTests()) + failureUnit + " failed out of " + GetNumTestsDescription(in_report) + ":";
                 
                 int count = 0;
                 for (const auto& failedTest : in_report.GetFailedTests())
@@ -125,11 +303,16 @@ namespace CSTest
                     }
                 }
                 
+                textBody += "\n \n" + GetSlowestTestsText(in_report);
+                textBody += GetPerformanceText(in_performanceResult);
                 textBody += "\n \nPlease check the console for further information.";
                 
                 SetBodyText(textBody);
                 
                 PrintDetailedReport(in_report);
+                PrintTimingReport(in_report);
+                PrintBenchmarkReport(in_report);
+                PrintStabilityReport(in_report);
             }
         }
         //------------------------------------------------------------------------------
@@ -30,6 +30,7 @@
 #define _INTEGRATIONTEST_TESTSYSTEM_REPORTPRESENTER_H_
 
 #include <CSTest.h>
+#include <Common/Performance/PerformanceGate.h>
 #include <UnitTest/TestSystem/Report.h>
 
 #include <ChilliSource/Core/System.h>
@@ -79,8 +80,10 @@ namespace CSTest
             /// @author Ian Copland
             ///
             /// @param in_report - The test report.
+            /// @param in_performanceResult - [Optional] The result of comparing the run
+            /// against the performance baseline.
             //------------------------------------------------------------------------------
-            void PresentReport(const Report& in_report);
+            void PresentReport(const Report& in_report, const Common::PerformanceGate::Result& in_performanceResult = Common::PerformanceGate::Result());
             
         private:
             friend class CS::State;
@@ -28,9 +28,10 @@
 
 #include <IntegrationTest/TestSystem/Test.h>
 
+#include <Common/Performance/TraceRecorder.h>
+
 #include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Threading.h>
-#include <ChilliSource/Core/Time.h>
 
 namespace CSTest
 {
@@ -38,40 +39,45 @@ namespace CSTest
     {
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        TestSPtr Test::Create(const TestDesc& in_desc, const PassDelegate& in_passDelegate, const FailDelegate& in_failDelegate)
+        TestSPtr Test::Create(const TestDesc& in_desc, const PassDelegate& in_passDelegate, const FailDelegate& in_failDelegate, const FixtureSPtr& in_fixture)
         {
-            TestSPtr test(new Test(in_desc, in_passDelegate, in_failDelegate));
+            TestSPtr test(new Test(in_desc, in_passDelegate, in_failDelegate, in_fixture));
             
             // This is called here rather than inside the constructor to ensure the shared pointer exists.
+            auto bodyStartTime = std::chrono::steady_clock::now();
             test->GetDesc().GetTestDelegate()(test);
+            test->m_mainThreadSeconds = std::chrono::duration<f32>(std::chrono::steady_clock::now() - bodyStartTime).count();
             
             return test;
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        Test::Test(const TestDesc& in_desc, const PassDelegate& in_passDelegate, const FailDelegate& in_failDelegate) noexcept
-            : m_desc(in_desc), m_passDelegate(in_passDelegate), m_failDelegate(in_failDelegate)
+        Test::Test(const TestDesc& in_desc, const PassDelegate& in_passDelegate, const FailDelegate& in_failDelegate, const FixtureSPtr& in_fixture) noexcept
+            : m_desc(in_desc), m_passDelegate(in_passDelegate), m_failDelegate(in_failDelegate), m_fixture(in_fixture), m_active(true)
         {
             CS_ASSERT(m_passDelegate, "A valid pass delegate must be supplied.");
             CS_ASSERT(m_failDelegate, "A valid fail delegate must be supplied.");
             
             m_taskScheduler = CS::Application::Get()->GetTaskScheduler();
+            m_traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+            CS_ASSERT(m_traceRecorder, "The trace recorder is required to run integration tests.");
+            
+            m_startTime = std::chrono::steady_clock::now();
+            m_startFrameIndex = CS::Application::Get()->GetFrameIndex();
+            
+            auto timerService = CS::Application::Get()->GetSystem<Common::TimerService>();
+            CS_ASSERT(timerService, "The timer service is required to run integration tests.");
             
-            m_timerEventConnection = m_timer.OpenConnection(in_desc.GetTimeoutSeconds(), [=]()
+            // The timer fires on the main thread and is cancelled when the test completes or is destroyed, so capturing this is safe.
+            m_timeoutHandle = timerService->ScheduleOnce(in_desc.GetTimeoutSeconds(), [this]() noexcept
             {
-                std::unique_lock<std::mutex> lock(m_mutex);
-                
-                if (m_active)
+                if (TryDeactivate())
                 {
-                    m_active = false;
-                    m_timer.Stop();
-                    m_timerEventConnection.reset();
+                    OnComplete();
                     
                     m_failDelegate("Timed out.");
                 }
             });
-            
-            m_timer.Start();
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -81,18 +87,28 @@ namespace CSTest
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
+        Fixture* Test::GetFixture() const noexcept
+        {
+            return m_fixture.get();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
         void Test::Pass() noexcept
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
-            if (m_active)
+            Pass(BenchmarkStats());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Test::Pass(const BenchmarkStats& in_benchmarkStats) noexcept
+        {
+            if (TryDeactivate())
             {
-                m_active = false;
+                // The stats are only written by the thread which deactivated the test, so no other thread can be reading them.
+                m_benchmarkStats = in_benchmarkStats;
                 
-                m_taskScheduler->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext&) noexcept
+                m_traceRecorder->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext&) noexcept
                 {
-                    m_timer.Stop();
-                    m_timerEventConnection.reset();
+                    OnComplete();
                     
                     m_passDelegate();
                 });
@@ -102,20 +118,95 @@ namespace CSTest
         //------------------------------------------------------------------------------
         void Test::Fail(const std::string& in_message) noexcept
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
-            if (m_active)
+            if (TryDeactivate())
             {
-                m_active = false;
-                
-                m_taskScheduler->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext&) noexcept
+                m_traceRecorder->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext&) noexcept
                 {
-                    m_timer.Stop();
-                    m_timerEventConnection.reset();
+                    OnComplete();
                     
                     m_failDelegate(in_message);
                 });
             }
         }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Test::AssertLatency(const LatencyTimer& in_latencyTimer, f32 in_maxSeconds, u32 in_maxFrames) noexcept
+        {
+            LatencyRecord latencyRecord(in_latencyTimer.GetName(), in_latencyTimer.GetElapsedSeconds(), in_latencyTimer.GetElapsedFrames(), in_maxSeconds, in_maxFrames);
+            
+            {
+                std::unique_lock<std::mutex> lock(m_latencyRecordsMutex);
+                m_latencyRecords.push_back(latencyRecord);
+            }
+            
+            if (!latencyRecord.IsWithinBudget())
+            {
+                Fail("Latency budget exceeded: " + latencyRecord.ToString() + ".");
+                return false;
+            }
+            
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Test::IsActive() const noexcept
+        {
+            return m_active;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const BenchmarkStats& Test::GetBenchmarkStats() const noexcept
+        {
+            return m_benchmarkStats;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 Test::GetDurationSeconds() const noexcept
+        {
+            return m_durationSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Test::GetNumFrames() const noexcept
+        {
+            return m_numFrames;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 Test::GetMainThreadSeconds() const noexcept
+        {
+            return m_mainThreadSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<LatencyRecord> Test::GetLatencyRecords() const noexcept
+        {
+            std::unique_lock<std::mutex> lock(m_latencyRecordsMutex);
+            return m_latencyRecords;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const Common::AllocationStats& Test::GetAllocationStats() const noexcept
+        {
+            return m_allocationStats;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Test::TryDeactivate() noexcept
+        {
+            return m_active.exchange(false);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Test::OnComplete() noexcept
+        {
+            CS_ASSERT(m_taskScheduler->IsMainThread(), "Tests must complete on the main thread.");
+            
+            m_timeoutHandle.Cancel();
+            
+            m_durationSeconds = std::chrono::duration<f32>(std::chrono::steady_clock::now() - m_startTime).count();
+            m_numFrames = CS::Application::Get()->GetFrameIndex() - m_startFrameIndex;
+            m_allocationStats = m_allocationTracker.GetStats();
+        }
     }
 }
@@ -31,11 +31,18 @@
 
 #include <CSTest.h>
 
+#include <Common/Core/TimerService.h>
+#include <Common/Performance/AllocationStats.h>
+#include <Common/Performance/AllocationTracker.h>
+#include <IntegrationTest/TestSystem/BenchmarkStats.h>
+#include <IntegrationTest/TestSystem/LatencyRecord.h>
+#include <IntegrationTest/TestSystem/LatencyTimer.h>
 #include <IntegrationTest/TestSystem/TestDesc.h>
 
-#include <ChilliSource/Core/Time.h>
-
+#include <atomic>
+#include <chrono>
 #include <mutex>
+#include <vector>
 
 namespace CSTest
 {
@@ -81,10 +88,11 @@ namespace CSTest
             /// @param in_desc - The test description.
             /// @param in_passDelegate - A delegate which will be called if the test passes.
             /// @param in_failDelegate - A delegate which will be called if the test fails.
+            /// @param in_fixture - [Optional] The fixture for the test case, if it has one.
             ///
             /// @return The new test instance.
             //------------------------------------------------------------------------------
-            static TestSPtr Create(const TestDesc& in_desc, const PassDelegate& in_passDelegate, const FailDelegate& in_failDelegate);
+            static TestSPtr Create(const TestDesc& in_desc, const PassDelegate& in_passDelegate, const FailDelegate& in_failDelegate, const FixtureSPtr& in_fixture = nullptr);
             //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -92,6 +100,14 @@ namespace CSTest
             //------------------------------------------------------------------------------
             const TestDesc& GetDesc() const noexcept;
             //------------------------------------------------------------------------------
+            /// This can be called on any thread. The test shares ownership of the fixture,
+            /// so it remains valid for as long as the test does, including after the test
+            /// has passed, failed or timed out.
+            ///
+            /// @return The fixture for the test case, or null if it has no fixture.
+            //------------------------------------------------------------------------------
+            Fixture* GetFixture() const noexcept;
+            //------------------------------------------------------------------------------
             /// This should be called by the test code to signify that the test was
             /// successful.
             ///
@@ -99,6 +115,14 @@ namespace CSTest
             //------------------------------------------------------------------------------
             void Pass() noexcept;
             //------------------------------------------------------------------------------
+            /// This should be called by benchmark code to signify that the test was
+            /// successful, attaching the stats for the benchmark. The stats are discarded
+            /// if the test has already completed.
+            ///
+            /// @param in_benchmarkStats - The benchmark stats.
+            //------------------------------------------------------------------------------
+            void Pass(const BenchmarkStats& in_benchmarkStats) noexcept;
+            //------------------------------------------------------------------------------
             /// This should be called by the test code to signify that the test was
             /// unsuccessful, providing a reason as to what went wrong.
             ///
@@ -107,6 +131,78 @@ namespace CSTest
             /// @param in_message - An error message detailing why the test failed.
             //------------------------------------------------------------------------------
             void Fail(const std::string& in_message) noexcept;
+            //------------------------------------------------------------------------------
+            /// Records the latency of an asynchronous operation which was started when
+            /// the given timer was created, and fails the test if it exceeded either of
+            /// the given budgets. The latency is included in the test report regardless
+            /// of whether or not it was within budget.
+            ///
+            /// This can be called on any thread, though the frame count is only accurate
+            /// if it is called on the main thread.
+            ///
+            /// @param in_latencyTimer - The timer which was started with the operation.
+            /// @param in_maxSeconds - The maximum time the operation may take, or
+            /// LatencyRecord::k_noSecondsBudget.
+            /// @param in_maxFrames - The maximum number of frames which may start while
+            /// the operation is in progress, or LatencyRecord::k_noFramesBudget.
+            ///
+            /// @return Whether or not the operation was within budget.
+            //------------------------------------------------------------------------------
+            bool AssertLatency(const LatencyTimer& in_latencyTimer, f32 in_maxSeconds, u32 in_maxFrames) noexcept;
+            //------------------------------------------------------------------------------
+            /// This can be called on any thread.
+            ///
+            /// @return Whether or not the test is still running; that is, it has not yet
+            /// passed, failed or timed out.
+            //------------------------------------------------------------------------------
+            bool IsActive() const noexcept;
+            //------------------------------------------------------------------------------
+            /// This must be called on the main thread, and is only valid once the pass or
+            /// fail delegate has been called.
+            ///
+            /// @return The stats for the benchmark run by this test. This will contain no
+            /// iterations if the test is not a benchmark.
+            //------------------------------------------------------------------------------
+            const BenchmarkStats& GetBenchmarkStats() const noexcept;
+            //------------------------------------------------------------------------------
+            /// This must be called on the main thread, and is only valid once the pass or
+            /// fail delegate has been called.
+            ///
+            /// @return The wall-clock time from the test starting to it passing or
+            /// failing.
+            //------------------------------------------------------------------------------
+            f32 GetDurationSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// This must be called on the main thread, and is only valid once the pass or
+            /// fail delegate has been called.
+            ///
+            /// @return The number of frames which elapsed while the test was running.
+            //------------------------------------------------------------------------------
+            u32 GetNumFrames() const noexcept;
+            //------------------------------------------------------------------------------
+            /// This must be called on the main thread. Only the test body, which is run
+            /// synchronously on the main thread when the test is created, is included;
+            /// work scheduled through the task scheduler cannot be attributed to the test.
+            ///
+            /// @return The time spent running the test body on the main thread.
+            //------------------------------------------------------------------------------
+            f32 GetMainThreadSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// This must be called on the main thread, and is only valid once the pass or
+            /// fail delegate has been called.
+            ///
+            /// @return The latencies recorded by the test, in the order they were recorded.
+            //------------------------------------------------------------------------------
+            std::vector<LatencyRecord> GetLatencyRecords() const noexcept;
+            //------------------------------------------------------------------------------
+            /// This must be called on the main thread, and is only valid once the pass or
+            /// fail delegate has been called. Allocations are only tracked if the app is
+            /// built with CSTEST_ENABLE_ALLOCATION_TRACKING, otherwise this is empty.
+            ///
+            /// @return The heap allocations made by the process while the test was
+            /// running.
+            //------------------------------------------------------------------------------
+            const Common::AllocationStats& GetAllocationStats() const noexcept;
             
         private:
             //------------------------------------------------------------------------------
@@ -118,18 +214,45 @@ namespace CSTest
             /// @param in_desc - The test description.
             /// @param in_passDelegate - A delegate which will be called if the test passes.
             /// @param in_failDelegate - A delegate which will be called if the test fails.
+            /// @param in_fixture - The fixture for the test case, or null.
+            //------------------------------------------------------------------------------
+            Test(const TestDesc& in_desc, const PassDelegate& in_passDelegate, const FailDelegate& in_failDelegate, const FixtureSPtr& in_fixture) noexcept;
+            //------------------------------------------------------------------------------
+            /// Marks the test as no longer active. This can be called on any thread.
+            ///
+            /// @return Whether or not the test was active prior to this call. Only the
+            /// caller which receives true may complete the test.
             //------------------------------------------------------------------------------
-            Test(const TestDesc& in_desc, const PassDelegate& in_passDelegate, const FailDelegate& in_failDelegate) noexcept;
+            bool TryDeactivate() noexcept;
+            //------------------------------------------------------------------------------
+            /// Stops the timeout timer and records the duration, number of frames and
+            /// allocations of the test. This must be called on the main thread when the test
+            /// completes, prior to calling the pass or fail delegate.
+            //------------------------------------------------------------------------------
+            void OnComplete() noexcept;
             
             const TestDesc m_desc;
             const PassDelegate m_passDelegate;
             const FailDelegate m_failDelegate;
+            const FixtureSPtr m_fixture;
             
             CS::TaskScheduler* m_taskScheduler = nullptr;
-            bool m_active = true;
-            std::mutex m_mutex;
-            CS::Timer m_timer;
-            CS::EventConnectionUPtr m_timerEventConnection;
+            Common::TraceRecorder* m_traceRecorder = nullptr;
+            std::atomic<bool> m_active;
+            Common::TimerService::Handle m_timeoutHandle;
+            
+            std::chrono::steady_clock::time_point m_startTime;
+            u32 m_startFrameIndex = 0;
+            f32 m_durationSeconds = 0.0f;
+            u32 m_numFrames = 0;
+            f32 m_mainThreadSeconds = 0.0f;
+            BenchmarkStats m_benchmarkStats;
+            
+            mutable std::mutex m_latencyRecordsMutex;
+            std::vector<LatencyRecord> m_latencyRecords;
+            
+            Common::AllocationTracker m_allocationTracker;
+            Common::AllocationStats m_allocationStats;
         };
     }
 }
@@ -32,10 +32,13 @@
 #include <CSTest.h>
 
 #include <IntegrationTest/TestSystem/AutoRegister.h>
+#include <IntegrationTest/TestSystem/Benchmark.h>
+#include <IntegrationTest/TestSystem/Fixture.h>
 #include <IntegrationTest/TestSystem/Test.h>
 
 //------------------------------------------------------------------------------
-/// A macro used to declare a new test case.
+/// A macro used to declare a new test case. Tests in the test case may be run
+/// concurrently with other tests.
 ///
 /// @author Ian Copland
 ///
@@ -45,6 +48,21 @@
     namespace in_name##IntegrationTestCase \
     { \
         const std::string k_testCaseName_ = #in_name; \
+        const bool k_testCaseIsSerial_ = false; \
+    } \
+    namespace in_name##IntegrationTestCase
+//------------------------------------------------------------------------------
+/// A macro used to declare a new test case whose tests must never be run
+/// concurrently with any other test. This should be used for test cases which
+/// touch shared state, such as files in save data.
+///
+/// @param in_name - The name of the test case.
+//------------------------------------------------------------------------------
+#define CSIT_TESTCASE_SERIAL(in_name) \
+    namespace in_name##IntegrationTestCase \
+    { \
+        const std::string k_testCaseName_ = #in_name; \
+        const bool k_testCaseIsSerial_ = true; \
     } \
     namespace in_name##IntegrationTestCase
 //------------------------------------------------------------------------------
@@ -60,7 +78,7 @@
     void in_name##IntegrationTest(const CSTest::IntegrationTest::TestSPtr& in_thisTest_) noexcept; \
     namespace \
     { \
-        CSTest::IntegrationTest::AutoRegister in_name##IntegrationTest##AutoReg(CSTest::IntegrationTest::TestDesc(k_testCaseName_, #in_name, in_name##IntegrationTest, in_timeoutSeconds)); \
+        CSTest::IntegrationTest::AutoRegister in_name##IntegrationTest##AutoReg(CSTest::IntegrationTest::TestDesc(k_testCaseName_, #in_name, in_name##IntegrationTest, in_timeoutSeconds, k_testCaseIsSerial_)); \
     } \
     void in_name##IntegrationTest(const CSTest::IntegrationTest::TestSPtr& in_thisTest_) noexcept
 //------------------------------------------------------------------------------
@@ -72,6 +90,66 @@
 //------------------------------------------------------------------------------
 #define CSIT_TEST(in_name) CSIT_TEST_TIMEOUT(in_name, CSTest::IntegrationTest::TestDesc::k_defaultTimeoutSeconds)
 //------------------------------------------------------------------------------
+/// A macro used to declare a new benchmark with the given number of warm-up and
+/// measured iterations. If the default number of iterations is desired then the
+/// CSIT_BENCHMARK() macro should be used instead.
+///
+/// The body of a benchmark is run on the main thread, like a test, and should
+/// perform any setup before calling CSIT_BENCHMARK_RUN() with the delegate that
+/// performs a single iteration. Benchmarks are always run serially so that
+/// other tests do not skew the measurements.
+///
+/// @param in_name - The name of the benchmark.
+/// @param in_numWarmupIterations - The number of unmeasured iterations.
+/// @param in_numIterations - The number of measured iterations.
+//------------------------------------------------------------------------------
+#define CSIT_BENCHMARK_ITERATIONS(in_name, in_numWarmupIterations, in_numIterations) \
+    void in_name##IntegrationBenchmark(const CSTest::IntegrationTest::TestSPtr& in_thisTest_, const CSTest::IntegrationTest::Benchmark& in_thisBenchmark_) noexcept; \
+    namespace \
+    { \
+        CSTest::IntegrationTest::AutoRegister in_name##IntegrationBenchmark##AutoReg(CSTest::IntegrationTest::TestDesc(k_testCaseName_, #in_name, [](const CSTest::IntegrationTest::TestSPtr& in_test) noexcept \
+        { \
+            in_name##IntegrationBenchmark(in_test, CSTest::IntegrationTest::Benchmark(in_numWarmupIterations, in_numIterations)); \
+        }, CSTest::IntegrationTest::Benchmark::k_timeoutSeconds, true)); \
+    } \
+    void in_name##IntegrationBenchmark(const CSTest::IntegrationTest::TestSPtr& in_thisTest_, const CSTest::IntegrationTest::Benchmark& in_thisBenchmark_) noexcept
+//------------------------------------------------------------------------------
+/// A macro used to declare a new benchmark with the default number of warm-up
+/// and measured iterations.
+///
+/// @param in_name - The name of the benchmark.
+//------------------------------------------------------------------------------
+#define CSIT_BENCHMARK(in_name) CSIT_BENCHMARK_ITERATIONS(in_name, CSTest::IntegrationTest::Benchmark::k_defaultNumWarmupIterations, CSTest::IntegrationTest::Benchmark::k_defaultNumIterations)
+//------------------------------------------------------------------------------
+/// A macro used inside a benchmark to run its iterations. This takes a delegate
+/// which performs a single iteration, and optionally a teardown delegate, as
+/// described by Benchmark::Run(). The benchmark passes once all iterations
+/// have completed.
+//------------------------------------------------------------------------------
+#define CSIT_BENCHMARK_RUN(...) in_thisBenchmark_.Run(in_thisTest_, __VA_ARGS__)
+//------------------------------------------------------------------------------
+/// A macro used inside a test case to declare its fixture. The fixture type
+/// must inherit from Fixture and be default constructible. It should be
+/// declared before any of the tests in the test case. See Fixture for details
+/// on the fixture life-cycle.
+///
+/// @param in_fixtureType - The type of the fixture.
+//------------------------------------------------------------------------------
+#define CSIT_FIXTURE(in_fixtureType) \
+    using Fixture_ = in_fixtureType; \
+    namespace \
+    { \
+        CSTest::IntegrationTest::AutoRegister IntegrationFixtureAutoReg(k_testCaseName_, []() noexcept \
+        { \
+            return CSTest::IntegrationTest::FixtureUPtr(new in_fixtureType()); \
+        }); \
+    }
+//------------------------------------------------------------------------------
+/// A macro used inside a test in a test case which declares a fixture, which
+/// returns a reference to the fixture. This can be called on any thread.
+//------------------------------------------------------------------------------
+#define CSIT_GET_FIXTURE() (*static_cast<Fixture_*>(in_thisTest_->GetFixture()))
+//------------------------------------------------------------------------------
 /// A macro used to flag a test as passed. This can be called on any thread.
 ///
 /// @author Ian Copland
@@ -96,5 +174,42 @@
 /// not true.
 //------------------------------------------------------------------------------
 #define CSIT_ASSERT(in_condition, in_failureMessage) do{if(!(in_condition)){in_thisTest_->Fail(in_failureMessage);}} while(false)
+//------------------------------------------------------------------------------
+/// A macro used to start timing an asynchronous operation so that its latency
+/// can later be checked with CSIT_ASSERT_LATENCY(). This should be called on
+/// the main thread immediately before the operation is started.
+///
+/// @param in_name - The name of the operation, used to identify it in reports.
+///
+/// @return The latency timer.
+//------------------------------------------------------------------------------
+#define CSIT_START_LATENCY(in_name) CSTest::IntegrationTest::LatencyTimer(in_name)
+//------------------------------------------------------------------------------
+/// An assertion macro which records the latency of an operation started with
+/// CSIT_START_LATENCY() and calls Fail() if it took longer than the given time
+/// or spanned more than the given number of frames. This can be called on any
+/// thread, though the frame count is only accurate on the main thread.
+///
+/// @param in_latencyTimer - The timer returned by CSIT_START_LATENCY().
+/// @param in_maxSeconds - The maximum time the operation may take.
+/// @param in_maxFrames - The maximum number of frames which may start while
+/// the operation is in progress.
+//------------------------------------------------------------------------------
+#define CSIT_ASSERT_LATENCY(in_latencyTimer, in_maxSeconds, in_maxFrames) in_thisTest_->AssertLatency(in_latencyTimer, in_maxSeconds, in_maxFrames)
+//------------------------------------------------------------------------------
+/// The same as CSIT_ASSERT_LATENCY() but with only a time budget.
+///
+/// @param in_latencyTimer - The timer returned by CSIT_START_LATENCY().
+/// @param in_maxSeconds - The maximum time the operation may take.
+//------------------------------------------------------------------------------
+#define CSIT_ASSERT_LATENCY_SECONDS(in_latencyTimer, in_maxSeconds) CSIT_ASSERT_LATENCY(in_latencyTimer, in_maxSeconds, CSTest::IntegrationTest::LatencyRecord::k_noFramesBudget)
+//------------------------------------------------------------------------------
+/// The same as CSIT_ASSERT_LATENCY() but with only a frame budget.
+///
+/// @param in_latencyTimer - The timer returned by CSIT_START_LATENCY().
+/// @param in_maxFrames - The maximum number of frames which may start while
+/// the operation is in progress.
+//------------------------------------------------------------------------------
+#define CSIT_ASSERT_LATENCY_FRAMES(in_latencyTimer, in_maxFrames) CSIT_ASSERT_LATENCY(in_latencyTimer, CSTest::IntegrationTest::LatencyRecord::k_noSecondsBudget, in_maxFrames)
 
 #endif
@@ -34,8 +34,8 @@ namespace CSTest
     {
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        TestDesc::TestDesc(const std::string& in_testCaseName, const std::string& in_testName, const TestDelegate& in_testDelegate, f32 in_timeoutSeconds) noexcept
-            : m_testCaseName(in_testCaseName), m_testName(in_testName), m_testDelegate(in_testDelegate), m_timeoutSeconds(in_timeoutSeconds)
+        TestDesc::TestDesc(const std::string& in_testCaseName, const std::string& in_testName, const TestDelegate& in_testDelegate, f32 in_timeoutSeconds, bool in_isSerial) noexcept
+            : m_testCaseName(in_testCaseName), m_testName(in_testName), m_testDelegate(in_testDelegate), m_timeoutSeconds(in_timeoutSeconds), m_isSerial(in_isSerial)
         {
             CS_ASSERT(!m_testCaseName.empty(), "The test case must have a name.");
             CS_ASSERT(!m_testName.empty(), "The test must have a name.");
@@ -66,5 +66,11 @@ namespace CSTest
         {
             return m_timeoutSeconds;
         }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestDesc::IsSerial() const noexcept
+        {
+            return m_isSerial;
+        }
     }
 }
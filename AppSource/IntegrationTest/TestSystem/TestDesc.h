@@ -66,8 +66,10 @@ namespace CSTest
             /// @param in_testName - The name of the test.
             /// @param in_testDelegate - The test delegate.
             /// @param in_timoutSeconds - [Optional] The time before the test fails.
+            /// @param in_isSerial - [Optional] Whether or not the test must be run on its
+            /// own, rather than concurrently with other tests. Defaults to false.
             //------------------------------------------------------------------------------
-            TestDesc(const std::string& in_testCaseName, const std::string& in_testName, const TestDelegate& in_testDelegate, f32 in_timeoutSeconds = k_defaultTimeoutSeconds) noexcept;
+            TestDesc(const std::string& in_testCaseName, const std::string& in_testName, const TestDelegate& in_testDelegate, f32 in_timeoutSeconds = k_defaultTimeoutSeconds, bool in_isSerial = false) noexcept;
             //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -92,12 +94,19 @@ namespace CSTest
             /// @param The time before the test will fail.
             //------------------------------------------------------------------------------
             f32 GetTimeoutSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not the test must be run on its own. Serial tests are
+            /// used when a test touches shared state, such as files in save data, and
+            /// therefore cannot safely be run alongside other tests.
+            //------------------------------------------------------------------------------
+            bool IsSerial() const noexcept;
             
         private:
             std::string m_testCaseName;
             std::string m_testName;
             TestDelegate m_testDelegate;
             f32 m_timeoutSeconds;
+            bool m_isSerial;
         };
     }
 }
@@ -51,5 +51,26 @@ namespace CSTest
         {
             return m_tests;
         }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TestRegistry::RegisterFixture(const std::string& in_testCaseName, const FixtureFactory& in_fixtureFactory) noexcept
+        {
+            CS_ASSERT(in_fixtureFactory, "A valid fixture factory must be supplied.");
+            CS_ASSERT(m_fixtureFactories.find(in_testCaseName) == m_fixtureFactories.end(), "Test case '" + in_testCaseName + "' already has a fixture.");
+            
+            m_fixtureFactories.emplace(in_testCaseName, in_fixtureFactory);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TestRegistry::FixtureFactory TestRegistry::GetFixtureFactory(const std::string& in_testCaseName) const noexcept
+        {
+            auto it = m_fixtureFactories.find(in_testCaseName);
+            if (it == m_fixtureFactories.end())
+            {
+                return nullptr;
+            }
+            
+            return it->second;
+        }
     }
 }
@@ -31,8 +31,11 @@
 
 #include <CSTest.h>
 
+#include <IntegrationTest/TestSystem/Fixture.h>
 #include <IntegrationTest/TestSystem/TestDesc.h>
 
+#include <functional>
+#include <unordered_map>
 #include <vector>
 
 namespace CSTest
@@ -40,8 +43,9 @@ namespace CSTest
     namespace IntegrationTest
     {
         //------------------------------------------------------------------------------
-        /// Contains a list of all registered tests. This is a singleton so that it can
-        /// be accessed from multiple translation units during static initialisation.
+        /// Contains a list of all registered tests, and the fixture factories for each
+        /// test case which declares a fixture. This is a singleton so that it can be
+        /// accessed from multiple translation units during static initialisation.
         ///
         /// This is not thread-safe.
         ///
@@ -52,6 +56,12 @@ namespace CSTest
         public:
             CS_DECLARE_NOCOPY(TestRegistry);
             //------------------------------------------------------------------------------
+            /// A delegate which creates the fixture for a test case.
+            ///
+            /// @return The new fixture.
+            //------------------------------------------------------------------------------
+            using FixtureFactory = std::function<FixtureUPtr() noexcept>;
+            //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
             /// @return The singleton instane of the TestRegistry.
@@ -72,6 +82,22 @@ namespace CSTest
             /// @return The list of all registered tests.
             //------------------------------------------------------------------------------
             const std::vector<TestDesc>& GetTests() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Adds the fixture factory for the given test case to the registry. Only one
+            /// fixture can be registered per test case. This is typically handled via a
+            /// AutoRegister instance.
+            ///
+            /// @param in_testCaseName - The name of the test case.
+            /// @param in_fixtureFactory - The delegate which creates the fixture.
+            //------------------------------------------------------------------------------
+            void RegisterFixture(const std::string& in_testCaseName, const FixtureFactory& in_fixtureFactory) noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_testCaseName - The name of the test case.
+            ///
+            /// @return The fixture factory for the given test case, or null if the test
+            /// case has no fixture.
+            //------------------------------------------------------------------------------
+            FixtureFactory GetFixtureFactory(const std::string& in_testCaseName) const noexcept;
             
         private:
             //------------------------------------------------------------------------------
@@ -82,6 +108,7 @@ namespace CSTest
             TestRegistry() = default;
             
             std::vector<TestDesc> m_tests;
+            std::unordered_map<std::string, FixtureFactory> m_fixtureFactories;
         };
     }
 }
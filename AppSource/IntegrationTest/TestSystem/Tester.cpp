@@ -28,62 +28,232 @@
 
 #include <IntegrationTest/TestSystem/Tester.h>
 
+#include <Common/Core/TestConfig.h>
+#include <Common/Performance/AllocationTracker.h>
+#include <Common/Performance/TraceRecorder.h>
+#include <Common/Report/ReportExporter.h>
 #include <IntegrationTest/TestSystem/TestRegistry.h>
 
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Threading.h>
+
 namespace CSTest
 {
     namespace IntegrationTest
     {
+        namespace
+        {
+            constexpr char k_traceCategory[] = "Test";
+            
+            //------------------------------------------------------------------------------
+            /// @param in_testDesc - The test description.
+            ///
+            /// @return The name of the test as it is shown in traces and profiles.
+            //------------------------------------------------------------------------------
+            std::string GetQualifiedName(const TestDesc& in_testDesc) noexcept
+            {
+                return in_testDesc.GetTestCaseName() + "." + in_testDesc.GetTestName();
+            }
+            //------------------------------------------------------------------------------
+            /// Creates a fixture which is always destroyed on the main thread. If the
+            /// last reference is released on a background thread, destruction is
+            /// scheduled as a main thread task.
+            ///
+            /// @param in_fixtureFactory - The factory which creates the fixture.
+            ///
+            /// @return The new fixture.
+            //------------------------------------------------------------------------------
+            FixtureSPtr CreateFixture(const TestRegistry::FixtureFactory& in_fixtureFactory) noexcept
+            {
+                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                
+                return FixtureSPtr(in_fixtureFactory().release(), [=](Fixture* in_fixture) noexcept
+                {
+                    if (taskScheduler->IsMainThread())
+                    {
+                        delete in_fixture;
+                        return;
+                    }
+                    
+                    taskScheduler->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext&) noexcept
+                    {
+                        delete in_fixture;
+                    });
+                });
+            }
+        }
+        
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        Tester::Tester(const ProgressUpdateDelegate& in_progressUpdateDelegate, const CompletionDelegate& in_completionDelegate) noexcept
-            : m_progressUpdateDelegate(in_progressUpdateDelegate), m_completionDelegate(in_completionDelegate)
+        Tester::Tester(const ProgressUpdateDelegate& in_progressUpdateDelegate, const CompletionDelegate& in_completionDelegate, u32 in_maxConcurrentTests, const Common::TestFilter& in_filter, u32 in_numRepeats) noexcept
+            : m_progressUpdateDelegate(in_progressUpdateDelegate), m_completionDelegate(in_completionDelegate), m_maxConcurrentTests(in_maxConcurrentTests)
         {
-            auto tests = TestRegistry::Get().GetTests();
-            m_numTests = u32(tests.size());
+            CS_ASSERT(m_maxConcurrentTests > 0, "At least one test must be allowed to run at a time.");
+            CS_ASSERT(in_numRepeats > 0, "Each test must be run at least once.");
+            
+            // Allocations are counted globally, so they can only be attributed to a test if it is the only one running.
+            if (Common::AllocationTracker::IsEnabled() && m_maxConcurrentTests > 1)
+            {
+                CS_LOG_VERBOSE("Allocation tracking is enabled, integration tests will be run one at a time.");
+                m_maxConcurrentTests = 1;
+            }
             
-            for (const auto& test : tests)
+            std::vector<TestDesc> testDescs;
+            u32 numMatchingTests = 0;
+            for (const auto& testDesc : TestRegistry::Get().GetTests())
             {
-                m_testQueue.push(test);
+                if (in_filter.IsMatch(testDesc.GetTestCaseName(), testDesc.GetTestName()) && in_filter.IsInShard(numMatchingTests++))
+                {
+                    testDescs.push_back(testDesc);
+                }
             }
             
-            TryStartTest();
+            for (u32 repeat = 0; repeat < in_numRepeats; ++repeat)
+            {
+                for (const auto& testDesc : testDescs)
+                {
+                    m_testQueue.push(std::make_pair(m_numTests++, testDesc));
+                    
+                    auto fixtureFactory = TestRegistry::Get().GetFixtureFactory(testDesc.GetTestCaseName());
+                    if (fixtureFactory)
+                    {
+                        auto& fixtureState = m_fixtures[testDesc.GetTestCaseName()];
+                        fixtureState.m_factory = fixtureFactory;
+                        ++fixtureState.m_numRemainingTests;
+                    }
+                }
+            }
+            
+            TryStartTests();
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        void Tester::TryStartTest() noexcept
+        void Tester::TryStartTests() noexcept
         {
-            if (m_testQueue.empty())
+            while (!m_testQueue.empty() && !m_isSerialTestActive && m_activeTests.size() < m_maxConcurrentTests)
             {
-                m_completionDelegate(Report(m_numTests, m_failedTests));
-                return;
+                const auto& nextTest = m_testQueue.front();
+                if ((nextTest.second.IsSerial() || IsProfiled(nextTest.second)) && !m_activeTests.empty())
+                {
+                    break;
+                }
+                
+                auto testIndex = nextTest.first;
+                auto testDesc = nextTest.second;
+                m_testQueue.pop();
+                
+                StartTest(testIndex, testDesc);
             }
             
-            ++m_activeTestIndex;
-            TestDesc testDesc = m_testQueue.front();
-            m_testQueue.pop();
+            if (m_testQueue.empty() && m_activeTests.empty())
+            {
+                std::vector<Report::TestResult> testResults;
+                for (const auto& testResult : m_testResults)
+                {
+                    testResults.push_back(testResult.second);
+                }
+                
+                m_completionDelegate(Report(testResults));
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool Tester::IsProfiled(const TestDesc& in_testDesc) const noexcept
+        {
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            return (!m_profiler && testConfig && testConfig->IsProfiled(in_testDesc.GetTestCaseName(), in_testDesc.GetTestName()));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Tester::StartTest(u32 in_testIndex, const TestDesc& in_testDesc) noexcept
+        {
+            auto isProfiled = IsProfiled(in_testDesc);
             
-            m_progressUpdateDelegate(testDesc, m_activeTestIndex, m_numTests);
+            ++m_numStartedTests;
+            m_isSerialTestActive = in_testDesc.IsSerial() || isProfiled;
+            
+            m_progressUpdateDelegate(in_testDesc, m_numStartedTests, m_numTests);
             
             auto passDelegate = [=]()
             {
-                CS_ASSERT(testDesc.GetTestCaseName() == m_activeTest->GetDesc().GetTestCaseName(), "Received callback for test which is no longer active.");
-                CS_ASSERT(testDesc.GetTestName() == m_activeTest->GetDesc().GetTestName(), "Received callback for test which is no longer active.");
-                
-                TryStartTest();
+                OnTestComplete(in_testIndex, true, "");
             };
             
             auto failDelegate = [=](const std::string& in_message)
             {
-                CS_ASSERT(testDesc.GetTestCaseName() == m_activeTest->GetDesc().GetTestCaseName(), "Received callback for test which is no longer active.");
-                CS_ASSERT(testDesc.GetTestName() == m_activeTest->GetDesc().GetTestName(), "Received callback for test which is no longer active.");
-                
-                m_failedTests.push_back(Report::FailedTest(testDesc, in_message));
-                
-                TryStartTest();
+                OnTestComplete(in_testIndex, false, in_message);
             };
             
-            m_activeTest = Test::Create(testDesc, passDelegate, failDelegate);
+            // Fixtures are created before the test starts so that setup is not included in the test's timings.
+            FixtureSPtr fixture;
+            auto fixtureIt = m_fixtures.find(in_testDesc.GetTestCaseName());
+            if (fixtureIt != m_fixtures.end())
+            {
+                if (!fixtureIt->second.m_fixture)
+                {
+                    fixtureIt->second.m_fixture = CreateFixture(fixtureIt->second.m_factory);
+                }
+                
+                fixture = fixtureIt->second.m_fixture;
+            }
+            
+            if (isProfiled)
+            {
+                m_profiler = Common::SamplingProfilerUPtr(new Common::SamplingProfiler(GetQualifiedName(in_testDesc)));
+                m_profiledTestIndex = in_testIndex;
+            }
+            
+            auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+            if (traceRecorder)
+            {
+                traceRecorder->BeginAsyncEvent(GetQualifiedName(in_testDesc), k_traceCategory, in_testIndex);
+            }
+            
+            // The test is registered as active before it is created as the test body is run during creation.
+            auto& activeTest = m_activeTests[in_testIndex];
+            activeTest = Test::Create(in_testDesc, passDelegate, failDelegate, fixture);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Tester::OnTestComplete(u32 in_testIndex, bool in_passed, const std::string& in_errorMessage) noexcept
+        {
+            auto it = m_activeTests.find(in_testIndex);
+            CS_ASSERT(it != m_activeTests.end(), "Received callback for test which is no longer active.");
+            
+            // Keep the test alive until the callback has finished, as it may be the test's own timer which is calling this.
+            auto test = it->second;
+            m_activeTests.erase(it);
+            
+            auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+            if (traceRecorder)
+            {
+                traceRecorder->EndAsyncEvent(GetQualifiedName(test->GetDesc()), k_traceCategory, in_testIndex);
+            }
+            
+            auto wasProfiled = (m_profiler && in_testIndex == m_profiledTestIndex);
+            if (wasProfiled)
+            {
+                m_profiler->Stop();
+                Common::ReportExporter().Export(*m_profiler);
+                m_profiler.reset();
+            }
+            
+            Report::TestResult testResult(test->GetDesc(), in_passed, in_errorMessage, test->GetDurationSeconds(), test->GetNumFrames(), test->GetMainThreadSeconds(), test->GetBenchmarkStats(), test->GetLatencyRecords(),
+                                        test->GetAllocationStats());
+            m_testResults.insert(std::make_pair(in_testIndex, testResult));
+            
+            if (test->GetDesc().IsSerial() || wasProfiled)
+            {
+                m_isSerialTestActive = false;
+            }
+            
+            auto fixtureIt = m_fixtures.find(test->GetDesc().GetTestCaseName());
+            if (fixtureIt != m_fixtures.end() && --fixtureIt->second.m_numRemainingTests == 0)
+            {
+                m_fixtures.erase(fixtureIt);
+            }
+            
+            TryStartTests();
         }
     }
 }
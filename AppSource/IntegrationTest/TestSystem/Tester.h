@@ -31,10 +31,15 @@
 
 #include <CSTest.h>
 
+#include <Common/Core/TestFilter.h>
+#include <Common/Performance/SamplingProfiler.h>
 #include <IntegrationTest/TestSystem/Report.h>
 #include <IntegrationTest/TestSystem/TestCase.h>
+#include <IntegrationTest/TestSystem/TestRegistry.h>
 
+#include <map>
 #include <queue>
+#include <unordered_map>
 #include <vector>
 
 namespace CSTest
@@ -45,6 +50,25 @@ namespace CSTest
         /// Provides the means to run the integration tests and receive a report on
         /// how many passed or failed.
         ///
+        /// Up to the given maximum number of tests can be run concurrently. Tests
+        /// which are flagged as serial are only started once all other tests have
+        /// finished, and no other tests will be started until they complete. The
+        /// report lists failures in registration order regardless of the order in
+        /// which the tests finished, and includes timing information for every test.
+        ///
+        /// Each test can optionally be repeated a number of times. Repeats are queued
+        /// round-robin, so that each run of a test is separated by runs of the others,
+        /// and the report summarises the variance and flakiness of each repeated test.
+        ///
+        /// If allocation tracking is enabled tests are always run one at a time, so
+        /// that the allocations made while each test runs can be attributed to it.
+        ///
+        /// Tests selected by the "Profile" test config patterns are run under the
+        /// sampling profiler, and the profile is exported when the test completes.
+        /// The profiler samples the whole process, so profiled tests are run on their
+        /// own in the same way as serial tests. If tracing is enabled the start
+        /// and end of each test is recorded on the trace timeline.
+        ///
         /// This is not thread-safe.
         ///
         /// @author Ian Copland
@@ -73,25 +97,74 @@ namespace CSTest
             ///
             /// @param in_progressUpdateDelegate - The update progress delegate.
             /// @param in_completionDelegate - The completion delegate.
+            /// @param in_maxConcurrentTests - [Optional] The maximum number of tests which
+            /// can be run at the same time. Defaults to 1, running each test in turn.
+            /// @param in_filter - [Optional] The filter describing which of the
+            /// registered tests should be run. Defaults to all tests.
+            /// @param in_numRepeats - [Optional] The number of times each test should be
+            /// run. Defaults to 1.
             //------------------------------------------------------------------------------
-            Tester(const ProgressUpdateDelegate& in_progressUpdateDelegate, const CompletionDelegate& in_completionDelegate) noexcept;
+            Tester(const ProgressUpdateDelegate& in_progressUpdateDelegate, const CompletionDelegate& in_completionDelegate, u32 in_maxConcurrentTests = 1, const Common::TestFilter& in_filter = Common::TestFilter(), u32 in_numRepeats = 1) noexcept;
         private:
             //------------------------------------------------------------------------------
-            /// Attempts to start the next test. If there are no tests left to run the the
+            /// The fixture for a test case, along with the number of tests in the test
+            /// case which have not yet completed. The fixture is created when the first
+            /// test in the test case starts, and released when the last completes. Tests
+            /// share ownership of the fixture, so any test which is still referenced
+            /// after it completes keeps the fixture alive. Wherever the last reference
+            /// is released, the fixture is destroyed on the main thread.
+            //------------------------------------------------------------------------------
+            struct FixtureState final
+            {
+                TestRegistry::FixtureFactory m_factory;
+                FixtureSPtr m_fixture;
+                u32 m_numRemainingTests = 0;
+            };
+            //------------------------------------------------------------------------------
+            /// Starts as many queued tests as the concurrency limit and serial tests
+            /// allow. If there are no tests left to run, and none are still active, the
             /// completion delegate is called.
             ///
             /// @author Ian Copland
             //------------------------------------------------------------------------------
-            void TryStartTest() noexcept;
+            void TryStartTests() noexcept;
+            //------------------------------------------------------------------------------
+            /// @param in_testDesc - The test description.
+            ///
+            /// @return Whether or not the test should be run under the sampling profiler.
+            //------------------------------------------------------------------------------
+            bool IsProfiled(const TestDesc& in_testDesc) const noexcept;
+            //------------------------------------------------------------------------------
+            /// Starts the given test.
+            ///
+            /// @param in_testIndex - The index of the test within those being run.
+            /// @param in_testDesc - The test description.
+            //------------------------------------------------------------------------------
+            void StartTest(u32 in_testIndex, const TestDesc& in_testDesc) noexcept;
+            //------------------------------------------------------------------------------
+            /// Called when an active test passes or fails. The result is recorded, the test
+            /// is removed from the list of active tests and any further tests are started.
+            ///
+            /// @param in_testIndex - The index of the test within those being run.
+            /// @param in_passed - Whether or not the test passed.
+            /// @param in_errorMessage - The error message if the test failed.
+            //------------------------------------------------------------------------------
+            void OnTestComplete(u32 in_testIndex, bool in_passed, const std::string& in_errorMessage) noexcept;
             
             ProgressUpdateDelegate m_progressUpdateDelegate;
             CompletionDelegate m_completionDelegate;
-            u32 m_numTests;
+            u32 m_maxConcurrentTests;
+            u32 m_numTests = 0;
+            
+            std::queue<std::pair<u32, TestDesc>> m_testQueue;
+            std::map<u32, TestSPtr> m_activeTests;
+            bool m_isSerialTestActive = false;
+            u32 m_numStartedTests = 0;
+            std::map<u32, Report::TestResult> m_testResults;
+            std::unordered_map<std::string, FixtureState> m_fixtures;
             
-            std::queue<TestDesc> m_testQueue;
-            TestSPtr m_activeTest;
-            u32 m_activeTestIndex = 0;
-            std::vector<Report::FailedTest> m_failedTests;
+            Common::SamplingProfilerUPtr m_profiler;
+            u32 m_profiledTestIndex = 0;
         };
     }
 }
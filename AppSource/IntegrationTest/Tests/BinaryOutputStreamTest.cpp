@@ -78,7 +78,7 @@ namespace CSTest
         
         /// A series of integration tests to verify the functionality of an BinaryOutputStream.
         ///
-        CSIT_TESTCASE(BinaryOutputStream)
+        CSIT_TESTCASE_SERIAL(BinaryOutputStream)
         {
             /// Validate that a file stream can be opened
             ///
@@ -183,7 +183,7 @@ namespace CSTest
         ///
         /// @author Ian Copland
         //------------------------------------------------------------------------------
-        CSIT_TESTCASE(HttpRequest)
+        CSIT_TESTCASE_SERIAL(FileSystem)
         {
             //------------------------------------------------------------------------------
             /// Confirms that file existence can be queried in the package storage location.
@@ -25,6 +25,7 @@
 #include <IntegrationTest/TestSystem/TestCase.h>
 
 #include <Common/Core/BasicEntityFactory.h>
+#include <Common/Performance/TraceRecorder.h>
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base.h>
@@ -127,19 +128,19 @@ namespace CSTest
             }
             
             /// Creates a simple render object at the given position with the given render material
-            /// group.
+            /// group and mesh.
             ///
             /// @param renderMaterialGroup
             ///     The render material group that should be used to render the object.
+            /// @param renderMesh
+            ///     The mesh that should be used to render the object.
             /// @param position
             ///     The world space position of the render object.
             ///
             /// @return The render object.
             ///
-            CS::RenderObject CreateStandardRenderObject(const CS::RenderMaterialGroup* renderMaterialGroup, const CS::Vector3& position) noexcept
+            CS::RenderObject CreateStandardRenderObject(const CS::RenderMaterialGroup* renderMaterialGroup, const CS::RenderMesh* renderMesh, const CS::Vector3& position) noexcept
             {
-                auto primitiveModelFactory = CS::Application::Get()->GetSystem<CS::PrimitiveModelFactory>();
-                auto renderMesh = primitiveModelFactory->CreateBox(CS::Vector3::k_one)->GetRenderMesh(0);
                 auto worldMatrix = CS::Matrix4::CreateTransform(position, CS::Vector3::k_one, CS::Quaternion::k_identity);
                 
                 const auto& localBoundingSphere = renderMesh->GetBoundingSphere();
@@ -149,18 +150,17 @@ namespace CSTest
             }
             
             /// Creates a skybox render object with the given render material
-            /// group.
+            /// group and mesh.
             ///
             /// @param renderMaterialGroup
             ///     The render material group that should be used to render the object.
+            /// @param renderMesh
+            ///     The mesh that should be used to render the object.
             ///
             /// @return The render object.
             ///
-            CS::RenderObject CreateSkyboxRenderObject(const CS::RenderMaterialGroup* renderMaterialGroup) noexcept
+            CS::RenderObject CreateSkyboxRenderObject(const CS::RenderMaterialGroup* renderMaterialGroup, const CS::RenderMesh* renderMesh) noexcept
             {
-                auto primitiveModelFactory = CS::Application::Get()->GetSystem<CS::PrimitiveModelFactory>();
-                auto renderMesh = primitiveModelFactory->CreateBox(CS::Vector3::k_one)->GetRenderMesh(0);
-                
                 return CS::RenderObject(renderMaterialGroup, renderMesh, CS::Matrix4::k_identity, renderMesh->GetBoundingSphere(), false, CS::RenderLayer::k_skybox);
             }
             
@@ -185,13 +185,61 @@ namespace CSTest
                 
                 return CS::RenderObject(renderMaterialGroup, renderDynamicMesh, worldMatrix, worldBoundingSphere, false, CS::RenderLayer::k_ui);
             }
+            
+            /// The resources shared by all ForwardRenderPassCompiler tests. The material groups and
+            /// box mesh are created once before the first test and destroyed after the last, so
+            /// loading them is not repeated for, or included in the duration of, each test.
+            ///
+            class RenderResourcesFixture final : public Fixture
+            {
+            public:
+                /// Creates the shared resources. This is called on the main thread.
+                ///
+                RenderResourcesFixture() noexcept
+                    : m_litOpaqueMaterialGroup(CreateLitOpaqueMaterialGroup()), m_unlitTransparentMaterialGroup(CreateUnlitTransparentMaterialGroup()),
+                      m_skyboxMaterialGroup(CreateSkyboxMaterialGroup())
+                {
+                    auto primitiveModelFactory = CS::Application::Get()->GetSystem<CS::PrimitiveModelFactory>();
+                    m_boxModel = primitiveModelFactory->CreateBox(CS::Vector3::k_one);
+                }
+                
+                /// @return A lit opaque material group.
+                ///
+                const CS::RenderMaterialGroup* GetLitOpaqueMaterialGroup() const noexcept { return m_litOpaqueMaterialGroup.get(); }
+                
+                /// @return An unlit transparent material group.
+                ///
+                const CS::RenderMaterialGroup* GetUnlitTransparentMaterialGroup() const noexcept { return m_unlitTransparentMaterialGroup.get(); }
+                
+                /// @return A skybox material group.
+                ///
+                const CS::RenderMaterialGroup* GetSkyboxMaterialGroup() const noexcept { return m_skyboxMaterialGroup.get(); }
+                
+                /// @return The mesh for a unit box.
+                ///
+                const CS::RenderMesh* GetBoxRenderMesh() const noexcept { return m_boxModel->GetRenderMesh(0); }
+                
+                /// Destroys the shared resources. The Tester always destroys fixtures on
+                /// the main thread, which the render material group manager requires.
+                ///
+                ~RenderResourcesFixture() noexcept
+                {
+                    DestroyMaterialGroup(std::move(m_litOpaqueMaterialGroup));
+                    DestroyMaterialGroup(std::move(m_unlitTransparentMaterialGroup));
+                    DestroyMaterialGroup(std::move(m_skyboxMaterialGroup));
+                }
+                
+            private:
+                CS::UniquePtr<CS::RenderMaterialGroup> m_litOpaqueMaterialGroup;
+                CS::UniquePtr<CS::RenderMaterialGroup> m_unlitTransparentMaterialGroup;
+                CS::UniquePtr<CS::RenderMaterialGroup> m_skyboxMaterialGroup;
+                CS::ModelCSPtr m_boxModel;
+            };
         }
         
         CSIT_TESTCASE(ForwardRenderPassCompiler)
         {
-            //Cannot lambda capture by move in C++11 so need these as members
-            CS::UniquePtr<CS::RenderMaterialGroup> materialGroup1;
-            CS::UniquePtr<CS::RenderMaterialGroup> materialGroup2;
+            CSIT_FIXTURE(RenderResourcesFixture);
             
             /// Validates that a RenderFrame with a opaque renderObject and ambient light is setup correctly
             ///
@@ -200,15 +248,15 @@ namespace CSTest
                 CS::RenderCamera renderCamera = CreateRenderCamera();
                 CS::AmbientRenderLight ambientLight(CS::Colour::k_red);
                 
-                materialGroup1 = CreateLitOpaqueMaterialGroup();
+                const auto& fixture = CSIT_GET_FIXTURE();
                 std::vector<CS::DirectionalRenderLight> directionalLights;
                 std::vector<CS::PointRenderLight> pointLights;
-                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(materialGroup1.get(), k_onScreenObjectPosition) };
+                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(fixture.GetLitOpaqueMaterialGroup(), fixture.GetBoxRenderMesh(), k_onScreenObjectPosition) };
                 
                 CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, renderCamera, ambientLight, directionalLights, pointLights, renderObjects);
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     CS::ForwardRenderPassCompiler renderCompiler;
                     std::vector<CS::RenderFrame> renderFrames = {std::move(renderFrame)};
@@ -223,8 +271,6 @@ namespace CSTest
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses().size() == 1, "Unexpected number of render passes in the Transparent CameraRenderPassGroup.");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses()[0].GetRenderPassObjects().size() == 0, "Unexpected number of render objects in the Transparent pass, should be 0.");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses().size() == 0, "Unexpected number of render passes in the UI CameraRenderPassGroup.");
-
-                    DestroyMaterialGroup(std::move(materialGroup1));
                     
                     CSIT_PASS();
                 });
@@ -237,16 +283,16 @@ namespace CSTest
                 CS::RenderCamera renderCamera = CreateRenderCamera();
                 CS::AmbientRenderLight ambientLight(CS::Colour::k_red);
                 
-                materialGroup1 = CreateUnlitTransparentMaterialGroup();
+                const auto& fixture = CSIT_GET_FIXTURE();
                 
                 std::vector<CS::DirectionalRenderLight> directionalLights;
                 std::vector<CS::PointRenderLight> pointLights;
-                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(materialGroup1.get(), k_onScreenObjectPosition) };
+                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(fixture.GetUnlitTransparentMaterialGroup(), fixture.GetBoxRenderMesh(), k_onScreenObjectPosition) };
                 
                 CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, renderCamera, ambientLight, directionalLights, pointLights, renderObjects);
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     CS::ForwardRenderPassCompiler renderCompiler;
                     std::vector<CS::RenderFrame> renderFrames = {std::move(renderFrame)};
@@ -261,8 +307,6 @@ namespace CSTest
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses()[0].GetRenderPassObjects().size() == 1, "Unexpected number of objects in the Transparent pass, should contain 1 RenderObject");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[1].GetRenderPasses().size() == 0, "Unexpected number of render passes in the Skybox CameraRenderPassGroup.");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses().size() == 0, "Unexpected number of render passes in the UI CameraRenderPassGroup.");
-
-                    DestroyMaterialGroup(std::move(materialGroup1));
                     
                     CSIT_PASS();
                 });
@@ -276,16 +320,16 @@ namespace CSTest
                 CS::AmbientRenderLight ambientLight(CS::Colour::k_red);
                 CS::DirectionalRenderLight directionalLight(CS::Colour::k_red, CS::Vector3::k_unitNegativeZ);
                 
-                materialGroup1 = CreateLitOpaqueMaterialGroup();
+                const auto& fixture = CSIT_GET_FIXTURE();
                 
                 std::vector<CS::DirectionalRenderLight> directionalLights { directionalLight };
                 std::vector<CS::PointRenderLight> pointLights;
-                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(materialGroup1.get(), k_onScreenObjectPosition) };
+                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(fixture.GetLitOpaqueMaterialGroup(), fixture.GetBoxRenderMesh(), k_onScreenObjectPosition) };
                 
                 CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, renderCamera, ambientLight, directionalLights, pointLights, renderObjects);
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     CS::ForwardRenderPassCompiler renderCompiler;
                     
@@ -303,8 +347,6 @@ namespace CSTest
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses().size() == 1, "Unexpected size of Transparent CameraRenderPassGroup group. Expecting only Transparent pass");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses()[0].GetRenderPassObjects().size() == 0, "Unexpected number of objects in the Transparent pass, should contain 0 RenderObjects");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses().size() == 0, "Unexpected number of render passes in the UI CameraRenderPassGroup.");
-
-                    DestroyMaterialGroup(std::move(materialGroup1));
                     
                     CSIT_PASS();
                 });
@@ -318,16 +360,16 @@ namespace CSTest
                 CS::AmbientRenderLight ambientLight(CS::Colour::k_red);
                 CS::DirectionalRenderLight directionalLight(CS::Colour::k_red, CS::Vector3::k_unitNegativeZ);
                 
-                materialGroup1 = CreateUnlitTransparentMaterialGroup();
+                const auto& fixture = CSIT_GET_FIXTURE();
                 
                 std::vector<CS::DirectionalRenderLight> directionalLights { directionalLight };
                 std::vector<CS::PointRenderLight> pointLights;
-                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(materialGroup1.get(), k_onScreenObjectPosition) };
+                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(fixture.GetUnlitTransparentMaterialGroup(), fixture.GetBoxRenderMesh(), k_onScreenObjectPosition) };
                 
                 CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, renderCamera, ambientLight, directionalLights, pointLights, renderObjects);
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     CS::ForwardRenderPassCompiler renderCompiler;
                     std::vector<CS::RenderFrame> renderFrames = {std::move(renderFrame)};
@@ -343,8 +385,6 @@ namespace CSTest
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses()[0].GetRenderPassObjects().size() == 1, "Unexpected number of objects in the Transparent pass, should contain 1 RenderObject");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[1].GetRenderPasses().size() == 0, "Unexpected number of render passes in the Skybox CameraRenderPassGroup.");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses().size() == 0, "Unexpected number of render passes in the UI CameraRenderPassGroup.");
-
-                    DestroyMaterialGroup(std::move(materialGroup1));
                     
                     CSIT_PASS();
                 });
@@ -356,14 +396,14 @@ namespace CSTest
             {
                 auto allocator = std::make_shared<CS::PagedLinearAllocator>(1024 * 1024);
                 
-                materialGroup1 = CreateUnlitTransparentMaterialGroup();
+                const auto& fixture = CSIT_GET_FIXTURE();
                 CS::RenderDynamicMeshASPtr renderDynamicMesh = CS::SpriteMeshBuilder::Build(allocator.get(), CS::Vector3::k_zero, CS::Vector2::k_one, CS::UVs(), CS::Colour::k_red, CS::AlignmentAnchor::k_middleCentre);
                 
-                std::vector<CS::RenderObject> renderObjects { CreateUIRenderObject(materialGroup1.get(), renderDynamicMesh.get(), k_uiObjectPosition) };
+                std::vector<CS::RenderObject> renderObjects { CreateUIRenderObject(fixture.GetUnlitTransparentMaterialGroup(), renderDynamicMesh.get(), k_uiObjectPosition) };
                 CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, CreateRenderCamera(), CS::AmbientRenderLight(CS::Colour::k_red), std::vector<CS::DirectionalRenderLight>(), std::vector<CS::PointRenderLight>(), renderObjects);
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     //Need to force these to be captured so these aren't deleted.
                     auto allocatorRef = allocator;
@@ -385,8 +425,6 @@ namespace CSTest
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses().size() == 1, "Unexpected number of render passes in the UI CameraRenderPassGroup.");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses()[0].GetLightType() == CS::RenderPass::LightType::k_none, "Unexpected light type for UI render pass.");
                     
-                    DestroyMaterialGroup(std::move(materialGroup1));
-                    
                     CSIT_PASS();
                 });
             }
@@ -397,13 +435,13 @@ namespace CSTest
             {
                 auto allocator = std::make_shared<CS::PagedLinearAllocator>(1024 * 1024);
                 
-                materialGroup1 = CreateSkyboxMaterialGroup();
+                const auto& fixture = CSIT_GET_FIXTURE();
 
-                std::vector<CS::RenderObject> renderObjects { CreateSkyboxRenderObject(materialGroup1.get()) };
+                std::vector<CS::RenderObject> renderObjects { CreateSkyboxRenderObject(fixture.GetSkyboxMaterialGroup(), fixture.GetBoxRenderMesh()) };
                 CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, CreateRenderCamera(), CS::AmbientRenderLight(CS::Colour::k_red), std::vector<CS::DirectionalRenderLight>(), std::vector<CS::PointRenderLight>(), renderObjects);
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     CS::ForwardRenderPassCompiler renderCompiler;
                     std::vector<CS::RenderFrame> renderFrames = {std::move(renderFrame)};
@@ -418,8 +456,6 @@ namespace CSTest
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses()[0].GetRenderPassObjects().size() == 0, "Unexpected number of objects in the Transparent pass, should contain 0 RenderObjects");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses().size() == 0, "Unexpected number of render passes in the UI CameraRenderPassGroup.");
                     
-                    DestroyMaterialGroup(std::move(materialGroup1));
-                    
                     CSIT_PASS();
                 });
             }
@@ -432,11 +468,10 @@ namespace CSTest
                 CS::AmbientRenderLight ambientLight(CS::Colour::k_red);
                 CS::DirectionalRenderLight directionalLight(CS::Colour::k_red, CS::Vector3::k_unitNegativeZ);
                 
-                materialGroup1 = CreateUnlitTransparentMaterialGroup();
-                materialGroup2 = CreateLitOpaqueMaterialGroup();
+                const auto& fixture = CSIT_GET_FIXTURE();
                 
-                auto transparentObject = CreateStandardRenderObject(materialGroup1.get(), k_onScreenObjectPosition);
-                auto opaqueObject = CreateStandardRenderObject(materialGroup2.get(), k_onScreenObjectPosition);
+                auto transparentObject = CreateStandardRenderObject(fixture.GetUnlitTransparentMaterialGroup(), fixture.GetBoxRenderMesh(), k_onScreenObjectPosition);
+                auto opaqueObject = CreateStandardRenderObject(fixture.GetLitOpaqueMaterialGroup(), fixture.GetBoxRenderMesh(), k_onScreenObjectPosition);
                 
                 std::vector<CS::DirectionalRenderLight> directionalLights { directionalLight };
                 std::vector<CS::PointRenderLight> pointLights;
@@ -444,8 +479,8 @@ namespace CSTest
                 
                 CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, renderCamera, ambientLight, directionalLights, pointLights, renderObjects);
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     CS::ForwardRenderPassCompiler renderCompiler;
                     std::vector<CS::RenderFrame> renderFrames = {std::move(renderFrame)};
@@ -462,9 +497,6 @@ namespace CSTest
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses().size() == 1, "Unexpected number of render passes in the Transparent CameraRenderPassGroup.");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses()[0].GetRenderPassObjects().size() == 1, "Unexpected number of objects in the Transparent pass, should contain 1 RenderObject");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses().size() == 0, "Unexpected number of render passes in the UI CameraRenderPassGroup.");
-
-                    DestroyMaterialGroup(std::move(materialGroup1));
-                    DestroyMaterialGroup(std::move(materialGroup2));
                     
                     CSIT_PASS();
                 });
@@ -477,16 +509,16 @@ namespace CSTest
                 CS::RenderCamera renderCamera = CreateRenderCamera();
                 CS::AmbientRenderLight ambientLight(CS::Colour::k_red);
                 
-                materialGroup1 = CreateLitOpaqueMaterialGroup();
+                const auto& fixture = CSIT_GET_FIXTURE();
                 
                 std::vector<CS::DirectionalRenderLight> directionalLights;
                 std::vector<CS::PointRenderLight> pointLights;
-                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(materialGroup1.get(), k_offScreenObjectPosition) };
+                std::vector<CS::RenderObject> renderObjects { CreateStandardRenderObject(fixture.GetLitOpaqueMaterialGroup(), fixture.GetBoxRenderMesh(), k_offScreenObjectPosition) };
                 
                 CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, renderCamera, ambientLight, directionalLights, pointLights, renderObjects);
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     CS::ForwardRenderPassCompiler renderCompiler;
                     std::vector<CS::RenderFrame> renderFrames = {std::move(renderFrame)};
@@ -501,12 +533,46 @@ namespace CSTest
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses().size() == 1, "Unexpected size of Transparent CameraRenderPassGroup group. Expecting only Transparent pass");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[2].GetRenderPasses()[0].GetRenderPassObjects().size() == 0, "Unexpected number of objects in the Transparent pass, should contain 0 RenderObjects");
                     CSIT_ASSERT(renderPassGroups[0].GetRenderCameraGroups()[3].GetRenderPasses().size() == 0, "Unexpected number of render passes in the UI CameraRenderPassGroup.");
-
-                    DestroyMaterialGroup(std::move(materialGroup1));
                     
                     CSIT_PASS();
                 });
             }
+            
+            /// Measures the cost of compiling a frame containing a mix of on and off
+            /// screen, opaque and transparent objects lit by ambient and directional
+            /// lights.
+            ///
+            CSIT_BENCHMARK(CompileMixedFrame)
+            {
+                constexpr u32 k_numObjectsPerType = 50;
+                
+                CS::RenderCamera renderCamera = CreateRenderCamera();
+                CS::AmbientRenderLight ambientLight(CS::Colour::k_red);
+                CS::DirectionalRenderLight directionalLight(CS::Colour::k_red, CS::Vector3::k_unitNegativeZ);
+                
+                const auto& fixture = CSIT_GET_FIXTURE();
+                
+                std::vector<CS::DirectionalRenderLight> directionalLights { directionalLight };
+                std::vector<CS::PointRenderLight> pointLights;
+                std::vector<CS::RenderObject> renderObjects;
+                for (u32 i = 0; i < k_numObjectsPerType; ++i)
+                {
+                    renderObjects.push_back(CreateStandardRenderObject(fixture.GetUnlitTransparentMaterialGroup(), fixture.GetBoxRenderMesh(), k_onScreenObjectPosition));
+                    renderObjects.push_back(CreateStandardRenderObject(fixture.GetLitOpaqueMaterialGroup(), fixture.GetBoxRenderMesh(), k_onScreenObjectPosition));
+                    renderObjects.push_back(CreateStandardRenderObject(fixture.GetLitOpaqueMaterialGroup(), fixture.GetBoxRenderMesh(), k_offScreenObjectPosition));
+                }
+                
+                CS::RenderFrame renderFrame(nullptr, k_resolution, CS::Colour::k_black, renderCamera, ambientLight, directionalLights, pointLights, renderObjects);
+                
+                CSIT_BENCHMARK_RUN([=](const CS::TaskContext& taskContext) noexcept
+                {
+                    CS::ForwardRenderPassCompiler renderCompiler;
+                    std::vector<CS::RenderFrame> renderFrames = {renderFrame};
+                    auto renderPassGroups = renderCompiler.CompileTargetRenderPassGroups(taskContext, std::move(renderFrames));
+                    
+                    CSIT_ASSERT(renderPassGroups.size() == 1, "Unexpected size of TargetRenderPassGroup group.");
+                });
+            }
         }
     }
 }
@@ -0,0 +1,164 @@
+//
+//  FrameAllocatorTest.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <IntegrationTest/TestSystem/TestCase.h>
+
+#include <Common/Memory/FrameAllocatorSystem.h>
+#include <Common/Performance/TraceRecorder.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Memory.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace CSTest
+{
+    namespace IntegrationTest
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// Calls the given function on the main thread once the application's frame
+            /// index has reached the given value. Main thread tasks which are scheduled
+            /// from a main thread task are not run until the following frame, so this
+            /// checks the frame index once per frame.
+            ///
+            /// @param in_frameIndex - The frame index to wait for.
+            /// @param in_function - The function to call.
+            //------------------------------------------------------------------------------
+            void RunOnFrame(u32 in_frameIndex, const std::function<void() noexcept>& in_function) noexcept
+            {
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                
+                traceRecorder->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext& in_taskContext) noexcept
+                {
+                    if (CS::Application::Get()->GetFrameIndex() >= in_frameIndex)
+                    {
+                        in_function();
+                    }
+                    else
+                    {
+                        RunOnFrame(in_frameIndex, in_function);
+                    }
+                });
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        /// A series of integration tests for the frame allocator system.
+        //------------------------------------------------------------------------------
+        CSIT_TESTCASE(FrameAllocator)
+        {
+            //------------------------------------------------------------------------------
+            /// Confirms that data allocated from a frame allocator is still valid on the
+            /// following frame, that a different allocator is used on that frame, and
+            /// that the original allocator is reused the frame after.
+            //------------------------------------------------------------------------------
+            CSIT_TEST(SuccessDoubleBuffered)
+            {
+                constexpr u32 k_testValue = 12345;
+                
+                auto frameAllocatorSystem = CS::Application::Get()->GetSystem<Common::FrameAllocatorSystem>();
+                auto frameIndex = CS::Application::Get()->GetFrameIndex();
+                
+                auto& allocator = frameAllocatorSystem->GetAllocator();
+                CSIT_ASSERT(&allocator == &frameAllocatorSystem->GetAllocator(), "A different allocator was returned within the same frame.");
+                
+                auto value = std::make_shared<CS::UniquePtr<u32>>(CS::MakeUnique<u32>(allocator, k_testValue));
+                
+                RunOnFrame(frameIndex + 1, [=, &allocator]() noexcept
+                {
+                    CSIT_ASSERT(&allocator != &frameAllocatorSystem->GetAllocator(), "The same allocator was returned on the following frame.");
+                    CSIT_ASSERT(**value == k_testValue, "Allocated data was not preserved across a frame boundary.");
+                    value->reset();
+                    
+                    RunOnFrame(frameIndex + 2, [=, &allocator]() noexcept
+                    {
+                        CSIT_ASSERT(&allocator == &frameAllocatorSystem->GetAllocator(), "The original allocator was not reused after two frames.");
+                        CSIT_PASS();
+                    });
+                });
+            }
+            //------------------------------------------------------------------------------
+            /// Confirms that each thread which requests a frame allocator is given its
+            /// own, and that each can be allocated from.
+            //------------------------------------------------------------------------------
+            CSIT_TEST(SuccessAllocatorPerThread)
+            {
+                constexpr u32 k_numTasks = 64;
+                constexpr u32 k_numAllocationsPerTask = 100;
+                
+                auto frameAllocatorSystem = CS::Application::Get()->GetSystem<Common::FrameAllocatorSystem>();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                
+                auto mutex = std::make_shared<std::mutex>();
+                auto threadAllocators = std::make_shared<std::map<std::thread::id, CS::IAllocator*>>();
+                (*threadAllocators)[std::this_thread::get_id()] = &frameAllocatorSystem->GetAllocator();
+                
+                std::vector<CS::Task> tasks;
+                for (u32 i = 0; i < k_numTasks; ++i)
+                {
+                    tasks.push_back([=](const CS::TaskContext& in_taskContext) noexcept
+                    {
+                        auto& allocator = frameAllocatorSystem->GetAllocator();
+                        
+                        std::vector<CS::UniquePtr<u32>> values;
+                        for (u32 j = 0; j < k_numAllocationsPerTask; ++j)
+                        {
+                            values.push_back(CS::MakeUnique<u32>(allocator, j));
+                        }
+                        for (u32 j = 0; j < k_numAllocationsPerTask; ++j)
+                        {
+                            CSIT_ASSERT(*values[j] == j, "Allocated data was overwritten.");
+                        }
+                        
+                        std::unique_lock<std::mutex> lock(*mutex);
+                        auto it = threadAllocators->find(std::this_thread::get_id());
+                        if (it == threadAllocators->end())
+                        {
+                            for (const auto& entry : *threadAllocators)
+                            {
+                                CSIT_ASSERT(entry.second != &allocator, "An allocator was shared between threads.");
+                            }
+                            
+                            threadAllocators->emplace(std::this_thread::get_id(), &allocator);
+                        }
+                    });
+                }
+                
+                traceRecorder->ScheduleTasks(CS::TaskType::k_small, tasks, [=](const CS::TaskContext& in_taskContext) noexcept
+                {
+                    CSIT_ASSERT(frameAllocatorSystem->GetNumThreads() >= threadAllocators->size(), "Incorrect number of threads.");
+                    CSIT_PASS();
+                });
+            }
+        }
+    }
+}
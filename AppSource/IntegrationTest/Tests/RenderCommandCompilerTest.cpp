@@ -24,6 +24,8 @@
 
 #include <IntegrationTest/TestSystem/TestCase.h>
 
+#include <Common/Performance/TraceRecorder.h>
+
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Math.h>
@@ -208,8 +210,8 @@ namespace CSTest
                 auto targetRenderPassGroups = std::make_shared<std::vector<CS::TargetRenderPassGroup>>();
                 targetRenderPassGroups->push_back(CreateBasicTargetRenderPassGroup());
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     CS::RenderCommandListUPtr preRenderCommandList(new CS::RenderCommandList());
                     CS::RenderCommandListUPtr postRenderCommandList(new CS::RenderCommandList());
@@ -247,8 +249,8 @@ namespace CSTest
                 auto targetRenderPassGroups = std::make_shared<std::vector<CS::TargetRenderPassGroup>>();
                 targetRenderPassGroups->push_back(CreateComplexTargetRenderPassGroup());
                 
-                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
-                taskScheduler->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+                traceRecorder->ScheduleTask(CS::TaskType::k_small, [=](const CS::TaskContext& taskContext)
                 {
                     // In a more real work case, the pre and post list would only contain load and unload commands, however we are using
                     // apply camera commands as they're easier to setup for testing.
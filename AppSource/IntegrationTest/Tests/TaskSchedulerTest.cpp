@@ -28,6 +28,8 @@
 
 #include <IntegrationTest/TestSystem/TestCase.h>
 
+#include <Common/Performance/TraceRecorder.h>
+
 #include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Threading.h>
 
@@ -66,8 +68,9 @@ namespace CSTest
                 constexpr u32 k_numChildTasks = 5;
                 
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
-                taskScheduler->ScheduleTask(in_taskType, [=](const CS::TaskContext& in_parentTaskContext)
+                traceRecorder->ScheduleTask(in_taskType, [=](const CS::TaskContext& in_parentTaskContext)
                 {
                     CS_ASSERT(in_parentTaskContext.GetType() == CS::TaskType::k_small, "Incorrect task type.");
                     CS_ASSERT(!taskScheduler->IsMainThread(), "Task run on incorrect thread.");
@@ -116,8 +119,9 @@ namespace CSTest
             CSIT_TEST(ScheduleMainThreadTask)
             {
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
-                taskScheduler->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext& in_taskContext) noexcept
+                traceRecorder->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext& in_taskContext) noexcept
                 {
                     CSIT_ASSERT(in_taskContext.GetType() == CS::TaskType::k_mainThread, "Incorrect task type.");
                     CSIT_ASSERT(taskScheduler->IsMainThread(), "Task run on incorrect thread.");
@@ -133,12 +137,13 @@ namespace CSTest
             CSIT_TEST(ScheduleBackgroundTask)
             {
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
                 std::shared_ptr<std::atomic<u32>> taskTypesPassed(new std::atomic<u32>(0));
                 
                 for (const auto & taskType : k_backgroundTaskTypes)
                 {
-                    taskScheduler->ScheduleTask(taskType, [=](const CS::TaskContext& in_taskContext) noexcept
+                    traceRecorder->ScheduleTask(taskType, [=](const CS::TaskContext& in_taskContext) noexcept
                     {
                         CSIT_ASSERT(in_taskContext.GetType() == taskType, "Incorrect task type.");
                         CSIT_ASSERT(!taskScheduler->IsMainThread(), "Task run on incorrect thread.");
@@ -160,6 +165,7 @@ namespace CSTest
                 constexpr u32 k_numTasks = 5;
                 
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
                 std::shared_ptr<std::atomic<u32>> executedTaskCount(new std::atomic<u32>(0));
                 
@@ -178,7 +184,7 @@ namespace CSTest
                     });
                 }
                 
-                taskScheduler->ScheduleTasks(CS::TaskType::k_mainThread, tasks);
+                traceRecorder->ScheduleTasks(CS::TaskType::k_mainThread, tasks);
             }
             //------------------------------------------------------------------------------
             /// Confirms that each type of background task can be scheduled as a batch
@@ -191,6 +197,7 @@ namespace CSTest
                 constexpr u32 k_numTasksPerTaskType = 5;
                 
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
                 std::shared_ptr<std::atomic<u32>> taskTypesPassed(new std::atomic<u32>(0));
                 
@@ -216,7 +223,7 @@ namespace CSTest
                         });
                     }
                     
-                    taskScheduler->ScheduleTasks(taskType, tasks);
+                    traceRecorder->ScheduleTasks(taskType, tasks);
                 }
             }
             //------------------------------------------------------------------------------
@@ -229,6 +236,7 @@ namespace CSTest
                 constexpr u32 k_numTasks = 5;
                 
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
                 std::shared_ptr<std::atomic<u32>> executedTaskCount(new std::atomic<u32>(0));
                 
@@ -244,7 +252,7 @@ namespace CSTest
                     });
                 }
                 
-                taskScheduler->ScheduleTasks(CS::TaskType::k_mainThread, tasks, [=](const CS::TaskContext& in_taskContext) noexcept
+                traceRecorder->ScheduleTasks(CS::TaskType::k_mainThread, tasks, [=](const CS::TaskContext& in_taskContext) noexcept
                 {
                     CSIT_ASSERT(in_taskContext.GetType() == CS::TaskType::k_mainThread, "Incorrect task type.");
                     CSIT_ASSERT(taskScheduler->IsMainThread(), "Task run on incorrect thread.");
@@ -264,6 +272,7 @@ namespace CSTest
                 constexpr u32 k_numTasksPerTaskType = 5;
                 
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
                 std::shared_ptr<std::atomic<u32>> taskTypesPassed(new std::atomic<u32>(0));
                 
@@ -283,7 +292,7 @@ namespace CSTest
                         });
                     }
                     
-                    taskScheduler->ScheduleTasks(taskType, tasks, [=](const CS::TaskContext& in_taskContext) noexcept
+                    traceRecorder->ScheduleTasks(taskType, tasks, [=](const CS::TaskContext& in_taskContext) noexcept
                     {
                         CSIT_ASSERT(in_taskContext.GetType() == taskType, "Incorrect task type.");
                         CSIT_ASSERT(!taskScheduler->IsMainThread(), "Task run on incorrect thread.");
@@ -306,8 +315,9 @@ namespace CSTest
                 constexpr u32 k_numTasks = 5;
                 
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
-                taskScheduler->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext& in_parentTaskContext) noexcept
+                traceRecorder->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext& in_parentTaskContext) noexcept
                 {
                     CSIT_ASSERT(in_parentTaskContext.GetType() == CS::TaskType::k_mainThread, "Incorrect task type.");
                     CSIT_ASSERT(taskScheduler->IsMainThread(), "Task run on incorrect thread.");
@@ -343,12 +353,13 @@ namespace CSTest
                 constexpr u32 k_numTasksPerTaskType = 5;
                 
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
                 std::shared_ptr<std::atomic<u32>> taskTypesPassed(new std::atomic<u32>(0));
                 
                 for (const auto & taskType : k_backgroundTaskTypes)
                 {
-                    taskScheduler->ScheduleTask(taskType, [=](const CS::TaskContext& in_parentTaskContext) noexcept
+                    traceRecorder->ScheduleTask(taskType, [=](const CS::TaskContext& in_parentTaskContext) noexcept
                     {
                         CSIT_ASSERT(in_parentTaskContext.GetType() == taskType, "Incorrect task type.");
                         CSIT_ASSERT(!taskScheduler->IsMainThread(), "Task run on incorrect thread.");
@@ -388,6 +399,7 @@ namespace CSTest
                 constexpr u32 k_numLevels = 3;
                 
                 auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
                 std::shared_ptr<std::atomic<u32>> executedLevel3TaskCount(new std::atomic<u32>(0));
                 
@@ -426,7 +438,7 @@ namespace CSTest
                     });
                 }
                 
-                taskScheduler->ScheduleTasks(CS::TaskType::k_small, level1Tasks, [=](const CS::TaskContext& in_taskContext) noexcept
+                traceRecorder->ScheduleTasks(CS::TaskType::k_small, level1Tasks, [=](const CS::TaskContext& in_taskContext) noexcept
                 {
                     CSIT_ASSERT(in_taskContext.GetType() == CS::TaskType::k_small, "Incorrect task type.");
                     CSIT_ASSERT(!taskScheduler->IsMainThread(), "Task run on incorrect thread.");;
@@ -456,25 +468,51 @@ namespace CSTest
             //------------------------------------------------------------------------------
             CSIT_TEST(GameLogicTaskWithinFrame)
             {
-                auto app = CS::Application::Get();
-                auto taskScheduler = app->GetTaskScheduler();
+                auto taskScheduler = CS::Application::Get()->GetTaskScheduler();
+                auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
                 
-                //The task is run within a main thread task so the "scheduled" frame is the next one.
-                auto scheduledFrameIndex = app->GetFrameIndex() + 1;
+                //The test is run within a main thread task so the game logic task isn't processed until the next frame. The round trip
+                //back to the main thread must complete within that frame, giving a latency budget of one frame.
+                auto roundTripLatency = CSIT_START_LATENCY("GameLogicRoundTrip");
                 
-                taskScheduler->ScheduleTask(CS::TaskType::k_gameLogic, [=](const CS::TaskContext&) noexcept
+                traceRecorder->ScheduleTask(CS::TaskType::k_gameLogic, [=](const CS::TaskContext&) noexcept
                 {
                     CSIT_ASSERT(!taskScheduler->IsMainThread(), "Task run on incorrect thread.");
                     
-                    taskScheduler->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext&) noexcept
+                    traceRecorder->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext&) noexcept
                     {
                         CSIT_ASSERT(taskScheduler->IsMainThread(), "Task run on incorrect thread.");
-                        CSIT_ASSERT(scheduledFrameIndex == app->GetFrameIndex(), "Task was not run within the same frame as it was scheduled.");
+                        CSIT_ASSERT_LATENCY_FRAMES(roundTripLatency, 1);
                         
                         CSIT_PASS();
                     });
                 });
             }
+            //------------------------------------------------------------------------------
+            /// Measures the cost of processing a batch of trivial child tasks, which is
+            /// dominated by the overhead of scheduling and waiting on the tasks.
+            //------------------------------------------------------------------------------
+            CSIT_BENCHMARK(ProcessChildTasks)
+            {
+                constexpr u32 k_numChildTasks = 64;
+                
+                CSIT_BENCHMARK_RUN([=](const CS::TaskContext& in_taskContext) noexcept
+                {
+                    std::atomic<u32> executedTaskCount(0);
+                    std::vector<CS::Task> tasks;
+                    for (u32 i = 0; i < k_numChildTasks; ++i)
+                    {
+                        tasks.push_back([&executedTaskCount](const CS::TaskContext&) noexcept
+                        {
+                            ++executedTaskCount;
+                        });
+                    }
+                    
+                    in_taskContext.ProcessChildTasks(tasks);
+                    
+                    CSIT_ASSERT(executedTaskCount == k_numChildTasks, "An incorrect amount of tasks were run.");
+                });
+            }
         }
     }
 }
@@ -60,7 +60,7 @@ namespace CSTest
         
         /// A series of integration tests to verify the functionality of an TextOutputStream.
         ///
-        CSIT_TESTCASE(TextOutputStream)
+        CSIT_TESTCASE_SERIAL(TextOutputStream)
         {
             /// Validate that a file stream can be opened
             ///
@@ -28,23 +28,23 @@
 
 #include <UnitTest/State.h>
 
+#include <Common/Core/TestConfig.h>
 #include <Common/Core/TestNavigator.h>
 #include <Common/Input/BackButtonSystem.h>
+#include <Common/Performance/PerformanceBaseline.h>
+#include <Common/Performance/PerformanceGate.h>
+#include <Common/Report/ReportExporter.h>
 #include <IntegrationTest/State.h>
 #include <UnitTest/TestSystem/ReportPresenter.h>
 #include <UnitTest/TestSystem/TestSystem.h>
 
+#include <ChilliSource/Core/Base.h>
 #include <ChilliSource/Core/Scene.h>
 
 namespace CSTest
 {
     namespace UnitTest
     {
-        namespace
-        {
-            const f32 k_timeBeforeTests = 0.1f;
-        }
-        
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         void State::CreateSystems()
@@ -52,7 +52,7 @@ namespace CSTest
             m_testNavigator = CreateSystem<Common::TestNavigator>("Unit Tests");
             m_testSystem = CreateSystem<TestSystem>();
             m_reportPresenter = CreateSystem<ReportPresenter>();
-            CreateSystem<Common::BackButtonSystem>();
+            m_backButtonSystem = CreateSystem<Common::BackButtonSystem>();
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -60,27 +60,29 @@ namespace CSTest
         {
             GetMainScene()->SetClearColour(CS::Colour(0.9f, 0.9f, 0.9f, 1.0f));
             
+            // The tests run on a background task which cannot be cancelled, so the state
+            // must not be left until they have completed.
             m_testNavigator->SetBackButtonVisible(false);
-        }
-        //------------------------------------------------------------------------------
-        //------------------------------------------------------------------------------
-        void State::OnUpdate(f32 in_deltaTime)
-        {
-            // The start of the tests are delayed to give time for the UI to update and display the progress message.
-            if (m_testsPerformed == false)
+            m_backButtonSystem->SetEnabled(false);
+            
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            
+            auto progressDelegate = [=](u32 in_numCompletedTestCases, u32 in_numTestCases) noexcept
             {
-                m_timer += in_deltaTime;
+                m_reportPresenter->PresentProgress(in_numCompletedTestCases, in_numTestCases);
+            };
+            
+            auto completionDelegate = [=](const Report& in_report) noexcept
+            {
+                auto performanceResult = testConfig->GetPerformanceGate().Evaluate(Common::PerformanceBaseline::FromReport(in_report));
+                Common::ReportExporter().Export(in_report);
                 
-                if (m_timer > k_timeBeforeTests)
-                {
-                    m_timer = 0.0f;
-                    m_testsPerformed = true;
-                    
-                    auto report = m_testSystem->PerformTests();
-                    m_reportPresenter->PresentReport(report);
-                    m_testNavigator->SetBackButtonVisible(true);
-                }
-            }
+                m_reportPresenter->PresentReport(in_report, performanceResult);
+                m_testNavigator->SetBackButtonVisible(true);
+                m_backButtonSystem->SetEnabled(true);
+            };
+            
+            m_testSystem->PerformTests(progressDelegate, completionDelegate, testConfig->GetFilter(), testConfig->GetNumUnitTestProcesses());
         }
     }
 }
@@ -53,25 +53,17 @@ namespace CSTest
             //------------------------------------------------------------------------------
             void CreateSystems() override;
             //------------------------------------------------------------------------------
-            /// Initialises the state.
+            /// Initialises the state and starts the tests, which are run in the
+            /// background while progress is presented.
             ///
             /// @author Ian Copland
             //------------------------------------------------------------------------------
             void OnInit() override;
-            //------------------------------------------------------------------------------
-            /// The life-cycle event when is called every frame that the state is active.
-            ///
-            /// @author Ian Copland
-            ///
-            /// @param in_deltaTime - The time passed since the last frame.
-            //------------------------------------------------------------------------------
-            void OnUpdate(f32 in_deltaTime) override;
             
             TestSystem* m_testSystem = nullptr;
             ReportPresenter* m_reportPresenter = nullptr;
             Common::TestNavigator* m_testNavigator = nullptr;
-            bool m_testsPerformed = false;
-            f32 m_timer = 0.0f;
+            Common::BackButtonSystem* m_backButtonSystem = nullptr;
         };
     }
 }
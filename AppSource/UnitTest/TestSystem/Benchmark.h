@@ -0,0 +1,69 @@
+//
+//  Benchmark.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _UNITTEST_TESTSYSTEM_BENCHMARK_H_
+#define _UNITTEST_TESTSYSTEM_BENCHMARK_H_
+
+#include <CSTest.h>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        constexpr u32 k_defaultNumBenchmarkSamples = 20;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// A macro used within a Catch test case to declare a micro-benchmark. The
+/// statement or block which follows is run as the body of a Catch BENCHMARK,
+/// once for each of the given number of samples. Catch decides how many times
+/// to run the body in each sample, so it should perform a single iteration of
+/// the operation being measured.
+///
+/// CSReporter collates the samples of each benchmark in a test case, and the
+/// results are included in the unit test report. The name must be unique
+/// within the test case.
+///
+/// Benchmarks are timed in the same way as any other test code, so they will
+/// lengthen the test case which contains them.
+///
+/// @param in_name - The name of the benchmark.
+/// @param in_numSamples - The number of samples to take.
+//------------------------------------------------------------------------------
+#define CSUT_BENCHMARK_SAMPLES(in_name, in_numSamples) for (u32 csutBenchmarkSample_ = 0; csutBenchmarkSample_ < u32(in_numSamples); ++csutBenchmarkSample_) BENCHMARK(in_name)
+//------------------------------------------------------------------------------
+/// A macro used within a Catch test case to declare a micro-benchmark with the
+/// default number of samples. See CSUT_BENCHMARK_SAMPLES().
+///
+/// @param in_name - The name of the benchmark.
+//------------------------------------------------------------------------------
+#define CSUT_BENCHMARK(in_name) CSUT_BENCHMARK_SAMPLES(in_name, CSTest::UnitTest::k_defaultNumBenchmarkSamples)
+
+#endif
@@ -0,0 +1,101 @@
+//
+//  BenchmarkResult.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <UnitTest/TestSystem/BenchmarkResult.h>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        BenchmarkResult::BenchmarkResult(const std::string& in_name, u64 in_numIterations, const std::vector<f32>& in_sampleSeconds) noexcept
+            : m_name(in_name), m_numIterations(in_numIterations), m_sampleSeconds(in_sampleSeconds), m_stats(in_sampleSeconds)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& BenchmarkResult::GetName() const noexcept
+        {
+            return m_name;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 BenchmarkResult::GetNumSamples() const noexcept
+        {
+            return m_stats.GetNumIterations();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 BenchmarkResult::GetNumIterations() const noexcept
+        {
+            return m_numIterations;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<f32>& BenchmarkResult::GetSampleSeconds() const noexcept
+        {
+            return m_sampleSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkResult::GetMinSeconds() const noexcept
+        {
+            return m_stats.GetMinSeconds();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkResult::GetMaxSeconds() const noexcept
+        {
+            return m_stats.GetMaxSeconds();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkResult::GetMeanSeconds() const noexcept
+        {
+            return m_stats.GetMeanSeconds();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkResult::GetMedianSeconds() const noexcept
+        {
+            return m_stats.GetMedianSeconds();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkResult::GetStdDevSeconds() const noexcept
+        {
+            return m_stats.GetStdDevSeconds();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 BenchmarkResult::GetCoefficientOfVariation() const noexcept
+        {
+            return m_stats.GetCoefficientOfVariation();
+        }
+    }
+}
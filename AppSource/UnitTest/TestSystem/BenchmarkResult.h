@@ -0,0 +1,112 @@
+//
+//  BenchmarkResult.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _UNITTEST_TESTSYSTEM_BENCHMARKRESULT_H_
+#define _UNITTEST_TESTSYSTEM_BENCHMARKRESULT_H_
+
+#include <CSTest.h>
+
+#include <IntegrationTest/TestSystem/BenchmarkStats.h>
+
+#include <vector>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        //------------------------------------------------------------------------------
+        /// A statistical summary of a single Catch benchmark within a test case. Catch
+        /// runs each sample of the benchmark for as many iterations as are needed to
+        /// be measured accurately; the stats describe the mean iteration duration of
+        /// each sample.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class BenchmarkResult final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_name - The name of the benchmark.
+            /// @param in_numIterations - The total number of iterations run across all
+            /// samples.
+            /// @param in_sampleSeconds - The mean iteration duration of each sample, in
+            /// the order they were run. Must not be empty.
+            //------------------------------------------------------------------------------
+            BenchmarkResult(const std::string& in_name, u64 in_numIterations, const std::vector<f32>& in_sampleSeconds) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the benchmark.
+            //------------------------------------------------------------------------------
+            const std::string& GetName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of samples which were taken.
+            //------------------------------------------------------------------------------
+            u32 GetNumSamples() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The total number of iterations run across all samples.
+            //------------------------------------------------------------------------------
+            u64 GetNumIterations() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The mean iteration duration of each sample, in the order they
+            /// were run.
+            //------------------------------------------------------------------------------
+            const std::vector<f32>& GetSampleSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The mean iteration duration of the fastest sample.
+            //------------------------------------------------------------------------------
+            f32 GetMinSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The mean iteration duration of the slowest sample.
+            //------------------------------------------------------------------------------
+            f32 GetMaxSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The mean iteration duration across all samples.
+            //------------------------------------------------------------------------------
+            f32 GetMeanSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The median of the mean iteration duration of each sample.
+            //------------------------------------------------------------------------------
+            f32 GetMedianSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The sample standard deviation of the mean iteration duration of
+            /// each sample. This will be zero if there are fewer than two samples.
+            //------------------------------------------------------------------------------
+            f32 GetStdDevSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The standard deviation as a fraction of the mean.
+            //------------------------------------------------------------------------------
+            f32 GetCoefficientOfVariation() const noexcept;
+            
+        private:
+            std::string m_name;
+            u64 m_numIterations;
+            std::vector<f32> m_sampleSeconds;
+            IntegrationTest::BenchmarkStats m_stats;
+        };
+    }
+}
+
+#endif
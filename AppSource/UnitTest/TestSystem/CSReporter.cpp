@@ -28,6 +28,13 @@
 
 #include <UnitTest/TestSystem/CSReporter.h>
 
+#include <Common/Core/TestConfig.h>
+#include <Common/Report/ReportExporter.h>
+
+#include <ChilliSource/Core/Base.h>
+
+#include <algorithm>
+
 #include <internal/catch_reporter_registrars.hpp>
 
 namespace CSTest
@@ -37,6 +44,7 @@ namespace CSTest
         INTERNAL_CATCH_REGISTER_REPORTER("cs", CSReporter);
      
         Report CSReporter::s_report;
+        CSReporter::ProgressDelegate CSReporter::s_progressDelegate;
         
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -52,6 +60,12 @@ namespace CSTest
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
+        void CSReporter::setProgressDelegate(const ProgressDelegate& in_progressDelegate) noexcept
+        {
+            s_progressDelegate = in_progressDelegate;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
         CSReporter::CSReporter(const Catch::ReporterConfig& in_config) noexcept
             : StreamingReporterBase(in_config)
         {
@@ -72,6 +86,20 @@ namespace CSTest
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
+        void CSReporter::testCaseStarting(const Catch::TestCaseInfo& in_testInfo) noexcept
+        {
+            StreamingReporterBase::testCaseStarting(in_testInfo);
+            
+            auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+            if (testConfig && testConfig->IsProfiled(in_testInfo.name))
+            {
+                m_currentTestCaseProfiler = Common::SamplingProfilerUPtr(new Common::SamplingProfiler(in_testInfo.name));
+            }
+            
+            m_currentTestCaseAllocationTracker = Common::AllocationTracker();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
         bool CSReporter::assertionEnded(const Catch::AssertionStats& in_assertionStats) noexcept
         {
             const Catch::AssertionResult& assertionResult = in_assertionStats.assertionResult;
@@ -92,6 +120,32 @@ namespace CSTest
             ++m_sectionsPerTestCaseCount;
             ++m_totalSectionCount;
             
+            // The outermost section is the test case itself, which is run once for each leaf section.
+            if (m_sectionStack.empty())
+            {
+                m_currentTestCaseSeconds += in_sectionStats.durationInSeconds;
+            }
+            else
+            {
+                std::string name;
+                for (auto it = m_sectionStack.begin() + 1; it != m_sectionStack.end(); ++it)
+                {
+                    name += it->name + "/";
+                }
+                name += in_sectionStats.sectionInfo.name;
+                
+                auto it = std::find_if(m_currentSectionTimings.begin(), m_currentSectionTimings.end(), [&](const SectionTiming& in_timing) { return in_timing.m_name == name; });
+                if (it == m_currentSectionTimings.end())
+                {
+                    m_currentSectionTimings.push_back(SectionTiming());
+                    m_currentSectionTimings.back().m_name = name;
+                    it = m_currentSectionTimings.end() - 1;
+                }
+                
+                it->m_durationSeconds += in_sectionStats.durationInSeconds;
+                ++it->m_numRuns;
+            }
+            
             if (m_currentFailedAssertions.empty() == false)
             {
                 m_currentFailedSections.push_back(FailedSection(in_sectionStats.sectionInfo.name, u32(in_sectionStats.assertions.total()), m_currentFailedAssertions));
@@ -100,16 +154,70 @@ namespace CSTest
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
+        void CSReporter::benchmarkEnded(const Catch::BenchmarkStats& in_benchmarkStats) noexcept
+        {
+            if (in_benchmarkStats.iterations == 0)
+            {
+                return;
+            }
+            
+            const auto& name = in_benchmarkStats.info.name;
+            auto it = std::find_if(m_currentBenchmarkSamples.begin(), m_currentBenchmarkSamples.end(), [&](const BenchmarkSamples& in_samples) { return in_samples.m_name == name; });
+            if (it == m_currentBenchmarkSamples.end())
+            {
+                m_currentBenchmarkSamples.push_back(BenchmarkSamples());
+                m_currentBenchmarkSamples.back().m_name = name;
+                it = m_currentBenchmarkSamples.end() - 1;
+            }
+            
+            it->m_numIterations += in_benchmarkStats.iterations;
+            it->m_sampleSeconds.push_back(f32(f64(in_benchmarkStats.elapsedTimeInNanoseconds) / (1000000000.0 * f64(in_benchmarkStats.iterations))));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
         void CSReporter::testCaseEnded(const Catch::TestCaseStats& in_testCaseStats) noexcept
         {
+            // The stats are read before anything else so that the reporter's own allocations aren't attributed to the test case.
+            auto allocationStats = m_currentTestCaseAllocationTracker.GetStats();
+            
+            if (m_currentTestCaseProfiler)
+            {
+                m_currentTestCaseProfiler->Stop();
+                Common::ReportExporter().Export(*m_currentTestCaseProfiler);
+                m_currentTestCaseProfiler.reset();
+            }
+            
             StreamingReporterBase::testCaseEnded(in_testCaseStats);
             
+            std::vector<BenchmarkResult> benchmarkResults;
+            for (const auto& benchmarkSamples : m_currentBenchmarkSamples)
+            {
+                benchmarkResults.push_back(BenchmarkResult(benchmarkSamples.m_name, benchmarkSamples.m_numIterations, benchmarkSamples.m_sampleSeconds));
+            }
+            
+            std::vector<SectionResult> sectionResults;
+            for (const auto& sectionTiming : m_currentSectionTimings)
+            {
+                sectionResults.push_back(SectionResult(in_testCaseStats.testInfo.name, sectionTiming.m_name, f32(sectionTiming.m_durationSeconds), sectionTiming.m_numRuns));
+            }
+            
+            m_testCaseResults.push_back(TestCaseResult(in_testCaseStats.testInfo.name, in_testCaseStats.totals.assertions.failed == 0, f32(m_currentTestCaseSeconds), allocationStats, benchmarkResults,
+                                                       sectionResults));
+            m_currentTestCaseSeconds = 0.0;
+            m_currentBenchmarkSamples.clear();
+            m_currentSectionTimings.clear();
+            
             if (m_currentFailedSections.empty() == false)
             {
                 m_currentFailedTestCases.push_back(FailedTestCase(in_testCaseStats.testInfo.name, m_sectionsPerTestCaseCount, u32(in_testCaseStats.totals.assertions.total()), m_currentFailedSections));
                 m_currentFailedSections.clear();
                 m_sectionsPerTestCaseCount = 0;
             }
+            
+            if (s_progressDelegate)
+            {
+                s_progressDelegate(u32(m_testCaseResults.size()));
+            }
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -122,8 +230,9 @@ namespace CSTest
                 CS_LOG_FATAL("Failed to run tests, aborting.");
             }
             
-            s_report = Report(u32(in_testRunStats.totals.testCases.total()), m_totalSectionCount, u32(in_testRunStats.totals.assertions.total()), m_currentFailedTestCases);
+            s_report = Report(u32(in_testRunStats.totals.testCases.total()), m_totalSectionCount, u32(in_testRunStats.totals.assertions.total()), m_currentFailedTestCases, m_testCaseResults);
             m_currentFailedTestCases.clear();
+            m_testCaseResults.clear();
             m_totalSectionCount = 0;
         }
     }
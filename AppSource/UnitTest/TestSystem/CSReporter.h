@@ -31,10 +31,14 @@
 
 #include <CSTest.h>
 
+#include <Common/Performance/AllocationTracker.h>
+#include <Common/Performance/SamplingProfiler.h>
 #include <UnitTest/TestSystem/Report.h>
 
 #include <reporters/catch_reporter_bases.hpp>
 
+#include <functional>
+
 namespace CSTest
 {
     namespace UnitTest
@@ -47,6 +51,14 @@ namespace CSTest
         class CSReporter final : public Catch::StreamingReporterBase
         {
         public:
+            //------------------------------------------------------------------------------
+            /// A delegate which is called on the thread running the tests each time a
+            /// test case ends.
+            ///
+            /// @param in_numCompletedTestCases - The number of test cases which have
+            /// completed so far in the current test run.
+            //------------------------------------------------------------------------------
+            using ProgressDelegate = std::function<void(u32 in_numCompletedTestCases) noexcept>;
             //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -60,6 +72,13 @@ namespace CSTest
             //------------------------------------------------------------------------------
             static const Report& getReport() noexcept;
             //------------------------------------------------------------------------------
+            /// Sets the delegate which is called each time a test case ends. This must
+            /// not be called while tests are running.
+            ///
+            /// @param in_progressDelegate - The delegate, or null to clear it.
+            //------------------------------------------------------------------------------
+            static void setProgressDelegate(const ProgressDelegate& in_progressDelegate) noexcept;
+            //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
             /// @param in_config - The configuration. Note that CSReport only supports a
@@ -81,6 +100,14 @@ namespace CSTest
             //------------------------------------------------------------------------------
             void assertionStarting(const Catch::AssertionInfo& in_assertionInfo) noexcept override {};
             //------------------------------------------------------------------------------
+            /// Called when a test case begins. Allocation tracking for the test case is
+            /// started here, along with the sampling profiler if the test case is
+            /// selected by the "Profile" test config patterns.
+            ///
+            /// @param in_testInfo - The test case info.
+            //------------------------------------------------------------------------------
+            void testCaseStarting(const Catch::TestCaseInfo& in_testInfo) noexcept override;
+            //------------------------------------------------------------------------------
             /// Called when an assertion ends, with stats.
             ///
             /// @author Ian Copland
@@ -89,7 +116,8 @@ namespace CSTest
             //------------------------------------------------------------------------------
             bool assertionEnded(const Catch::AssertionStats& in_assertionStats) noexcept override;
             //------------------------------------------------------------------------------
-            /// Called when a section ends, with stats.
+            /// Called when a section ends, with stats. The duration of each section is
+            /// accumulated by its path within the test case until the test case ends.
             ///
             /// @author Ian Copland
             ///
@@ -97,6 +125,13 @@ namespace CSTest
             //------------------------------------------------------------------------------
             void sectionEnded(const Catch::SectionStats& in_sectionStats) noexcept override;
             //------------------------------------------------------------------------------
+            /// Called when a sample of a benchmark ends, with stats. Samples are collated
+            /// by benchmark name until the test case ends.
+            ///
+            /// @param in_benchmarkStats - The stats on the benchmark sample.
+            //------------------------------------------------------------------------------
+            void benchmarkEnded(const Catch::BenchmarkStats& in_benchmarkStats) noexcept override;
+            //------------------------------------------------------------------------------
             /// Called when a test case ends, with stats.
             ///
             /// @author Ian Copland
@@ -114,14 +149,42 @@ namespace CSTest
             void testRunEnded(const Catch::TestRunStats& in_testRunStats) noexcept override;
             
         private:
+            //------------------------------------------------------------------------------
+            /// The samples of a single benchmark which have been received so far in the
+            /// current test case.
+            //------------------------------------------------------------------------------
+            struct BenchmarkSamples final
+            {
+                std::string m_name;
+                u64 m_numIterations = 0;
+                std::vector<f32> m_sampleSeconds;
+            };
+            //------------------------------------------------------------------------------
+            /// The accumulated timing of a single section which has been entered so far in
+            /// the current test case.
+            //------------------------------------------------------------------------------
+            struct SectionTiming final
+            {
+                std::string m_name;
+                f64 m_durationSeconds = 0.0;
+                u32 m_numRuns = 0;
+            };
+            
             std::vector<FailedAssertion> m_currentFailedAssertions;
             std::vector<FailedSection> m_currentFailedSections;
             std::vector<FailedTestCase> m_currentFailedTestCases;
+            std::vector<TestCaseResult> m_testCaseResults;
+            f64 m_currentTestCaseSeconds = 0.0;
+            Common::AllocationTracker m_currentTestCaseAllocationTracker;
+            Common::SamplingProfilerUPtr m_currentTestCaseProfiler;
+            std::vector<BenchmarkSamples> m_currentBenchmarkSamples;
+            std::vector<SectionTiming> m_currentSectionTimings;
             
             u32 m_sectionsPerTestCaseCount = 0;
             u32 m_totalSectionCount = 0;
             
             static Report s_report; //needs to be accessible from TestSystem
+            static ProgressDelegate s_progressDelegate;
         };
     }
 }
@@ -28,14 +28,16 @@
 
 #include <UnitTest/TestSystem/Report.h>
 
+#include <algorithm>
+
 namespace CSTest
 {
     namespace UnitTest
     {
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        Report::Report(u32 in_numTestCases, u32 in_numSections, u32 in_numAssertions, const std::vector<FailedTestCase>& in_failedTestCases) noexcept
-            : m_numTestCases(in_numTestCases), m_numSections(in_numSections), m_numAssertions(in_numAssertions), m_failedTestCases(in_failedTestCases)
+        Report::Report(u32 in_numTestCases, u32 in_numSections, u32 in_numAssertions, const std::vector<FailedTestCase>& in_failedTestCases, const std::vector<TestCaseResult>& in_testCaseResults) noexcept
+            : m_numTestCases(in_numTestCases), m_numSections(in_numSections), m_numAssertions(in_numAssertions), m_failedTestCases(in_failedTestCases), m_testCaseResults(in_testCaseResults)
         {
             m_numFailedAssertions = 0;
             for (const auto& testCase : m_failedTestCases)
@@ -86,5 +88,35 @@ namespace CSTest
         {
             return m_failedTestCases;
         }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<TestCaseResult>& Report::GetTestCaseResults() const noexcept
+        {
+            return m_testCaseResults;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<SectionResult> Report::GetSlowSectionResults(f32 in_thresholdSeconds) const noexcept
+        {
+            std::vector<SectionResult> output;
+            
+            for (const auto& testCaseResult : m_testCaseResults)
+            {
+                for (const auto& sectionResult : testCaseResult.GetSectionResults())
+                {
+                    if (sectionResult.GetDurationSeconds() > in_thresholdSeconds)
+                    {
+                        output.push_back(sectionResult);
+                    }
+                }
+            }
+            
+            std::stable_sort(output.begin(), output.end(), [](const SectionResult& in_a, const SectionResult& in_b)
+            {
+                return in_a.GetDurationSeconds() > in_b.GetDurationSeconds();
+            });
+            
+            return output;
+        }
     }
 }
@@ -31,6 +31,7 @@
 
 #include <CSTest.h>
 #include <UnitTest/TestSystem/FailedTestCase.h>
+#include <UnitTest/TestSystem/TestCaseResult.h>
 
 namespace CSTest
 {
@@ -62,8 +63,10 @@ namespace CSTest
             /// @param in_numSections - The total number of sections in the test run.
             /// @param in_numAssertions - The total number of assertions in the test run.
             /// @param in_failedTestCases - The list of failed test cases.
+            /// @param in_testCaseResults - The result of every test case in the order
+            /// they were run.
             //------------------------------------------------------------------------------
-            Report(u32 in_numTestCases, u32 in_numSections, u32 in_numAssertions, const std::vector<FailedTestCase>& in_failedTestCases) noexcept;
+            Report(u32 in_numTestCases, u32 in_numSections, u32 in_numAssertions, const std::vector<FailedTestCase>& in_failedTestCases, const std::vector<TestCaseResult>& in_testCaseResults) noexcept;
             //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
@@ -106,6 +109,22 @@ namespace CSTest
             /// @return The list of failed assertions.
             //------------------------------------------------------------------------------
             const std::vector<FailedTestCase>& GetFailedTestCases() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The result of every test case, in the order they were run.
+            //------------------------------------------------------------------------------
+            const std::vector<TestCaseResult>& GetTestCaseResults() const noexcept;
+            //------------------------------------------------------------------------------
+            /// Finds the sections which took longer than the given threshold. Enclosing
+            /// sections include the time spent in their nested sections, so both an
+            /// enclosing section and the nested section which made it slow may be
+            /// listed.
+            ///
+            /// @param in_thresholdSeconds - The total duration above which a section is
+            /// considered slow.
+            ///
+            /// @return The slow sections across all test cases, slowest first.
+            //------------------------------------------------------------------------------
+            std::vector<SectionResult> GetSlowSectionResults(f32 in_thresholdSeconds) const noexcept;
             
         private:
             u32 m_numTestCases = 0;
@@ -114,6 +133,7 @@ namespace CSTest
             u32 m_numFailedSections = 0;
             u32 m_numFailedAssertions = 0;
             std::vector<FailedTestCase> m_failedTestCases;
+            std::vector<TestCaseResult> m_testCaseResults;
         };
     }
 }
@@ -28,6 +28,7 @@
 
 #include <UnitTest/TestSystem/ReportPresenter.h>
 
+#include <Common/Core/TestConfig.h>
 #include <Common/UI/BasicWidgetFactory.h>
 #include <UnitTest/TestSystem/CSReporter.h>
 
@@ -48,6 +49,22 @@ namespace CSTest
             constexpr char k_noTestsText[] = "No tests to run.";
             constexpr u32 k_maxTestCasesToDisplay = 3;
             
+            //------------------------------------------------------------------------------
+            /// @param in_performanceResult - The result of comparing the run against the
+            /// performance baseline.
+            ///
+            /// @return A summary of any performance regressions suitable for appending to
+            /// the onscreen text, or an empty string if there were none.
+            //------------------------------------------------------------------------------
+            std::string GetPerformanceText(const Common::PerformanceGate::Result& in_performanceResult)
+            {
+                if (in_performanceResult.GetRegressions().empty())
+                {
+                    return "";
+                }
+                
+                return "\n \n" + CS::ToString(u32(in_performanceResult.GetRegressions().size())) + " performance regressions" + (in_performanceResult.HasPassed() ? "" : " failed the run") + ".";
+            }
             //------------------------------------------------------------------------------
             /// Prints details on a failed test report to console.
             ///
@@ -88,6 +105,69 @@ namespace CSTest
                 
                 CS_LOG_ERROR("==========================================");
             }
+            //------------------------------------------------------------------------------
+            /// Prints the stats for each benchmark in the report to console. If there are
+            /// no benchmarks nothing is printed.
+            ///
+            /// @param in_report - The report.
+            //------------------------------------------------------------------------------
+            void PrintBenchmarkReport(const Report& in_report)
+            {
+                bool printedHeader = false;
+                
+                for (const auto& testCaseResult : in_report.GetTestCaseResults())
+                {
+                    for (const auto& benchmarkResult : testCaseResult.GetBenchmarkResults())
+                    {
+                        if (!printedHeader)
+                        {
+                            CS_LOG_VERBOSE("==========================================");
+                            CS_LOG_VERBOSE("Unit test benchmarks (microseconds per iteration):");
+                            CS_LOG_VERBOSE(" ");
+                            printedHeader = true;
+                        }
+                        
+                        CS_LOG_VERBOSE("[" + testCaseResult.GetName() + "] " + benchmarkResult.GetName() + ": " + CS::ToString(benchmarkResult.GetNumIterations()) + " iterations over " +
+                            CS::ToString(benchmarkResult.GetNumSamples()) + " samples, mean " + CS::ToString(benchmarkResult.GetMeanSeconds() * 1000000.0f) +
+                            ", std dev " + CS::ToString(benchmarkResult.GetStdDevSeconds() * 1000000.0f) + ", cv " + CS::ToString(benchmarkResult.GetCoefficientOfVariation()));
+                    }
+                }
+                
+                if (printedHeader)
+                {
+                    CS_LOG_VERBOSE("==========================================");
+                }
+            }
+            //------------------------------------------------------------------------------
+            /// Prints each section in the report which took longer than the slow section
+            /// threshold in the test config to console. If there are no slow sections
+            /// nothing is printed.
+            ///
+            /// @param in_report - The report.
+            //------------------------------------------------------------------------------
+            void PrintSlowSectionReport(const Report& in_report)
+            {
+                auto testConfig = CS::Application::Get()->GetSystem<Common::TestConfig>();
+                auto slowSectionSeconds = testConfig ? testConfig->GetSlowSectionSeconds() : Common::TestConfig::k_defaultSlowSectionSeconds;
+                
+                auto slowSectionResults = in_report.GetSlowSectionResults(slowSectionSeconds);
+                if (slowSectionResults.empty())
+                {
+                    return;
+                }
+                
+                CS_LOG_VERBOSE("==========================================");
+                CS_LOG_VERBOSE("Unit test sections slower than " + CS::ToString(slowSectionSeconds) + " seconds:");
+                CS_LOG_VERBOSE(" ");
+                
+                for (const auto& sectionResult : slowSectionResults)
+                {
+                    CS_LOG_VERBOSE("[" + sectionResult.GetTestCaseName() + "] " + sectionResult.GetName() + ": " + CS::ToString(sectionResult.GetDurationSeconds()) + " seconds over " +
+                        CS::ToString(sectionResult.GetNumRuns()) + " runs");
+                }
+                
+                CS_LOG_VERBOSE("==========================================");
+            }
         }
         
         CS_DEFINE_NAMEDTYPE(ReportPresenter);
@@ -105,7 +185,7 @@ namespace CSTest
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        void ReportPresenter::PresentReport(const Report& in_report)
+        void ReportPresenter::PresentReport(const Report& in_report, const Common::PerformanceGate::Result& in_performanceResult)
         {
             if (in_report.GetNumTestCases() == 0)
             {
@@ -113,7 +193,7 @@ namespace CSTest
             }
             else if (in_report.GetNumFailedTestCases() == 0)
             {
-                SetCentreText("All " + CS::ToString(in_report.GetNumSections()) + " test sections passed!");
+                SetCentreText("All " + CS::ToString(in_report.GetNumSections()) + " test sections passed!" + GetPerformanceText(in_performanceResult));
             }
             else
             {
@@ -139,12 +219,22 @@ namespace CSTest
                     }
                 }
                 
+                textBody += GetPerformanceText(in_performanceResult);
                 textBody += "\n \nPlease check the console for further information.";
                 
                 SetBodyText(textBody);
                 
                 PrintDetailedReport(in_report);
             }
+            
+            PrintBenchmarkReport(in_report);
+            PrintSlowSectionReport(in_report);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ReportPresenter::PresentProgress(u32 in_numCompletedTestCases, u32 in_numTestCases)
+        {
+            SetCentreText(std::string(k_defaultText) + "\n" + CS::ToString(in_numCompletedTestCases) + " of " + CS::ToString(in_numTestCases) + " test cases complete");
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -30,6 +30,7 @@
 #define _UNITTEST_TESTSYSTEM_REPORTPRESENTATIONSYSTEM_H_
 
 #include <CSTest.h>
+#include <Common/Performance/PerformanceGate.h>
 #include <UnitTest/TestSystem/Report.h>
 
 #include <ChilliSource/Core/System.h>
@@ -70,8 +71,18 @@ namespace CSTest
             /// @author Ian Copland
             ///
             /// @param in_report - The test report.
+            /// @param in_performanceResult - [Optional] The result of comparing the run
+            /// against the performance baseline.
             //------------------------------------------------------------------------------
-            void PresentReport(const Report& in_report);
+            void PresentReport(const Report& in_report, const Common::PerformanceGate::Result& in_performanceResult = Common::PerformanceGate::Result());
+            //------------------------------------------------------------------------------
+            /// Presents the progress of a test run which is still in progress.
+            ///
+            /// @param in_numCompletedTestCases - The number of test cases which have
+            /// completed.
+            /// @param in_numTestCases - The total number of test cases which will be run.
+            //------------------------------------------------------------------------------
+            void PresentProgress(u32 in_numCompletedTestCases, u32 in_numTestCases);
             
         private:
             friend class CS::State;
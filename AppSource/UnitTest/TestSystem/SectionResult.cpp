@@ -0,0 +1,65 @@
+//
+//  SectionResult.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <UnitTest/TestSystem/SectionResult.h>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SectionResult::SectionResult(const std::string& in_testCaseName, const std::string& in_name, f32 in_durationSeconds, u32 in_numRuns) noexcept
+            : m_testCaseName(in_testCaseName), m_name(in_name), m_durationSeconds(in_durationSeconds), m_numRuns(in_numRuns)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& SectionResult::GetTestCaseName() const noexcept
+        {
+            return m_testCaseName;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& SectionResult::GetName() const noexcept
+        {
+            return m_name;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 SectionResult::GetDurationSeconds() const noexcept
+        {
+            return m_durationSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 SectionResult::GetNumRuns() const noexcept
+        {
+            return m_numRuns;
+        }
+    }
+}
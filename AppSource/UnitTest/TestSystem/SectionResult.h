@@ -0,0 +1,82 @@
+//
+//  SectionResult.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _UNITTEST_TESTSYSTEM_SECTIONRESULT_H_
+#define _UNITTEST_TESTSYSTEM_SECTIONRESULT_H_
+
+#include <CSTest.h>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        //------------------------------------------------------------------------------
+        /// The timing of a single Catch SECTION within a test case. Catch re-enters a
+        /// section once for each of the leaf sections nested within it, so the
+        /// duration is the total over every run of the section.
+        ///
+        /// This is immutable and therefore thread-safe.
+        //------------------------------------------------------------------------------
+        class SectionResult final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_testCaseName - The name of the test case the section is in.
+            /// @param in_name - The path to the section within the test case, with the
+            /// names of any enclosing sections separated by '/'.
+            /// @param in_durationSeconds - The total time spent in the section.
+            /// @param in_numRuns - The number of times the section was entered.
+            //------------------------------------------------------------------------------
+            SectionResult(const std::string& in_testCaseName, const std::string& in_name, f32 in_durationSeconds, u32 in_numRuns) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the test case the section is in.
+            //------------------------------------------------------------------------------
+            const std::string& GetTestCaseName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The path to the section within the test case, with the names of
+            /// any enclosing sections separated by '/'.
+            //------------------------------------------------------------------------------
+            const std::string& GetName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The total time spent in the section.
+            //------------------------------------------------------------------------------
+            f32 GetDurationSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The number of times the section was entered.
+            //------------------------------------------------------------------------------
+            u32 GetNumRuns() const noexcept;
+            
+        private:
+            std::string m_testCaseName;
+            std::string m_name;
+            f32 m_durationSeconds;
+            u32 m_numRuns;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,79 @@
+//
+//  TestCaseResult.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <UnitTest/TestSystem/TestCaseResult.h>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TestCaseResult::TestCaseResult(const std::string& in_name, bool in_passed, f32 in_durationSeconds, const Common::AllocationStats& in_allocationStats,
+                                       const std::vector<BenchmarkResult>& in_benchmarkResults, const std::vector<SectionResult>& in_sectionResults) noexcept
+            : m_name(in_name), m_passed(in_passed), m_durationSeconds(in_durationSeconds), m_allocationStats(in_allocationStats), m_benchmarkResults(in_benchmarkResults),
+              m_sectionResults(in_sectionResults)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::string& TestCaseResult::GetName() const noexcept
+        {
+            return m_name;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool TestCaseResult::HasPassed() const noexcept
+        {
+            return m_passed;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        f32 TestCaseResult::GetDurationSeconds() const noexcept
+        {
+            return m_durationSeconds;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const Common::AllocationStats& TestCaseResult::GetAllocationStats() const noexcept
+        {
+            return m_allocationStats;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<BenchmarkResult>& TestCaseResult::GetBenchmarkResults() const noexcept
+        {
+            return m_benchmarkResults;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<SectionResult>& TestCaseResult::GetSectionResults() const noexcept
+        {
+            return m_sectionResults;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  TestCaseResult.h
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _UNITTEST_TESTSYSTEM_TESTCASERESULT_H_
+#define _UNITTEST_TESTSYSTEM_TESTCASERESULT_H_
+
+#include <CSTest.h>
+
+#include <Common/Performance/AllocationStats.h>
+#include <UnitTest/TestSystem/BenchmarkResult.h>
+#include <UnitTest/TestSystem/SectionResult.h>
+
+#include <vector>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        //------------------------------------------------------------------------------
+        /// A container for the outcome and timing of a single test case, regardless
+        /// of whether it passed or failed.
+        ///
+        /// This is immutable after construction.
+        //------------------------------------------------------------------------------
+        class TestCaseResult final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// @param in_name - The name of the test case.
+            /// @param in_passed - Whether or not all assertions in the test case passed.
+            /// @param in_durationSeconds - The total time spent running the test case,
+            /// including every run required to visit each of its sections.
+            /// @param in_allocationStats - [Optional] The heap allocations made while the
+            /// test case was running.
+            /// @param in_benchmarkResults - [Optional] The results of each benchmark in
+            /// the test case, in the order they were first run.
+            /// @param in_sectionResults - [Optional] The timing of each section in the
+            /// test case, in the order they were first entered.
+            //------------------------------------------------------------------------------
+            TestCaseResult(const std::string& in_name, bool in_passed, f32 in_durationSeconds, const Common::AllocationStats& in_allocationStats = Common::AllocationStats(),
+                           const std::vector<BenchmarkResult>& in_benchmarkResults = std::vector<BenchmarkResult>(),
+                           const std::vector<SectionResult>& in_sectionResults = std::vector<SectionResult>()) noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The name of the test case.
+            //------------------------------------------------------------------------------
+            const std::string& GetName() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return Whether or not all assertions in the test case passed.
+            //------------------------------------------------------------------------------
+            bool HasPassed() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The total time spent running the test case.
+            //------------------------------------------------------------------------------
+            f32 GetDurationSeconds() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The heap allocations made while the test case was running. This
+            /// will be empty unless allocation tracking is enabled.
+            //------------------------------------------------------------------------------
+            const Common::AllocationStats& GetAllocationStats() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The results of each benchmark in the test case, in the order they
+            /// were first run. This will be empty if the test case contains no
+            /// benchmarks.
+            //------------------------------------------------------------------------------
+            const std::vector<BenchmarkResult>& GetBenchmarkResults() const noexcept;
+            //------------------------------------------------------------------------------
+            /// @return The timing of each section in the test case, in the order they
+            /// were first entered. This will be empty if the test case contains no
+            /// sections.
+            //------------------------------------------------------------------------------
+            const std::vector<SectionResult>& GetSectionResults() const noexcept;
+            
+        private:
+            std::string m_name;
+            bool m_passed;
+            f32 m_durationSeconds;
+            Common::AllocationStats m_allocationStats;
+            std::vector<BenchmarkResult> m_benchmarkResults;
+            std::vector<SectionResult> m_sectionResults;
+        };
+    }
+}
+
+#endif
@@ -28,8 +28,25 @@
 
 #include <UnitTest/TestSystem/TestSystem.h>
 
+#include <Common/Performance/TraceRecorder.h>
+#include <Common/Report/JsonReportReader.h>
+#include <Common/Report/JsonReportWriter.h>
 #include <UnitTest/TestSystem/CSReporter.h>
 
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <algorithm>
+
+#if defined CS_TARGETPLATFORM_RPI
+#   include <cerrno>
+#   include <cstdio>
+#   include <sys/types.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
 #define CATCH_CONFIG_RUNNER
 #include <catch.hpp>
 
@@ -37,9 +54,292 @@ namespace CSTest
 {
     namespace UnitTest
     {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// Finds the names of each of the registered test cases that are selected by
+            /// the given filter, in registration order.
+            ///
+            /// @param in_filter - The filter.
+            ///
+            /// @return The names of the selected test cases.
+            //------------------------------------------------------------------------------
+            std::vector<std::string> GetSelectedTestCaseNames(const Common::TestFilter& in_filter) noexcept
+            {
+                std::vector<std::string> testCaseNames;
+                u32 numMatchingTestCases = 0;
+                
+                for (const auto& testCase : Catch::getRegistryHub().getTestCaseRegistry().getAllTests())
+                {
+                    const auto& name = testCase.getTestCaseInfo().name;
+                    if (!in_filter.IsMatch(name) || (testCase.isHidden() && !in_filter.IsExplicitlyIncluded(name)))
+                    {
+                        continue;
+                    }
+                    
+                    if (in_filter.IsInShard(numMatchingTestCases++))
+                    {
+                        testCaseNames.push_back(name);
+                    }
+                }
+                
+                return testCaseNames;
+            }
+            //------------------------------------------------------------------------------
+            /// Builds a Catch test spec which names each of the given test cases. Names
+            /// are quoted so that any characters which have special meaning in a test spec
+            /// are treated literally.
+            ///
+            /// @param in_testCaseNames - The names of the test cases.
+            ///
+            /// @return The test spec.
+            //------------------------------------------------------------------------------
+            std::string CreateTestSpec(const std::vector<std::string>& in_testCaseNames) noexcept
+            {
+                std::string testSpec;
+                for (const auto& name : in_testCaseNames)
+                {
+                    testSpec += (testSpec.empty() ? "\"" : ",\"") + name + "\"";
+                }
+                
+                return testSpec;
+            }
+            
+#if defined CS_TARGETPLATFORM_RPI
+            //------------------------------------------------------------------------------
+            /// Splits the given test cases into contiguous partitions of near equal size,
+            /// so that merging the reports of each partition in order gives the same
+            /// ordering as a single test run.
+            ///
+            /// @param in_testCaseNames - The names of the test cases.
+            /// @param in_numPartitions - The number of partitions. Must be greater than
+            /// zero and no more than the number of test cases.
+            ///
+            /// @return The partitions.
+            //------------------------------------------------------------------------------
+            std::vector<std::vector<std::string>> CreatePartitions(const std::vector<std::string>& in_testCaseNames, u32 in_numPartitions) noexcept
+            {
+                CS_ASSERT(in_numPartitions > 0 && in_numPartitions <= in_testCaseNames.size(), "Invalid number of partitions.");
+                
+                std::vector<std::vector<std::string>> partitions;
+                
+                auto numTestCases = u32(in_testCaseNames.size());
+                for (u32 i = 0; i < in_numPartitions; ++i)
+                {
+                    auto begin = in_testCaseNames.begin() + (numTestCases * i) / in_numPartitions;
+                    auto end = in_testCaseNames.begin() + (numTestCases * (i + 1)) / in_numPartitions;
+                    partitions.push_back(std::vector<std::string>(begin, end));
+                }
+                
+                return partitions;
+            }
+            //------------------------------------------------------------------------------
+            /// Creates a report for a partition whose process failed to report back, so
+            /// that the failure is presented in place of its test cases.
+            ///
+            /// @param in_partitionIndex - The index of the partition.
+            /// @param in_numTestCases - The number of test cases in the partition.
+            /// @param in_errorMessage - A description of the failure.
+            ///
+            /// @return The report.
+            //------------------------------------------------------------------------------
+            Report CreatePartitionFailureReport(u32 in_partitionIndex, u32 in_numTestCases, const std::string& in_errorMessage) noexcept
+            {
+                auto name = "Process " + CS::ToString(in_partitionIndex);
+                
+                std::vector<FailedAssertion> failedAssertions = { FailedAssertion("", 0, in_errorMessage) };
+                std::vector<FailedSection> failedSections = { FailedSection(name, 1, failedAssertions) };
+                std::vector<FailedTestCase> failedTestCases = { FailedTestCase(name, 1, 1, failedSections) };
+                
+                return Report(in_numTestCases, 1, 1, failedTestCases, std::vector<TestCaseResult>());
+            }
+            //------------------------------------------------------------------------------
+            /// Combines the reports of each partition into a single report.
+            ///
+            /// @param in_reports - The reports, in partition order.
+            ///
+            /// @return The combined report.
+            //------------------------------------------------------------------------------
+            Report MergeReports(const std::vector<Report>& in_reports) noexcept
+            {
+                u32 numTestCases = 0;
+                u32 numSections = 0;
+                u32 numAssertions = 0;
+                std::vector<FailedTestCase> failedTestCases;
+                std::vector<TestCaseResult> testCaseResults;
+                
+                for (const auto& report : in_reports)
+                {
+                    numTestCases += report.GetNumTestCases();
+                    numSections += report.GetNumSections();
+                    numAssertions += report.GetNumAssertions();
+                    failedTestCases.insert(failedTestCases.end(), report.GetFailedTestCases().begin(), report.GetFailedTestCases().end());
+                    testCaseResults.insert(testCaseResults.end(), report.GetTestCaseResults().begin(), report.GetTestCaseResults().end());
+                }
+                
+                return Report(numTestCases, numSections, numAssertions, failedTestCases, testCaseResults);
+            }
+            //------------------------------------------------------------------------------
+            /// Writes the whole of the given string to a file descriptor.
+            ///
+            /// @param in_fileDescriptor - The file descriptor.
+            /// @param in_data - The data to write.
+            ///
+            /// @return Whether or not all of the data was written.
+            //------------------------------------------------------------------------------
+            bool WriteAll(int in_fileDescriptor, const std::string& in_data) noexcept
+            {
+                std::size_t offset = 0;
+                while (offset < in_data.size())
+                {
+                    auto numWritten = write(in_fileDescriptor, in_data.data() + offset, in_data.size() - offset);
+                    if (numWritten < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    
+                    if (numWritten <= 0)
+                    {
+                        return false;
+                    }
+                    
+                    offset += std::size_t(numWritten);
+                }
+                
+                return true;
+            }
+            //------------------------------------------------------------------------------
+            /// Reads from a file descriptor until the end of the file is reached.
+            ///
+            /// @param in_fileDescriptor - The file descriptor.
+            ///
+            /// @return The data which was read.
+            //------------------------------------------------------------------------------
+            std::string ReadAll(int in_fileDescriptor) noexcept
+            {
+                std::string data;
+                
+                char buffer[4096];
+                while (true)
+                {
+                    auto numRead = read(in_fileDescriptor, buffer, sizeof(buffer));
+                    if (numRead < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    
+                    if (numRead <= 0)
+                    {
+                        break;
+                    }
+                    
+                    data.append(buffer, std::size_t(numRead));
+                }
+                
+                return data;
+            }
+            //------------------------------------------------------------------------------
+            /// Runs each partition of test cases in a forked child process, which reports
+            /// back to this process over a pipe. A test case which crashes only takes down
+            /// its own partition, which is reported as a failure.
+            ///
+            /// Only the calling thread exists in the child processes, so the tests must
+            /// not rely on any other thread, such as the main thread, to make progress.
+            ///
+            /// @param in_partitions - The names of the test cases in each partition.
+            /// @param in_runSession - Runs the Catch session for the given test spec.
+            /// @param in_progressDelegate - Called as each partition completes with the
+            /// total number of test cases completed so far.
+            ///
+            /// @return The combined report.
+            //------------------------------------------------------------------------------
+            Report RunPartitionsInProcesses(const std::vector<std::vector<std::string>>& in_partitions, const std::function<Report(const std::string&)>& in_runSession,
+                                            const CSReporter::ProgressDelegate& in_progressDelegate) noexcept
+            {
+                struct ChildProcess final
+                {
+                    pid_t m_processId;
+                    int m_readFileDescriptor;
+                };
+                
+                // Anything still buffered would otherwise be written again by each child.
+                std::fflush(nullptr);
+                
+                std::vector<ChildProcess> childProcesses;
+                std::vector<Report> reports(in_partitions.size());
+                for (u32 i = 0; i < in_partitions.size(); ++i)
+                {
+                    int fileDescriptors[2];
+                    if (pipe(fileDescriptors) != 0)
+                    {
+                        reports[i] = CreatePartitionFailureReport(i, u32(in_partitions[i].size()), "Failed to create pipe (errno " + CS::ToString(s32(errno)) + ").");
+                        childProcesses.push_back(ChildProcess { -1, -1 });
+                        continue;
+                    }
+                    
+                    auto processId = fork();
+                    if (processId == 0)
+                    {
+                        close(fileDescriptors[0]);
+                        auto succeeded = WriteAll(fileDescriptors[1], Common::JsonReportWriter::ToJson(in_runSession(CreateTestSpec(in_partitions[i]))));
+                        close(fileDescriptors[1]);
+                        _exit(succeeded ? 0 : 1);
+                    }
+                    
+                    close(fileDescriptors[1]);
+                    
+                    if (processId < 0)
+                    {
+                        close(fileDescriptors[0]);
+                        reports[i] = CreatePartitionFailureReport(i, u32(in_partitions[i].size()), "Failed to fork process (errno " + CS::ToString(s32(errno)) + ").");
+                        childProcesses.push_back(ChildProcess { -1, -1 });
+                        continue;
+                    }
+                    
+                    childProcesses.push_back(ChildProcess { processId, fileDescriptors[0] });
+                }
+                
+                u32 numCompletedTestCases = 0;
+                for (u32 i = 0; i < childProcesses.size(); ++i)
+                {
+                    const auto& childProcess = childProcesses[i];
+                    if (childProcess.m_processId > 0)
+                    {
+                        auto json = ReadAll(childProcess.m_readFileDescriptor);
+                        close(childProcess.m_readFileDescriptor);
+                        
+                        int status = 0;
+                        while (waitpid(childProcess.m_processId, &status, 0) < 0 && errno == EINTR)
+                        {
+                        }
+                        
+                        if (WIFSIGNALED(status))
+                        {
+                            reports[i] = CreatePartitionFailureReport(i, u32(in_partitions[i].size()), "Process was terminated by signal " + CS::ToString(s32(WTERMSIG(status))) + ".");
+                        }
+                        else if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+                        {
+                            reports[i] = CreatePartitionFailureReport(i, u32(in_partitions[i].size()), "Process exited with status " + CS::ToString(s32(WEXITSTATUS(status))) + ".");
+                        }
+                        else if (!Common::JsonReportReader::FromJson(json, reports[i]))
+                        {
+                            reports[i] = CreatePartitionFailureReport(i, u32(in_partitions[i].size()), "Process returned an invalid report.");
+                        }
+                    }
+                    
+                    numCompletedTestCases += u32(in_partitions[i].size());
+                    in_progressDelegate(numCompletedTestCases);
+                }
+                
+                return MergeReports(reports);
+            }
+#endif
+        }
+        
         CS_DEFINE_NAMEDTYPE(TestSystem);
         
         Catch::Session TestSystem::s_session;
+        std::atomic<bool> TestSystem::s_isRunning(false);
         
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -49,24 +349,111 @@ namespace CSTest
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
+        Report TestSystem::RunSession(const std::string& in_testSpec) noexcept
+        {
+            auto configData = s_session.configData();
+            configData.reporterNames = { "cs" };
+            configData.testsOrTags.clear();
+            
+            if (!in_testSpec.empty())
+            {
+                configData.testsOrTags.push_back(in_testSpec);
+            }
+            
+            s_session.useConfigData(configData);
+            s_session.run();
+            
+            return CSReporter::getReport();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
         bool TestSystem::IsA(CS::InterfaceIDType in_interfaceId) const
         {
             return (TestSystem::InterfaceID == in_interfaceId);
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
-        Report TestSystem::PerformTests()
+        void TestSystem::PerformTests(const ProgressDelegate& in_progressDelegate, const CompletionDelegate& in_completionDelegate, const Common::TestFilter& in_filter, u32 in_numProcesses) noexcept
         {
-            s_session.configData().reporterNames = { "cs" };
-
-            s_session.run();
+            CS_ASSERT(in_completionDelegate, "A completion delegate must be supplied.");
+            CS_ASSERT(!s_isRunning, "Cannot perform unit tests while a previous test run is still in progress.");
             
-            return CSReporter::getReport();
+            s_isRunning = true;
+            
+            auto testCaseNames = GetSelectedTestCaseNames(in_filter);
+            auto numTestCases = u32(testCaseNames.size());
+            auto isFiltered = !in_filter.IsEmpty();
+            
+            if (testCaseNames.empty())
+            {
+                CS_LOG_WARNING("No unit tests match the test filter.");
+            }
+            
+#if !defined CS_TARGETPLATFORM_RPI
+            if (in_numProcesses > 1)
+            {
+                CS_LOG_WARNING("Running unit tests in multiple processes is only supported on Raspberry Pi, all test cases will be run in this process.");
+            }
+            
+            u32 numProcesses = 1;
+#else
+            auto numProcesses = std::max(1u, std::min(in_numProcesses, numTestCases));
+#endif
+            
+            auto isActive = m_isActive;
+            auto traceRecorder = CS::Application::Get()->GetSystem<Common::TraceRecorder>();
+            CS_ASSERT(traceRecorder, "The trace recorder is required to run unit tests.");
+            
+            CSReporter::ProgressDelegate progressDelegate = [=](u32 in_numCompletedTestCases) noexcept
+            {
+                traceRecorder->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext& in_taskContext) noexcept
+                {
+                    if (*isActive && in_progressDelegate)
+                    {
+                        in_progressDelegate(in_numCompletedTestCases, numTestCases);
+                    }
+                });
+            };
+            
+            traceRecorder->ScheduleTask(CS::TaskType::k_large, [=](const CS::TaskContext& in_taskContext) noexcept
+            {
+                Report report;
+                
+                if (numProcesses > 1)
+                {
+#if defined CS_TARGETPLATFORM_RPI
+                    report = RunPartitionsInProcesses(CreatePartitions(testCaseNames, numProcesses), [](const std::string& in_testSpec) noexcept { return RunSession(in_testSpec); }, progressDelegate);
+#endif
+                }
+                else if (!testCaseNames.empty())
+                {
+                    CSReporter::setProgressDelegate(progressDelegate);
+                    report = RunSession(isFiltered ? CreateTestSpec(testCaseNames) : "");
+                    CSReporter::setProgressDelegate(nullptr);
+                }
+                
+                s_isRunning = false;
+                
+                traceRecorder->ScheduleTask(CS::TaskType::k_mainThread, [=](const CS::TaskContext& in_taskContext) noexcept
+                {
+                    if (*isActive)
+                    {
+                        in_completionDelegate(report);
+                    }
+                });
+            });
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
         void TestSystem::OnInit()
         {
+            m_isActive = std::make_shared<bool>(true);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TestSystem::OnDestroy()
+        {
+            *m_isActive = false;
         }
     }
 }
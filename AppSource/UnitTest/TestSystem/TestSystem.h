@@ -30,10 +30,15 @@
 #define _UNITTEST_TESTSYSTEM_TESTSYSTEM_H_
 
 #include <CSTest.h>
+#include <Common/Core/TestFilter.h>
 #include <UnitTest/TestSystem/Report.h>
 
 #include <ChilliSource/Core/System.h>
 
+#include <atomic>
+#include <functional>
+#include <memory>
+
 namespace Catch { class Session; }
 
 namespace CSTest
@@ -41,8 +46,14 @@ namespace CSTest
     namespace UnitTest
     {
         //------------------------------------------------------------------------------
-        /// A system for performing integration tests using Catch. The tests should be
-        /// setup using standard Catch format.
+        /// A system for performing unit tests using Catch. The tests should be setup
+        /// using standard Catch format.
+        ///
+        /// Tests are performed on a background task so that the app continues to
+        /// update while they run. Catch relies on global state, so only one test run
+        /// can be in progress at a time, and test cases cannot be split across
+        /// threads within a single process. Instead, on Raspberry Pi, test cases can be
+        /// partitioned across a number of forked processes.
         ///
         /// @author Ian Copland
         //------------------------------------------------------------------------------
@@ -51,6 +62,21 @@ namespace CSTest
         public:
             CS_DECLARE_NAMEDTYPE(TestSystem);
             //------------------------------------------------------------------------------
+            /// A delegate which is called on the main thread as test cases complete.
+            ///
+            /// @param in_numCompletedTestCases - The number of test cases which have
+            /// completed.
+            /// @param in_numTestCases - The total number of test cases which will be run.
+            //------------------------------------------------------------------------------
+            using ProgressDelegate = std::function<void(u32 in_numCompletedTestCases, u32 in_numTestCases) noexcept>;
+            //------------------------------------------------------------------------------
+            /// A delegate which is called on the main thread when all tests have been
+            /// performed.
+            ///
+            /// @param in_report - The test report.
+            //------------------------------------------------------------------------------
+            using CompletionDelegate = std::function<void(const Report& in_report) noexcept>;
+            //------------------------------------------------------------------------------
             /// Allows querying of whether or not this system implements the interface
             /// described by the given interface Id. Typically this is not called directly
             /// as the templated equivalent IsA<Interface>() is preferred.
@@ -63,14 +89,29 @@ namespace CSTest
             //------------------------------------------------------------------------------
             bool IsA(CS::InterfaceIDType in_interfaceId) const override;
             //------------------------------------------------------------------------------
-            /// Performs all integration tests and returns a report detailing whether or not
-            /// they were successful.
+            /// Starts performing all unit tests selected by the given filter on a
+            /// background task. Hidden test cases are only run if they are explicitly
+            /// named by one of the filter's include patterns. Neither delegate will be
+            /// called once the system has been destroyed.
+            ///
+            /// This must not be called while a previous test run is still in progress,
+            /// including one started by a system which has since been destroyed.
             ///
             /// @author Ian Copland
             ///
-            /// @return The test report.
+            /// @param in_progressDelegate - The delegate called as test cases complete.
+            /// May be null.
+            /// @param in_completionDelegate - The delegate called with the report once
+            /// all tests have been performed.
+            /// @param in_filter - [Optional] The filter describing which test cases should
+            /// be run. Defaults to all test cases.
+            /// @param in_numProcesses - [Optional] The number of processes the selected
+            /// test cases should be partitioned across. This is only supported on
+            /// Raspberry Pi; elsewhere all test cases are run in the app's process.
+            /// Defaults to 1.
             //------------------------------------------------------------------------------
-            Report PerformTests();
+            void PerformTests(const ProgressDelegate& in_progressDelegate, const CompletionDelegate& in_completionDelegate, const Common::TestFilter& in_filter = Common::TestFilter(),
+                              u32 in_numProcesses = 1) noexcept;
             
         private:
             friend class CS::State;
@@ -83,6 +124,15 @@ namespace CSTest
             //------------------------------------------------------------------------------
             static TestSystemUPtr Create();
             //------------------------------------------------------------------------------
+            /// Runs the Catch session on the calling thread.
+            ///
+            /// @param in_testSpec - The Catch test spec describing which test cases should
+            /// be run. If empty, all non-hidden test cases are run.
+            ///
+            /// @return The test report.
+            //------------------------------------------------------------------------------
+            static Report RunSession(const std::string& in_testSpec) noexcept;
+            //------------------------------------------------------------------------------
             /// Default constructor. Declared private to ensure the system is created
             /// through State::CreateSystem<TestSystem>().
             ///
@@ -95,8 +145,15 @@ namespace CSTest
             /// @author Ian Copland
             //------------------------------------------------------------------------------
             void OnInit() override;
+            //------------------------------------------------------------------------------
+            /// Ensures the delegates of any test run still in progress are not called.
+            //------------------------------------------------------------------------------
+            void OnDestroy() override;
+            
+            std::shared_ptr<bool> m_isActive;
             
             static Catch::Session s_session; //there can only be one catch session
+            static std::atomic<bool> s_isRunning;
         };
     }
 }
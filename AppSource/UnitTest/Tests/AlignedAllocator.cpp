@@ -0,0 +1,194 @@
+//
+//  AlignedAllocator.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Memory/AlignedAllocator.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        namespace
+        {
+            constexpr u32 k_numObjects = 64;
+            constexpr u32 k_numArrayElements = 5;
+            constexpr std::size_t k_bufferSize = 64 * 1024;
+            constexpr std::size_t k_pageSize = 1024;
+            
+            /// An example type with the given alignment, such as a SIMD vector or a
+            /// structure isolated to its own cache line.
+            ///
+            template <std::size_t TAlignment> struct alignas(TAlignment) AlignedObject final
+            {
+                AlignedObject() = default;
+                AlignedObject(u32 in_value) : m_value(in_value) {}
+                
+                u32 m_value = 0;
+            };
+            
+            /// @return Whether or not the given pointer has the given alignment.
+            ///
+            bool IsAligned(const void* in_pointer, std::size_t in_alignment) noexcept
+            {
+                return (reinterpret_cast<std::uintptr_t>(in_pointer) % in_alignment) == 0;
+            }
+            
+            /// Allocates a series of unique pointers, shared pointers and arrays of an
+            /// over-aligned type from the given allocator, confirming that each is aligned
+            /// and that none overwrite each other.
+            ///
+            template <std::size_t TAlignment> void RequireAlignedAllocations(CS::IAllocator& in_allocator) noexcept
+            {
+                using ObjectType = AlignedObject<TAlignment>;
+                
+                Common::AlignedAllocator alignedAllocator(in_allocator, alignof(ObjectType));
+                
+                std::vector<CS::UniquePtr<ObjectType>> uniqueObjects;
+                std::vector<std::shared_ptr<ObjectType>> sharedObjects;
+                std::vector<CS::UniquePtr<ObjectType[]>> arrays;
+                for (u32 i = 0; i < k_numObjects; ++i)
+                {
+                    uniqueObjects.push_back(CS::MakeUnique<ObjectType>(alignedAllocator, i));
+                    sharedObjects.push_back(CS::MakeShared<ObjectType>(alignedAllocator, i));
+                    arrays.push_back(CS::MakeUniqueArray<ObjectType>(alignedAllocator, k_numArrayElements));
+                    
+                    for (u32 j = 0; j < k_numArrayElements; ++j)
+                    {
+                        arrays.back()[j].m_value = i;
+                    }
+                }
+                
+                for (u32 i = 0; i < k_numObjects; ++i)
+                {
+                    REQUIRE(IsAligned(uniqueObjects[i].get(), TAlignment));
+                    REQUIRE(IsAligned(sharedObjects[i].get(), TAlignment));
+                    REQUIRE(IsAligned(arrays[i].get(), TAlignment));
+                    
+                    REQUIRE(uniqueObjects[i]->m_value == i);
+                    REQUIRE(sharedObjects[i]->m_value == i);
+                    for (u32 j = 0; j < k_numArrayElements; ++j)
+                    {
+                        REQUIRE(arrays[i][j].m_value == i);
+                    }
+                }
+            }
+        }
+        
+        /// A series of tests for the AlignedAllocator
+        ///
+        TEST_CASE("AlignedAllocator", "[Allocator]")
+        {
+            /// Confirms that over-aligned types can be allocated from a LinearAllocator.
+            ///
+            SECTION("Linear")
+            {
+                CS::LinearAllocator linearAllocator(k_bufferSize);
+                
+                RequireAlignedAllocations<16>(linearAllocator);
+                linearAllocator.Reset();
+                
+                RequireAlignedAllocations<32>(linearAllocator);
+                linearAllocator.Reset();
+                
+                RequireAlignedAllocations<64>(linearAllocator);
+                linearAllocator.Reset();
+            }
+            
+            /// Confirms that over-aligned types can be allocated from a PagedLinearAllocator, including those which
+            /// are placed at the start of a new page.
+            ///
+            SECTION("Paged")
+            {
+                CS::PagedLinearAllocator pagedLinearAllocator(k_pageSize);
+                
+                RequireAlignedAllocations<16>(pagedLinearAllocator);
+                RequireAlignedAllocations<32>(pagedLinearAllocator);
+                RequireAlignedAllocations<64>(pagedLinearAllocator);
+                
+                REQUIRE(pagedLinearAllocator.GetNumPages() > 1);
+                
+                pagedLinearAllocator.Reset();
+            }
+            
+            /// Confirms that an allocation which fills the remainder of a page is aligned on the following page.
+            ///
+            SECTION("PageBoundary")
+            {
+                constexpr std::size_t k_alignment = 64;
+                
+                CS::PagedLinearAllocator pagedLinearAllocator(k_pageSize);
+                Common::AlignedAllocator alignedAllocator(pagedLinearAllocator, k_alignment);
+                
+                std::vector<u8*> buffers;
+                for (std::size_t size = 1; size <= alignedAllocator.GetMaxAllocationSize(); size += 7)
+                {
+                    auto buffer = static_cast<u8*>(alignedAllocator.Allocate(size));
+                    REQUIRE(IsAligned(buffer, k_alignment));
+                    
+                    std::fill(buffer, buffer + size, u8(buffers.size()));
+                    buffers.push_back(buffer);
+                }
+                
+                for (std::size_t i = 0; i < buffers.size(); ++i)
+                {
+                    REQUIRE(buffers[i][0] == u8(i));
+                    alignedAllocator.Deallocate(buffers[i]);
+                }
+                
+                REQUIRE(pagedLinearAllocator.GetNumPages() > 1);
+            }
+            
+            /// Confirms that deallocations are returned to the wrapped allocator, such that it can be reset.
+            ///
+            SECTION("Deallocation")
+            {
+                CS::LinearAllocator linearAllocator(k_bufferSize);
+                Common::AlignedAllocator alignedAllocator(linearAllocator, 64);
+                
+                {
+                    auto valueA = CS::MakeUnique<int>(alignedAllocator, 1);
+                    auto valueB = CS::MakeShared<int>(alignedAllocator, 2);
+                    
+                    REQUIRE(*valueA == 1);
+                    REQUIRE(*valueB == 2);
+                }
+                
+                linearAllocator.Reset();
+                REQUIRE(linearAllocator.GetFreeSpace() == linearAllocator.GetBufferSize());
+            }
+        }
+    }
+}
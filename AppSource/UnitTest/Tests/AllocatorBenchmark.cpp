@@ -0,0 +1,554 @@
+//
+//  AllocatorBenchmark.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Memory/ConcurrentObjectPoolAllocator.h>
+#include <Common/Memory/MemoryResource.h>
+#include <Common/Memory/PolymorphicAllocator.h>
+#include <UnitTest/TestSystem/Benchmark.h>
+
+#include <ChilliSource/Core/Memory.h>
+#include <ChilliSource/Core/String.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        namespace
+        {
+            constexpr u32 k_numAllocationsPerBatch = 256;
+            constexpr u32 k_numContendingThreads = 4;
+            constexpr std::size_t k_linearAllocatorBufferSize = 1024 * 1024;
+            constexpr std::size_t k_pagedAllocatorPageSize = 64 * 1024;
+            
+            /// An object of the given size in bytes, used to measure how allocation cost
+            /// scales with allocation size.
+            ///
+            template <std::size_t TSize> struct Object final
+            {
+                u8 m_data[TSize];
+            };
+            
+            /// Allocates a batch of unique pointers from the given CS allocator and then
+            /// releases them.
+            ///
+            template <typename TObject, typename TAllocator> void AllocateUniqueBatch(TAllocator& in_allocator, std::vector<CS::UniquePtr<TObject>>& in_objects) noexcept
+            {
+                for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                {
+                    in_objects.push_back(CS::MakeUnique<TObject>(in_allocator));
+                }
+                
+                in_objects.clear();
+            }
+            
+            /// Allocates a batch of shared pointers from the given CS allocator and then
+            /// releases them.
+            ///
+            template <typename TObject, typename TAllocator> void AllocateSharedBatch(TAllocator& in_allocator, std::vector<std::shared_ptr<TObject>>& in_objects) noexcept
+            {
+                for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                {
+                    in_objects.push_back(CS::MakeShared<TObject>(in_allocator));
+                }
+                
+                in_objects.clear();
+            }
+            
+            /// Allocates a batch of unique pointers from the global heap using new and
+            /// then releases them.
+            ///
+            template <typename TObject> void AllocateUniqueBatch(std::vector<std::unique_ptr<TObject>>& in_objects) noexcept
+            {
+                for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                {
+                    in_objects.push_back(std::unique_ptr<TObject>(new TObject()));
+                }
+                
+                in_objects.clear();
+            }
+            
+            /// Allocates a batch of buffers with malloc and then frees them.
+            ///
+            template <typename TObject> void AllocateMallocBatch(std::vector<void*>& in_buffers) noexcept
+            {
+                for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                {
+                    in_buffers.push_back(std::malloc(sizeof(TObject)));
+                }
+                
+                for (auto buffer : in_buffers)
+                {
+                    std::free(buffer);
+                }
+                
+                in_buffers.clear();
+            }
+            
+            /// Runs the given function on a number of threads at the same time, and waits
+            /// for them all to finish.
+            ///
+            void RunOnThreads(const std::function<void()>& in_function) noexcept
+            {
+                std::vector<std::thread> threads;
+                for (u32 i = 0; i < k_numContendingThreads; ++i)
+                {
+                    threads.push_back(std::thread(in_function));
+                }
+                
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+            }
+            
+            /// Benchmarks allocating a batch of unique pointers to objects of the given
+            /// size from each allocator, and from the global heap.
+            ///
+            template <std::size_t TSize> void BenchmarkUniqueAllocation() noexcept
+            {
+                using ObjectType = Object<TSize>;
+                const auto suffix = "/" + CS::ToString(u32(TSize));
+                
+                CS::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+                CS::PagedLinearAllocator pagedLinearAllocator(k_pagedAllocatorPageSize);
+                CS::ObjectPoolAllocator<ObjectType> objectPoolAllocator(k_numAllocationsPerBatch);
+                
+                std::vector<CS::UniquePtr<ObjectType>> objects;
+                objects.reserve(k_numAllocationsPerBatch);
+                std::vector<std::unique_ptr<ObjectType>> heapObjects;
+                heapObjects.reserve(k_numAllocationsPerBatch);
+                std::vector<void*> buffers;
+                buffers.reserve(k_numAllocationsPerBatch);
+                
+                CSUT_BENCHMARK("LinearAllocator" + suffix)
+                {
+                    AllocateUniqueBatch(linearAllocator, objects);
+                    linearAllocator.Reset();
+                }
+                
+                CSUT_BENCHMARK("PagedLinearAllocator" + suffix)
+                {
+                    AllocateUniqueBatch(pagedLinearAllocator, objects);
+                    pagedLinearAllocator.Reset();
+                }
+                
+                CSUT_BENCHMARK("ObjectPoolAllocator" + suffix)
+                {
+                    AllocateUniqueBatch(objectPoolAllocator, objects);
+                }
+                
+                CSUT_BENCHMARK("new" + suffix)
+                {
+                    AllocateUniqueBatch(heapObjects);
+                }
+                
+                CSUT_BENCHMARK("malloc" + suffix)
+                {
+                    AllocateMallocBatch<ObjectType>(buffers);
+                }
+            }
+            
+            /// Benchmarks allocating a batch of shared pointers to objects of the given
+            /// size from each allocator, and from the global heap.
+            ///
+            template <std::size_t TSize> void BenchmarkSharedAllocation() noexcept
+            {
+                using ObjectType = Object<TSize>;
+                const auto suffix = "/" + CS::ToString(u32(TSize));
+                
+                CS::LinearAllocator linearAllocator(k_linearAllocatorBufferSize);
+                CS::PagedLinearAllocator pagedLinearAllocator(k_pagedAllocatorPageSize);
+                CS::ObjectPoolAllocator<ObjectType> objectPoolAllocator(k_numAllocationsPerBatch);
+                
+                std::vector<std::shared_ptr<ObjectType>> objects;
+                objects.reserve(k_numAllocationsPerBatch);
+                
+                CSUT_BENCHMARK("LinearAllocator" + suffix)
+                {
+                    AllocateSharedBatch(linearAllocator, objects);
+                    linearAllocator.Reset();
+                }
+                
+                CSUT_BENCHMARK("PagedLinearAllocator" + suffix)
+                {
+                    AllocateSharedBatch(pagedLinearAllocator, objects);
+                    pagedLinearAllocator.Reset();
+                }
+                
+                CSUT_BENCHMARK("ObjectPoolAllocator" + suffix)
+                {
+                    AllocateSharedBatch(objectPoolAllocator, objects);
+                }
+                
+                CSUT_BENCHMARK("std::make_shared" + suffix)
+                {
+                    for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                    {
+                        objects.push_back(std::make_shared<ObjectType>());
+                    }
+                    
+                    objects.clear();
+                }
+                
+                CSUT_BENCHMARK("std::allocate_shared" + suffix)
+                {
+                    for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                    {
+                        objects.push_back(std::allocate_shared<ObjectType>(std::allocator<ObjectType>()));
+                    }
+                    
+                    objects.clear();
+                }
+            }
+            
+            /// Benchmarks allocating a batch of 64 byte objects from a PagedLinearAllocator
+            /// with the given page size. Pages are either kept between batches, or released
+            /// with ResetAndShrink() so that each batch pays for acquiring its pages.
+            ///
+            void BenchmarkPageSize(std::size_t in_pageSize) noexcept
+            {
+                using ObjectType = Object<64>;
+                const auto suffix = "/" + CS::ToString(u32(in_pageSize));
+                
+                CS::PagedLinearAllocator pagedLinearAllocator(in_pageSize);
+                
+                std::vector<CS::UniquePtr<ObjectType>> objects;
+                objects.reserve(k_numAllocationsPerBatch);
+                
+                CSUT_BENCHMARK("Reset" + suffix)
+                {
+                    AllocateUniqueBatch(pagedLinearAllocator, objects);
+                    pagedLinearAllocator.Reset();
+                }
+                
+                CSUT_BENCHMARK("ResetAndShrink" + suffix)
+                {
+                    AllocateUniqueBatch(pagedLinearAllocator, objects);
+                    pagedLinearAllocator.ResetAndShrink();
+                }
+            }
+        }
+        
+        /// Benchmarks the throughput of CS::MakeUnique() with each allocator, against the
+        /// global heap, over a range of object sizes. Each iteration allocates and releases
+        /// a batch of 256 objects. These are hidden as they take a long time to run; use
+        /// the test filter to include them by name.
+        ///
+        TEST_CASE("AllocatorBenchmarkUnique", "[.][Benchmark][Allocator]")
+        {
+            BenchmarkUniqueAllocation<16>();
+            BenchmarkUniqueAllocation<64>();
+            BenchmarkUniqueAllocation<256>();
+            BenchmarkUniqueAllocation<1024>();
+        }
+        
+        /// Benchmarks the throughput of CS::MakeShared() with each allocator, against
+        /// std::make_shared() and std::allocate_shared(), over a range of object sizes.
+        ///
+        TEST_CASE("AllocatorBenchmarkShared", "[.][Benchmark][Allocator]")
+        {
+            BenchmarkSharedAllocation<16>();
+            BenchmarkSharedAllocation<64>();
+            BenchmarkSharedAllocation<256>();
+            BenchmarkSharedAllocation<1024>();
+        }
+        
+        /// Benchmarks the effect of page size on a PagedLinearAllocator, for a batch which
+        /// needs 16 KB.
+        ///
+        TEST_CASE("AllocatorBenchmarkPageSize", "[.][Benchmark][Allocator]")
+        {
+            BenchmarkPageSize(256);
+            BenchmarkPageSize(1024);
+            BenchmarkPageSize(4 * 1024);
+            BenchmarkPageSize(16 * 1024);
+            BenchmarkPageSize(64 * 1024);
+        }
+        
+        /// Benchmarks the cost of each ObjectPoolAllocator limit policy, for a pool which
+        /// is created for each batch. The expanding pool starts with a sixteenth of the
+        /// capacity it needs, so this includes the cost of growing it.
+        ///
+        TEST_CASE("AllocatorBenchmarkExpandPolicy", "[.][Benchmark][Allocator]")
+        {
+            using ObjectType = Object<64>;
+            
+            std::vector<CS::UniquePtr<ObjectType>> objects;
+            objects.reserve(k_numAllocationsPerBatch);
+            
+            CSUT_BENCHMARK("Fixed")
+            {
+                CS::ObjectPoolAllocator<ObjectType> pool(k_numAllocationsPerBatch);
+                AllocateUniqueBatch(pool, objects);
+            }
+            
+            CSUT_BENCHMARK("Expand")
+            {
+                CS::ObjectPoolAllocator<ObjectType> pool(k_numAllocationsPerBatch / 16, CS::ObjectPoolAllocatorLimitPolicy::k_expand);
+                AllocateUniqueBatch(pool, objects);
+            }
+            
+            CS::ObjectPoolAllocator<ObjectType> expandedPool(k_numAllocationsPerBatch / 16, CS::ObjectPoolAllocatorLimitPolicy::k_expand);
+            AllocateUniqueBatch(expandedPool, objects);
+            
+            CSUT_BENCHMARK("ExpandAfterGrowth")
+            {
+                AllocateUniqueBatch(expandedPool, objects);
+            }
+        }
+        
+        /// Benchmarks allocation from several threads at once. The CS allocators are not
+        /// thread-safe so shared instances are guarded by a mutex, which is compared with
+        /// the global heap, the lock-free ConcurrentObjectPoolAllocator and with an
+        /// allocator per thread. Each thread allocates and releases a batch of 256 objects
+        /// per iteration, and the threads are created for each iteration; "ThreadOverhead"
+        /// measures the cost of that alone.
+        ///
+        TEST_CASE("AllocatorBenchmarkContended", "[.][Benchmark][Allocator]")
+        {
+            using ObjectType = Object<64>;
+            
+            CSUT_BENCHMARK("ThreadOverhead")
+            {
+                RunOnThreads([]()
+                {
+                });
+            }
+            
+            CSUT_BENCHMARK("new")
+            {
+                RunOnThreads([]()
+                {
+                    std::vector<std::unique_ptr<ObjectType>> objects;
+                    objects.reserve(k_numAllocationsPerBatch);
+                    AllocateUniqueBatch(objects);
+                });
+            }
+            
+            CSUT_BENCHMARK("malloc")
+            {
+                RunOnThreads([]()
+                {
+                    std::vector<void*> buffers;
+                    buffers.reserve(k_numAllocationsPerBatch);
+                    AllocateMallocBatch<ObjectType>(buffers);
+                });
+            }
+            
+            std::mutex mutex;
+            CS::PagedLinearAllocator sharedPagedLinearAllocator(k_pagedAllocatorPageSize);
+            CSUT_BENCHMARK("PagedLinearAllocatorWithMutex")
+            {
+                RunOnThreads([&]()
+                {
+                    std::vector<CS::UniquePtr<ObjectType>> objects;
+                    objects.reserve(k_numAllocationsPerBatch);
+                    
+                    for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        objects.push_back(CS::MakeUnique<ObjectType>(sharedPagedLinearAllocator));
+                    }
+                    
+                    std::unique_lock<std::mutex> lock(mutex);
+                    objects.clear();
+                });
+                
+                sharedPagedLinearAllocator.Reset();
+            }
+            
+            CS::ObjectPoolAllocator<ObjectType> sharedObjectPoolAllocator(k_numAllocationsPerBatch * k_numContendingThreads);
+            CSUT_BENCHMARK("ObjectPoolAllocatorWithMutex")
+            {
+                RunOnThreads([&]()
+                {
+                    std::vector<CS::UniquePtr<ObjectType>> objects;
+                    objects.reserve(k_numAllocationsPerBatch);
+                    
+                    for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        objects.push_back(CS::MakeUnique<ObjectType>(sharedObjectPoolAllocator));
+                    }
+                    
+                    std::unique_lock<std::mutex> lock(mutex);
+                    objects.clear();
+                });
+            }
+            
+            Common::ConcurrentObjectPoolAllocator<ObjectType> concurrentObjectPoolAllocator(k_numAllocationsPerBatch * k_numContendingThreads);
+            CSUT_BENCHMARK("ConcurrentObjectPoolAllocator")
+            {
+                RunOnThreads([&]()
+                {
+                    std::vector<CS::UniquePtr<ObjectType>> objects;
+                    objects.reserve(k_numAllocationsPerBatch);
+                    AllocateUniqueBatch(concurrentObjectPoolAllocator, objects);
+                });
+            }
+            
+            CSUT_BENCHMARK("PagedLinearAllocatorPerThread")
+            {
+                RunOnThreads([]()
+                {
+                    CS::PagedLinearAllocator pagedLinearAllocator(k_pagedAllocatorPageSize);
+                    
+                    std::vector<CS::UniquePtr<ObjectType>> objects;
+                    objects.reserve(k_numAllocationsPerBatch);
+                    AllocateUniqueBatch(pagedLinearAllocator, objects);
+                });
+            }
+        }
+        
+        /// Benchmarks objects which are allocated on several threads and released on
+        /// another, as happens when objects created in background tasks are released on
+        /// the main thread. Each thread allocates a batch of 256 objects, and they are all
+        /// released by the benchmarking thread once the others have finished.
+        ///
+        TEST_CASE("AllocatorBenchmarkCrossThread", "[.][Benchmark][Allocator]")
+        {
+            using ObjectType = Object<64>;
+            
+            std::vector<std::vector<CS::UniquePtr<ObjectType>>> threadObjects(k_numContendingThreads);
+            for (auto& objects : threadObjects)
+            {
+                objects.reserve(k_numAllocationsPerBatch);
+            }
+            
+            std::mutex mutex;
+            CS::ObjectPoolAllocator<ObjectType> objectPoolAllocator(k_numAllocationsPerBatch * k_numContendingThreads);
+            CSUT_BENCHMARK("ObjectPoolAllocatorWithMutex")
+            {
+                std::atomic<u32> nextThread(0);
+                RunOnThreads([&]()
+                {
+                    auto& objects = threadObjects[nextThread++];
+                    for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        objects.push_back(CS::MakeUnique<ObjectType>(objectPoolAllocator));
+                    }
+                });
+                
+                std::unique_lock<std::mutex> lock(mutex);
+                for (auto& objects : threadObjects)
+                {
+                    objects.clear();
+                }
+            }
+            
+            Common::ConcurrentObjectPoolAllocator<ObjectType> concurrentObjectPoolAllocator(k_numAllocationsPerBatch * k_numContendingThreads);
+            CSUT_BENCHMARK("ConcurrentObjectPoolAllocator")
+            {
+                std::atomic<u32> nextThread(0);
+                RunOnThreads([&]()
+                {
+                    auto& objects = threadObjects[nextThread++];
+                    for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                    {
+                        objects.push_back(CS::MakeUnique<ObjectType>(concurrentObjectPoolAllocator));
+                    }
+                });
+                
+                for (auto& objects : threadObjects)
+                {
+                    objects.clear();
+                }
+            }
+        }
+        
+        /// Benchmarks standard containers which are built and discarded each frame, using
+        /// the global heap and a CS allocator via an AllocatorMemoryResource. Each iteration
+        /// grows a vector to 256 objects without reserving, and builds a list of 256 objects.
+        ///
+        TEST_CASE("AllocatorBenchmarkContainers", "[.][Benchmark][Allocator]")
+        {
+            using ObjectType = Object<64>;
+            using ResourceAllocator = Common::PolymorphicAllocator<ObjectType>;
+            
+            CSUT_BENCHMARK("VectorStdAllocator")
+            {
+                std::vector<ObjectType> objects;
+                for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                {
+                    objects.push_back(ObjectType());
+                }
+            }
+            
+            CS::PagedLinearAllocator pagedLinearAllocator(k_pagedAllocatorPageSize);
+            Common::AllocatorMemoryResource pagedResource(pagedLinearAllocator);
+            CSUT_BENCHMARK("VectorPagedLinearAllocator")
+            {
+                {
+                    std::vector<ObjectType, ResourceAllocator> objects(&pagedResource);
+                    for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                    {
+                        objects.push_back(ObjectType());
+                    }
+                }
+                
+                pagedLinearAllocator.Reset();
+            }
+            
+            CSUT_BENCHMARK("ListStdAllocator")
+            {
+                std::list<ObjectType> objects;
+                for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                {
+                    objects.push_back(ObjectType());
+                }
+            }
+            
+            // Some standard libraries also allocate the list's sentinel node, and a container proxy in debug builds, through the allocator.
+            constexpr u32 k_numListContainerAllocations = 2;
+            
+            CS::ObjectPoolAllocator<Object<128>> objectPoolAllocator(k_numAllocationsPerBatch + k_numListContainerAllocations);
+            Common::AllocatorMemoryResource poolResource(objectPoolAllocator);
+            CSUT_BENCHMARK("ListObjectPoolAllocator")
+            {
+                std::list<ObjectType, ResourceAllocator> objects(&poolResource);
+                for (u32 i = 0; i < k_numAllocationsPerBatch; ++i)
+                {
+                    objects.push_back(ObjectType());
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,212 @@
+//
+//  ConcurrentObjectPoolAllocator.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Memory/ConcurrentObjectPoolAllocator.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        namespace
+        {
+            constexpr u32 k_defaultNumObjects = 5;
+            constexpr u32 k_numThreads = 4;
+            constexpr u32 k_numObjectsPerThread = 1000;
+        }
+        
+        /// A series of tests for the ConcurrentObjectPoolAllocator
+        ///
+        TEST_CASE("ConcurrentObjectPoolAllocator", "[Allocator]")
+        {
+            /// Confirms that a raw pointer to a fundamental can be allocated from the pool.
+            ///
+            SECTION("RawFundamental")
+            {
+                Common::ConcurrentObjectPoolAllocator<int> pool(k_defaultNumObjects);
+                
+                auto allocated = pool.Allocate();
+                *allocated = 1;
+                
+                REQUIRE(*allocated == 1);
+                
+                pool.Deallocate(allocated);
+            }
+            
+            /// Confirms that a unique pointer to a struct instance with a constructor can be allocated from the pool.
+            ///
+            SECTION("UniqueStructConstructor")
+            {
+                struct ExampleClass
+                {
+                    ExampleClass(int x, int y) : m_x(x), m_y(y) {}
+                    int m_x, m_y;
+                };
+                
+                Common::ConcurrentObjectPoolAllocator<ExampleClass> pool(k_defaultNumObjects);
+                
+                auto allocated = CS::MakeUnique<ExampleClass>(pool, 1, 2);
+                
+                REQUIRE(allocated->m_x == 1);
+                REQUIRE(allocated->m_y == 2);
+            }
+            
+            /// Confirms that deallocating an object does not affect other allocations, and that the slot is reused.
+            ///
+            SECTION("Deallocation")
+            {
+                Common::ConcurrentObjectPoolAllocator<int> pool(k_defaultNumObjects);
+                
+                auto valueA = CS::MakeUnique<int>(pool, 1);
+                auto valueB = CS::MakeUnique<int>(pool, 2);
+                auto addressB = valueB.get();
+                valueB.reset();
+                valueB = CS::MakeUnique<int>(pool, 3);
+                
+                REQUIRE(*valueA == 1);
+                REQUIRE(*valueB == 3);
+                REQUIRE(valueB.get() == addressB);
+            }
+            
+            /// Confirms that the pool can handle multiple allocations and deallocations up to the capacity
+            ///
+            SECTION("Fixed")
+            {
+                Common::ConcurrentObjectPoolAllocator<int> pool(k_defaultNumObjects);
+                std::vector<CS::UniquePtr<int>> allocated;
+                
+                for (u32 i = 0; i < k_defaultNumObjects; ++i)
+                {
+                    allocated.push_back(CS::MakeUnique<int>(pool, int(i)));
+                }
+                
+                allocated.clear();
+                
+                auto allocated1 = CS::MakeUnique<int>(pool, -1);
+                REQUIRE(*allocated1 == -1);
+            }
+            
+            /// Confirms that the pool can allocate beyond its capacity with the expand policy
+            ///
+            SECTION("Expand")
+            {
+                Common::ConcurrentObjectPoolAllocator<int> pool(k_defaultNumObjects, CS::ObjectPoolAllocatorLimitPolicy::k_expand);
+                std::vector<CS::UniquePtr<int>> allocated;
+                
+                for (u32 i = 0; i < k_defaultNumObjects * 2; ++i)
+                {
+                    allocated.push_back(CS::MakeUnique<int>(pool, int(i)));
+                }
+                
+                for (u32 i = 0; i < allocated.size(); ++i)
+                {
+                    REQUIRE(*allocated[i] == int(i));
+                }
+            }
+            
+            /// Confirms that objects allocated on several threads at once are unique, and can be deallocated on another thread.
+            ///
+            SECTION("CrossThread")
+            {
+                Common::ConcurrentObjectPoolAllocator<u32> pool(k_numThreads * k_numObjectsPerThread);
+                std::vector<std::vector<CS::UniquePtr<u32>>> allocated(k_numThreads);
+                
+                std::vector<std::thread> threads;
+                for (u32 i = 0; i < k_numThreads; ++i)
+                {
+                    threads.push_back(std::thread([&pool, &allocated, i]()
+                    {
+                        for (u32 j = 0; j < k_numObjectsPerThread; ++j)
+                        {
+                            allocated[i].push_back(CS::MakeUnique<u32>(pool, i * k_numObjectsPerThread + j));
+                        }
+                    }));
+                }
+                
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                
+                for (u32 i = 0; i < k_numThreads; ++i)
+                {
+                    for (u32 j = 0; j < k_numObjectsPerThread; ++j)
+                    {
+                        REQUIRE(*allocated[i][j] == i * k_numObjectsPerThread + j);
+                    }
+                }
+                
+                allocated.clear();
+                
+                auto value = CS::MakeUnique<u32>(pool, 1);
+                REQUIRE(*value == 1);
+            }
+            
+            /// Confirms that the pool stays consistent when threads allocate and deallocate concurrently.
+            ///
+            SECTION("Contended")
+            {
+                Common::ConcurrentObjectPoolAllocator<u32> pool(k_numThreads);
+                std::atomic<u32> numFailures(0);
+                
+                std::vector<std::thread> threads;
+                for (u32 i = 0; i < k_numThreads; ++i)
+                {
+                    threads.push_back(std::thread([&pool, &numFailures, i]()
+                    {
+                        for (u32 j = 0; j < k_numObjectsPerThread; ++j)
+                        {
+                            auto value = CS::MakeUnique<u32>(pool, i);
+                            std::this_thread::yield();
+                            
+                            if (*value != i)
+                            {
+                                ++numFailures;
+                            }
+                        }
+                    }));
+                }
+                
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                
+                REQUIRE(numFailures == 0);
+            }
+        }
+    }
+}
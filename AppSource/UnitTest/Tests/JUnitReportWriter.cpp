@@ -0,0 +1,65 @@
+//
+//  JUnitReportWriter.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Report/JUnitReportWriter.h>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        /// A series of tests for the JUnitReportWriter
+        ///
+        TEST_CASE("JUnitReportWriter", "[Report]")
+        {
+            /// Confirms that reserved characters are replaced with their entities.
+            ///
+            SECTION("ReservedCharacters")
+            {
+                REQUIRE(Common::JUnitReportWriter::EscapeXml("a < b && c > \"d\" 'e'") == "a &lt; b &amp;&amp; c &gt; &quot;d&quot; &apos;e&apos;");
+            }
+            
+            /// Confirms that control characters which XML 1.0 doesn't allow are replaced, while tabs and line breaks are kept.
+            ///
+            SECTION("ControlCharacters")
+            {
+                REQUIRE(Common::JUnitReportWriter::EscapeXml(std::string("a\x01" "b\x1b" "c\0d", 7)) == "a?b?c?d");
+                REQUIRE(Common::JUnitReportWriter::EscapeXml("a\tb\nc\rd") == "a\tb\nc\rd");
+            }
+            
+            /// Confirms that multi-byte UTF-8 characters are left unchanged.
+            ///
+            SECTION("Utf8")
+            {
+                REQUIRE(Common::JUnitReportWriter::EscapeXml("caf\xc3\xa9") == "caf\xc3\xa9");
+            }
+        }
+    }
+}
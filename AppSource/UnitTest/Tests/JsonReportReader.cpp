@@ -0,0 +1,104 @@
+//
+//  JsonReportReader.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Report/JsonReportReader.h>
+#include <Common/Report/JsonReportWriter.h>
+#include <UnitTest/TestSystem/Report.h>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        namespace
+        {
+            //------------------------------------------------------------------------------
+            /// @return A report containing one passing test case with a benchmark and a
+            /// section, and one failing test case.
+            //------------------------------------------------------------------------------
+            Report CreateReport() noexcept
+            {
+                std::vector<BenchmarkResult> benchmarkResults = { BenchmarkResult("Benchmark", 100, { 0.25f, 0.5f, 0.75f }) };
+                std::vector<SectionResult> sectionResults = { SectionResult("Passing", "Section", 0.5f, 2) };
+                
+                std::vector<FailedAssertion> failedAssertions = { FailedAssertion("Failing.cpp", 42, "a == b") };
+                std::vector<FailedSection> failedSections = { FailedSection("Section", 3, failedAssertions) };
+                std::vector<FailedTestCase> failedTestCases = { FailedTestCase("Failing", 2, 5, failedSections) };
+                
+                std::vector<TestCaseResult> testCaseResults = { TestCaseResult("Passing", true, 1.0f, Common::AllocationStats(), benchmarkResults, sectionResults),
+                                                                TestCaseResult("Failing", false, 0.5f, Common::AllocationStats(), std::vector<BenchmarkResult>(), std::vector<SectionResult>()) };
+                
+                return Report(2, 4, 9, failedTestCases, testCaseResults);
+            }
+        }
+        
+        /// A series of tests for the JsonReportReader
+        ///
+        TEST_CASE("JsonReportReader", "[Report]")
+        {
+            /// Confirms that a unit test report written by JsonReportWriter can be rebuilt without losing information.
+            ///
+            SECTION("RoundTrip")
+            {
+                Report report;
+                REQUIRE(Common::JsonReportReader::FromJson(Common::JsonReportWriter::ToJson(CreateReport()), report));
+                
+                REQUIRE(report.GetNumTestCases() == 2);
+                REQUIRE(report.GetNumSections() == 4);
+                REQUIRE(report.GetNumAssertions() == 9);
+                REQUIRE(report.GetNumFailedTestCases() == 1);
+                REQUIRE(report.GetNumFailedAssertions() == 1);
+                
+                const auto& failedTestCase = report.GetFailedTestCases()[0];
+                REQUIRE(failedTestCase.GetName() == "Failing");
+                REQUIRE(failedTestCase.GetNumSections() == 2);
+                REQUIRE(failedTestCase.GetNumAssertions() == 5);
+                REQUIRE(failedTestCase.GetFailedSections()[0].GetNumAssertions() == 3);
+                REQUIRE(failedTestCase.GetFailedSections()[0].GetFailedAssertions()[0].GetLine() == 42);
+                
+                REQUIRE(report.GetTestCaseResults().size() == 2);
+                const auto& testCaseResult = report.GetTestCaseResults()[0];
+                REQUIRE(testCaseResult.HasPassed());
+                REQUIRE(testCaseResult.GetBenchmarkResults()[0].GetSampleSeconds().size() == 3);
+                REQUIRE(testCaseResult.GetBenchmarkResults()[0].GetNumIterations() == 100);
+                REQUIRE(testCaseResult.GetSectionResults()[0].GetNumRuns() == 2);
+            }
+            
+            /// Confirms that invalid json is rejected.
+            ///
+            SECTION("InvalidJson")
+            {
+                Report report;
+                REQUIRE(!Common::JsonReportReader::FromJson("{ \"TestCases\": ", report));
+                REQUIRE(!Common::JsonReportReader::FromJson("[]", report));
+            }
+        }
+    }
+}
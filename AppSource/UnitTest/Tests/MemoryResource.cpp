@@ -0,0 +1,215 @@
+//
+//  MemoryResource.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Memory/MemoryResource.h>
+#include <Common/Memory/PolymorphicAllocator.h>
+#include <Common/Performance/AllocationTracker.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        namespace
+        {
+            constexpr u32 k_numElements = 64;
+            constexpr u32 k_numContainers = 10;
+            constexpr std::size_t k_bufferSize = 64 * 1024;
+            constexpr std::size_t k_pageSize = 4096;
+            
+            template <typename TType> using ResourceVector = std::vector<TType, Common::PolymorphicAllocator<TType>>;
+            
+            /// Fills a vector with consecutive values, without reserving space first so
+            /// that it is reallocated as it grows.
+            ///
+            template <typename TVector> void Fill(TVector& in_vector) noexcept
+            {
+                for (u32 i = 0; i < k_numElements; ++i)
+                {
+                    in_vector.push_back(int(i));
+                }
+            }
+        }
+        
+        /// A series of tests for the AllocatorMemoryResource and PolymorphicAllocator
+        ///
+        TEST_CASE("MemoryResource", "[Allocator]")
+        {
+            /// Confirms that a standard container can be backed by a LinearAllocator.
+            ///
+            SECTION("LinearAllocatorBacked")
+            {
+                CS::LinearAllocator linearAllocator(k_bufferSize);
+                Common::AllocatorMemoryResource resource(linearAllocator);
+                
+                {
+                    ResourceVector<int> values(&resource);
+                    Fill(values);
+                    
+                    for (u32 i = 0; i < k_numElements; ++i)
+                    {
+                        REQUIRE(values[i] == int(i));
+                    }
+                    
+                    REQUIRE(linearAllocator.GetFreeSpace() < linearAllocator.GetBufferSize());
+                }
+                
+                linearAllocator.Reset();
+            }
+            
+            /// Confirms that a standard container can be backed by a PagedLinearAllocator.
+            ///
+            SECTION("PagedLinearAllocatorBacked")
+            {
+                struct ExampleClass
+                {
+                    ExampleClass(int x) : m_x(x), m_y(x * 2) {}
+                    int m_x, m_y;
+                };
+                
+                CS::PagedLinearAllocator pagedLinearAllocator(k_pageSize);
+                Common::AllocatorMemoryResource resource(pagedLinearAllocator);
+                
+                {
+                    ResourceVector<ExampleClass> values(&resource);
+                    Fill(values);
+                    
+                    for (u32 i = 0; i < k_numElements; ++i)
+                    {
+                        REQUIRE(values[i].m_x == int(i));
+                        REQUIRE(values[i].m_y == int(i) * 2);
+                    }
+                }
+                
+                pagedLinearAllocator.Reset();
+            }
+            
+            /// Confirms that a node based standard container can be backed by an ObjectPoolAllocator.
+            ///
+            SECTION("ObjectPoolAllocatorBacked")
+            {
+                using Slot = std::array<std::int64_t, 8>;
+                
+                CS::ObjectPoolAllocator<Slot> pool(k_numElements);
+                Common::AllocatorMemoryResource resource(pool);
+                
+                std::list<int, Common::PolymorphicAllocator<int>> values(&resource);
+                Fill(values);
+                
+                auto value = 0;
+                for (auto element : values)
+                {
+                    REQUIRE(element == value++);
+                }
+            }
+            
+            /// Confirms that the elements of a standard container are aligned to their type's alignment.
+            ///
+            SECTION("OverAligned")
+            {
+                struct alignas(64) ExampleClass
+                {
+                    ExampleClass(int x) : m_x(x) {}
+                    int m_x;
+                };
+                
+                // The vector's final growth needs a page which holds every element plus its alignment padding.
+                CS::PagedLinearAllocator pagedLinearAllocator(k_bufferSize);
+                Common::AllocatorMemoryResource resource(pagedLinearAllocator);
+                
+                {
+                    ResourceVector<ExampleClass> values(&resource);
+                    Fill(values);
+                    
+                    REQUIRE((reinterpret_cast<std::uintptr_t>(values.data()) % alignof(ExampleClass)) == 0);
+                    REQUIRE(values.back().m_x == int(k_numElements - 1));
+                }
+                
+                pagedLinearAllocator.Reset();
+            }
+            
+            /// Confirms that allocators of different types are equal only if they use the same resource.
+            ///
+            SECTION("Equality")
+            {
+                CS::LinearAllocator linearAllocator(k_bufferSize);
+                Common::AllocatorMemoryResource resourceA(linearAllocator);
+                Common::AllocatorMemoryResource resourceB(linearAllocator);
+                
+                Common::PolymorphicAllocator<int> allocatorA(&resourceA);
+                Common::PolymorphicAllocator<float> allocatorB(allocatorA);
+                Common::PolymorphicAllocator<int> allocatorC(&resourceB);
+                
+                REQUIRE(allocatorA == allocatorB);
+                REQUIRE(allocatorA != allocatorC);
+            }
+            
+            /// Confirms that containers backed by a CS allocator make fewer heap allocations than those which
+            /// use the global heap. This is only checked if allocation tracking is enabled. The total count is
+            /// read rather than constructing trackers, which would reset those tracking the test case.
+            ///
+            SECTION("AllocationReduction")
+            {
+                if (Common::AllocationTracker::IsEnabled())
+                {
+                    CS::PagedLinearAllocator pagedLinearAllocator(k_bufferSize);
+                    Common::AllocatorMemoryResource resource(pagedLinearAllocator);
+                    
+                    auto heapStart = Common::AllocationTracker::GetTotalNumAllocations();
+                    for (u32 i = 0; i < k_numContainers; ++i)
+                    {
+                        std::vector<int> values;
+                        Fill(values);
+                    }
+                    auto numHeapAllocations = Common::AllocationTracker::GetTotalNumAllocations() - heapStart;
+                    
+                    auto resourceStart = Common::AllocationTracker::GetTotalNumAllocations();
+                    for (u32 i = 0; i < k_numContainers; ++i)
+                    {
+                        ResourceVector<int> values(&resource);
+                        Fill(values);
+                    }
+                    auto numResourceAllocations = Common::AllocationTracker::GetTotalNumAllocations() - resourceStart;
+                    
+                    REQUIRE(numResourceAllocations < numHeapAllocations);
+                    
+                    pagedLinearAllocator.Reset();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,109 @@
+//
+//  PerformanceGate.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Performance/PerformanceBaseline.h>
+#include <Common/Performance/PerformanceGate.h>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        namespace
+        {
+            constexpr f32 k_tolerance = 0.3f;
+            constexpr f32 k_baselineSeconds = 1.0f;
+            
+            /// @param in_seconds - The duration of the example test.
+            ///
+            /// @return A baseline containing the duration of a single example test.
+            ///
+            Common::PerformanceBaseline CreateBaseline(f32 in_seconds) noexcept
+            {
+                Common::PerformanceBaseline baseline;
+                baseline.SetMetric(Common::PerformanceBaseline::CreateKey(Common::PerformanceBaseline::k_unitTestSuite, "Example", "Test"), Common::PerformanceBaseline::k_durationMetric, in_seconds);
+                return baseline;
+            }
+        }
+        
+        /// A series of tests for the PerformanceGate
+        ///
+        TEST_CASE("PerformanceGate", "[Performance]")
+        {
+            auto baseline = CreateBaseline(k_baselineSeconds);
+            auto regressed = CreateBaseline(k_baselineSeconds * (1.0f + k_tolerance * 2.0f));
+            auto withinTolerance = CreateBaseline(k_baselineSeconds * (1.0f + k_tolerance * 0.5f));
+            
+            /// Confirms that a regression beyond the tolerance fails the gate in fail mode.
+            ///
+            SECTION("FailMode")
+            {
+                Common::PerformanceGate gate(Common::PerformanceGate::Mode::k_fail, k_tolerance);
+                auto result = gate.Compare(baseline, regressed);
+                
+                REQUIRE(!result.HasPassed());
+                REQUIRE(result.GetRegressions().size() == 1);
+            }
+            
+            /// Confirms that a regression beyond the tolerance is reported but doesn't fail the gate in warn mode.
+            ///
+            SECTION("WarnMode")
+            {
+                Common::PerformanceGate gate(Common::PerformanceGate::Mode::k_warn, k_tolerance);
+                auto result = gate.Compare(baseline, regressed);
+                
+                REQUIRE(result.HasPassed());
+                REQUIRE(result.GetRegressions().size() == 1);
+            }
+            
+            /// Confirms that a slowdown within the tolerance is not a regression.
+            ///
+            SECTION("WithinTolerance")
+            {
+                Common::PerformanceGate gate(Common::PerformanceGate::Mode::k_fail, k_tolerance);
+                auto result = gate.Compare(baseline, withinTolerance);
+                
+                REQUIRE(result.HasPassed());
+                REQUIRE(result.GetRegressions().empty());
+            }
+            
+            /// Confirms that nothing is reported when the gate is disabled.
+            ///
+            SECTION("Disabled")
+            {
+                Common::PerformanceGate gate(Common::PerformanceGate::Mode::k_disabled, k_tolerance);
+                auto result = gate.Compare(baseline, regressed);
+                
+                REQUIRE(result.HasPassed());
+                REQUIRE(result.GetRegressions().empty());
+            }
+        }
+    }
+}
@@ -0,0 +1,240 @@
+//
+//  ScratchAllocator.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Memory/ScratchAllocator.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        namespace
+        {
+            constexpr std::size_t k_pageSize = alignof(std::max_align_t) * 2;
+        }
+        
+        /// A series of tests for the ScratchAllocator
+        ///
+        TEST_CASE("ScratchAllocator", "[Allocator]")
+        {
+            /// Confirms that a unique pointer to a struct instance with a constructor can be allocated from a ScratchAllocator.
+            ///
+            SECTION("UniqueStructConstructor")
+            {
+                struct ExampleClass
+                {
+                    ExampleClass(int x, int y) : m_x(x), m_y(y) {}
+                    int m_x, m_y;
+                };
+                
+                Common::ScratchAllocator scratchAllocator;
+                
+                auto allocated = CS::MakeUnique<ExampleClass>(scratchAllocator, 1, 2);
+                
+                REQUIRE(allocated->m_x == 1);
+                REQUIRE(allocated->m_y == 2);
+            }
+            
+            /// Confirms that paging works correctly in the ScratchAllocator.
+            ///
+            SECTION("Paging")
+            {
+                Common::ScratchAllocator scratchAllocator(k_pageSize);
+                
+                auto valueA = CS::MakeUnique<std::int64_t>(scratchAllocator, 1);
+                auto valueB = CS::MakeUnique<std::int64_t>(scratchAllocator, 2);
+                auto valueC = CS::MakeUnique<std::int64_t>(scratchAllocator, 3);
+                
+                REQUIRE(*valueA == 1);
+                REQUIRE(*valueB == 2);
+                REQUIRE(*valueC == 3);
+                REQUIRE(scratchAllocator.GetNumPages() == 2);
+            }
+            
+            /// Confirms that rewinding to a marker reuses the memory allocated after it.
+            ///
+            SECTION("Rewind")
+            {
+                Common::ScratchAllocator scratchAllocator;
+                
+                auto valueA = CS::MakeUnique<int>(scratchAllocator, 1);
+                auto marker = scratchAllocator.GetMarker();
+                
+                auto valueB = CS::MakeUnique<int>(scratchAllocator, 2);
+                auto addressB = valueB.get();
+                valueB.reset();
+                
+                scratchAllocator.Rewind(marker);
+                
+                auto valueC = CS::MakeUnique<int>(scratchAllocator, 3);
+                
+                REQUIRE(valueC.get() == addressB);
+                REQUIRE(*valueA == 1);
+                REQUIRE(*valueC == 3);
+            }
+            
+            /// Confirms that rewinding to a marker releases the pages acquired after it.
+            ///
+            SECTION("RewindReleasesPages")
+            {
+                Common::ScratchAllocator scratchAllocator(k_pageSize);
+                
+                auto valueA = CS::MakeUnique<std::int64_t>(scratchAllocator, 1);
+                auto marker = scratchAllocator.GetMarker();
+                
+                {
+                    auto valueB = CS::MakeUnique<std::int64_t>(scratchAllocator, 2);
+                    auto valueC = CS::MakeUnique<std::int64_t>(scratchAllocator, 3);
+                    auto valueD = CS::MakeUnique<std::int64_t>(scratchAllocator, 4);
+                    auto valueE = CS::MakeUnique<std::int64_t>(scratchAllocator, 5);
+                    
+                    REQUIRE(scratchAllocator.GetNumPages() == 3);
+                }
+                
+                scratchAllocator.Rewind(marker);
+                
+                REQUIRE(scratchAllocator.GetNumPages() == 1);
+                REQUIRE(*valueA == 1);
+            }
+            
+            /// Confirms that scoped markers can be nested, with each rewinding to its own position.
+            ///
+            SECTION("NestedScopedMarkers")
+            {
+                Common::ScratchAllocator scratchAllocator;
+                
+                auto valueA = CS::MakeUnique<std::int64_t>(scratchAllocator, 1);
+                std::int64_t* addressB = nullptr;
+                std::int64_t* addressC = nullptr;
+                
+                {
+                    Common::ScratchAllocator::ScopedMarker outerMarker(scratchAllocator);
+                    
+                    auto valueB = CS::MakeUnique<std::int64_t>(scratchAllocator, 2);
+                    addressB = valueB.get();
+                    
+                    {
+                        Common::ScratchAllocator::ScopedMarker innerMarker(scratchAllocator);
+                        
+                        auto valueC = CS::MakeUnique<std::int64_t>(scratchAllocator, 3);
+                        addressC = valueC.get();
+                    }
+                    
+                    auto valueD = CS::MakeUnique<std::int64_t>(scratchAllocator, 4);
+                    REQUIRE(valueD.get() == addressC);
+                    REQUIRE(*valueB == 2);
+                }
+                
+                auto valueE = CS::MakeUnique<std::int64_t>(scratchAllocator, 5);
+                REQUIRE(valueE.get() == addressB);
+                REQUIRE(*valueA == 1);
+            }
+            
+            /// Confirms that an allocation made before a scoped marker can be deallocated while the marker is in scope.
+            ///
+            SECTION("DeallocateBeforeScopedMarker")
+            {
+                Common::ScratchAllocator scratchAllocator;
+                
+                auto valueA = CS::MakeUnique<std::int64_t>(scratchAllocator, 1);
+                std::int64_t* addressB = nullptr;
+                
+                {
+                    Common::ScratchAllocator::ScopedMarker marker(scratchAllocator);
+                    
+                    auto valueB = CS::MakeUnique<std::int64_t>(scratchAllocator, 2);
+                    addressB = valueB.get();
+                    valueA.reset();
+                    
+                    REQUIRE(*valueB == 2);
+                }
+                
+                auto valueC = CS::MakeUnique<std::int64_t>(scratchAllocator, 3);
+                REQUIRE(valueC.get() == addressB);
+                REQUIRE(*valueC == 3);
+            }
+            
+            /// Confirms that shinking works correctly in the ScratchAllocator.
+            ///
+            SECTION("Shrinking")
+            {
+                Common::ScratchAllocator scratchAllocator(k_pageSize);
+                
+                {
+                    auto valueA = CS::MakeUnique<std::int64_t>(scratchAllocator, 1);
+                    auto valueB = CS::MakeUnique<std::int64_t>(scratchAllocator, 2);
+                    auto valueC = CS::MakeUnique<std::int64_t>(scratchAllocator, 3);
+                }
+                
+                scratchAllocator.Reset();
+                REQUIRE(scratchAllocator.GetNumPages() == 2);
+                
+                scratchAllocator.ResetAndShrink();
+                REQUIRE(scratchAllocator.GetNumPages() == 1);
+            }
+            
+            /// Confirms that a ScratchAllocator can be backed by another allocator, and that rewinding returns pages to it.
+            ///
+            SECTION("AllocatorBacked")
+            {
+                constexpr std::size_t k_parentAllocatorPageSize = 2048;
+                constexpr std::size_t k_childAllocatorPageSize = 512;
+                
+                CS::PagedLinearAllocator parentAllocator(k_parentAllocatorPageSize);
+                
+                {
+                    Common::ScratchAllocator childAllocator(parentAllocator, k_childAllocatorPageSize);
+                    
+                    {
+                        Common::ScratchAllocator::ScopedMarker marker(childAllocator);
+                        
+                        auto allocatedA = CS::MakeUniqueArray<u8>(childAllocator, k_childAllocatorPageSize / 2 + 1);
+                        auto allocatedB = CS::MakeUniqueArray<u8>(childAllocator, k_childAllocatorPageSize / 2 + 1);
+                        allocatedA[0] = 1;
+                        allocatedB[0] = 2;
+                        
+                        REQUIRE(allocatedA[0] == 1);
+                        REQUIRE(allocatedB[0] == 2);
+                        REQUIRE(childAllocator.GetNumPages() == 2);
+                    }
+                    
+                    REQUIRE(childAllocator.GetNumPages() == 1);
+                }
+                
+                parentAllocator.Reset();
+            }
+        }
+    }
+}
@@ -0,0 +1,186 @@
+//
+//  TrackedAllocator.cpp
+//  CSTest
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <CSTest.h>
+
+#include <Common/Core/Approx.h>
+#include <Common/Memory/AllocatorRegistry.h>
+#include <Common/Memory/TrackedAllocator.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Memory.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <catch.hpp>
+
+namespace CSTest
+{
+    namespace UnitTest
+    {
+        namespace
+        {
+            constexpr u32 k_defaultNumObjects = 5;
+            constexpr std::size_t k_bufferSize = 1024;
+        }
+        
+        /// A series of tests for the TrackedAllocator
+        ///
+        TEST_CASE("TrackedAllocator", "[Allocator]")
+        {
+            /// Confirms that allocations and deallocations are counted.
+            ///
+            SECTION("Counts")
+            {
+                CS::ObjectPoolAllocator<int> pool(k_defaultNumObjects);
+                Common::TrackedAllocator trackedAllocator("Counts", pool);
+                
+                auto valueA = CS::MakeUnique<int>(trackedAllocator, 1);
+                auto valueB = CS::MakeUnique<int>(trackedAllocator, 2);
+                valueB.reset();
+                
+                auto stats = trackedAllocator.GetStats();
+                REQUIRE(stats.GetName() == "Counts");
+                REQUIRE(stats.GetNumAllocations() == 2);
+                REQUIRE(stats.GetNumDeallocations() == 1);
+                REQUIRE(*valueA == 1);
+            }
+            
+            /// Confirms that the bytes in use and the peak bytes in use are recorded.
+            ///
+            SECTION("BytesInUse")
+            {
+                CS::ObjectPoolAllocator<std::int64_t> pool(k_defaultNumObjects);
+                Common::TrackedAllocator trackedAllocator("BytesInUse", pool);
+                
+                {
+                    auto valueA = CS::MakeUnique<std::int64_t>(trackedAllocator, 1);
+                    auto valueB = CS::MakeUnique<std::int64_t>(trackedAllocator, 2);
+                    
+                    REQUIRE(trackedAllocator.GetStats().GetBytesInUse() == 2 * sizeof(std::int64_t));
+                }
+                
+                auto stats = trackedAllocator.GetStats();
+                REQUIRE(stats.GetBytesInUse() == 0);
+                REQUIRE(stats.GetPeakBytesInUse() == 2 * sizeof(std::int64_t));
+                REQUIRE(stats.GetNumPages() == 0);
+                REQUIRE(stats.GetPeakWastedBytesPerPage() == 0.0f);
+            }
+            
+            /// Confirms that the consumed portion of a linear allocator's buffer is recorded as reserved.
+            ///
+            SECTION("Linear")
+            {
+                CS::LinearAllocator linearAllocator(k_bufferSize);
+                Common::TrackedAllocator trackedAllocator("Linear", linearAllocator);
+                
+                {
+                    auto valueA = CS::MakeUnique<std::int64_t>(trackedAllocator, 1);
+                    auto valueB = CS::MakeUnique<std::int64_t>(trackedAllocator, 2);
+                    valueB.reset();
+                    auto valueC = CS::MakeUnique<std::int64_t>(trackedAllocator, 3);
+                    
+                    auto stats = trackedAllocator.GetStats();
+                    REQUIRE(stats.GetReservedBytes() == linearAllocator.GetBufferSize() - linearAllocator.GetFreeSpace());
+                    REQUIRE(stats.GetReservedBytes() >= 3 * sizeof(std::int64_t));
+                }
+                
+                linearAllocator.Reset();
+            }
+            
+            /// Confirms that the page count history, peak page count and wasted bytes of a paged linear allocator are recorded.
+            ///
+            SECTION("Paged")
+            {
+                constexpr std::size_t k_pageSize = sizeof(std::int64_t) * 2;
+                
+                CS::PagedLinearAllocator pagedLinearAllocator(k_pageSize);
+                Common::TrackedAllocator trackedAllocator("Paged", pagedLinearAllocator);
+                
+                {
+                    std::vector<CS::UniquePtr<std::int64_t>> values;
+                    for (u32 i = 0; i < k_defaultNumObjects; ++i)
+                    {
+                        values.push_back(CS::MakeUnique<std::int64_t>(trackedAllocator, std::int64_t(i)));
+                    }
+                }
+                
+                auto stats = trackedAllocator.GetStats();
+                REQUIRE(stats.GetNumPages() == 3);
+                REQUIRE(stats.GetPeakNumPages() == 3);
+                REQUIRE(stats.GetReservedBytes() == 3 * k_pageSize);
+                REQUIRE(stats.GetPeakWastedBytes() == sizeof(std::int64_t));
+                REQUIRE(stats.GetPeakUsageNumPages() == 3);
+                REQUIRE(stats.GetPageHistory() == std::vector<u32>({ 1, 2, 3 }));
+                
+                pagedLinearAllocator.ResetAndShrink();
+                auto value = CS::MakeUnique<std::int64_t>(trackedAllocator, 1);
+                
+                stats = trackedAllocator.GetStats();
+                REQUIRE(stats.GetNumPages() == 1);
+                REQUIRE(stats.GetPeakNumPages() == 3);
+                REQUIRE(stats.GetPageHistory() == std::vector<u32>({ 1, 2, 3, 1 }));
+                
+                // Deallocated memory isn't reclaimed, so pages are acquired without usage exceeding its peak.
+                value.reset();
+                for (u32 i = 0; i < 2 * k_defaultNumObjects; ++i)
+                {
+                    CS::MakeUnique<std::int64_t>(trackedAllocator, std::int64_t(i));
+                }
+                
+                stats = trackedAllocator.GetStats();
+                REQUIRE(stats.GetPeakNumPages() == 6);
+                REQUIRE(stats.GetPeakUsageNumPages() == 3);
+                REQUIRE(Common::Approx(stats.GetPeakWastedBytesPerPage(), f32(sizeof(std::int64_t)) / 3.0f));
+                
+                pagedLinearAllocator.ResetAndShrink();
+            }
+            
+            /// Confirms that a tracked allocator can be found in the registry for as long as it exists.
+            ///
+            SECTION("Registry")
+            {
+                auto allocatorRegistry = CS::Application::Get()->GetSystem<Common::AllocatorRegistry>();
+                REQUIRE(allocatorRegistry != nullptr);
+                
+                Common::AllocatorStats stats;
+                {
+                    CS::ObjectPoolAllocator<int> pool(k_defaultNumObjects);
+                    Common::TrackedAllocator trackedAllocator("TrackedAllocatorRegistryTest", pool);
+                    
+                    auto value = CS::MakeUnique<int>(trackedAllocator, 1);
+                    
+                    REQUIRE(allocatorRegistry->TryGetStats("TrackedAllocatorRegistryTest", stats));
+                    REQUIRE(stats.GetNumAllocations() == 1);
+                }
+                
+                REQUIRE(!allocatorRegistry->TryGetStats("TrackedAllocatorRegistryTest", stats));
+            }
+        }
+    }
+}
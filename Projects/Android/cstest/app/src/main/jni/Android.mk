@@ -37,6 +37,9 @@ APPLICATION_FILES := $(shell 'python' '$(CS_SCRIPT_GETFILESWITHEXTENSIONS)' '--d
 include $(CLEAR_VARS)
 LOCAL_MODULE := $(CS_MODULENAME_APPLICATION)
 LOCAL_CXXFLAGS := $(CS_CXXFLAGS) -DCATCH_CONFIG_COLOUR_NONE
+ifeq ($(CSTEST_ALLOCATION_TRACKING),1)
+LOCAL_CXXFLAGS += -DCSTEST_ENABLE_ALLOCATION_TRACKING
+endif
 LOCAL_SRC_FILES := $(APPLICATION_FILES)
 LOCAL_WHOLE_STATIC_LIBRARIES := $(CS_STATIC_LIBRARIES)
 LOCAL_LDLIBS := $(CS_LDLIBS)
@@ -58,6 +58,11 @@ ADDITIONAL_LIBRARIES = ""
 ADDITIONAL_SRC_DIRS = [os.path.normpath('{}/'.format(APP_SRC_ROOT))]
 APP_NAME = "CSTest"
 
+# Replaces the global allocation functions so that tests can report their heap allocations.
+if os.environ.get("CSTEST_ALLOCATION_TRACKING") == "1":
+	for target in ADDITIONAL_COMPILER_FLAGS_TARGET_MAP:
+		ADDITIONAL_COMPILER_FLAGS_TARGET_MAP[target] += " -DCSTEST_ENABLE_ALLOCATION_TRACKING"
+
 # The entry point into the script.
 #
 # @param args 